@@ -0,0 +1,111 @@
+
+/*============================================================================
+
+This C header file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "softfloat.h"
+
+/*----------------------------------------------------------------------------
+| A corpus file holds failing cases, each with the function's name, rounding
+| code and rounding precision (as in `verCases_functionNamePtr',
+| `verCases_roundingCode' and `verCases_roundingPrecision' when it was
+| written) and its operands.  A case is stored only once in a file.
+|   After `corpus_record', every case written by the `writeCase' functions is
+| added to the named file, unless it is there already.  The `_operand'
+| functions are called by the `writeCase_a' functions for each operand in
+| turn (a floating-point operand as the integer of its bits), and
+| `corpus_addCase' by the `writeCase_z' functions.  A file left damaged by an
+| interrupted run is repaired when it is opened.
+*----------------------------------------------------------------------------*/
+extern bool corpus_recording;
+
+void corpus_record( const char *path );
+void corpus_ui16Operand( uint_fast16_t );
+void corpus_ui32Operand( uint_fast32_t );
+void corpus_ui64Operand( uint_fast64_t );
+#ifdef EXTFLOAT80
+void corpus_extF80MOperand( const extFloat80_t * );
+#endif
+#ifdef FLOAT128
+void corpus_f128MOperand( const float128_t * );
+#endif
+void corpus_addCase( void );
+
+/*----------------------------------------------------------------------------
+| `corpus_countClasses' adds to each element of `counts' (indexed by the
+| classes of `errorClasses.h') the number of operands of that class in the
+| cases recorded for the named function, or for every function if `namePtr'
+| is null.
+*----------------------------------------------------------------------------*/
+void corpus_countClasses( const char *namePtr, uint_fast64_t counts[] );
+
+/*----------------------------------------------------------------------------
+| After `corpus_replay', the case generators give the cases from the named
+| file in place of their own.  `corpus_numCases' returns how many cases the
+| file has for a function, rounding code and rounding precision, where a
+| negative rounding code or precision matches any.
+|   Before a test loop is run, its thread calls `corpus_selectCases' to pick
+| out the cases of one function, rounding code and rounding precision.  A
+| generator's `_init' function then calls `corpus_startCases', which returns
+| the number of cases, and its `_next' function calls `corpus_setCase' with
+| the number of the case it gives, and takes each operand of the case from
+| the `_case' functions.
+|   Cases to replay can also be made up instead of read from a file:
+| `corpus_clearReplay' forgets all cases to replay, and `corpus_addReplayCase'
+| adds one for the named function (with rounding code and precision zero)
+| from the operands given to the `_operand' functions since the last case.
+| Cases of one function are kept in the order they were added.
+*----------------------------------------------------------------------------*/
+extern bool corpus_replaying;
+
+void corpus_replay( const char *path );
+void corpus_clearReplay( void );
+void corpus_addReplayCase( const char *namePtr );
+uint_fast64_t corpus_numCases( const char *, int, int );
+void corpus_selectCases( const char *, int, int );
+uint_fast64_t corpus_startCases( void );
+void corpus_setCase( uint_fast64_t );
+uint_fast16_t corpus_ui16Case( int );
+uint_fast32_t corpus_ui32Case( int );
+uint_fast64_t corpus_ui64Case( int );
+#ifdef EXTFLOAT80
+void corpus_extF80MCase( int, extFloat80_t * );
+#endif
+#ifdef FLOAT128
+void corpus_f128MCase( int, float128_t * );
+#endif
+
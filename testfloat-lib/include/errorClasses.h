@@ -0,0 +1,129 @@
+
+/*============================================================================
+
+This C header file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "softfloat.h"
+
+/*----------------------------------------------------------------------------
+| While `errorClasses_active' is true, the `writeCase' functions do not
+| write every failing case.  They sort it by a signature instead:  the class
+| of each operand (zero, subnormal, normal, infinity, quiet NaN or
+| signaling NaN; an integer is zero or normal), the classes of the expected
+| and the actual result, and the flags that were missing or extra.  Each
+| signature is counted, and only its first `errorClasses_maxExamples' cases
+| are written, each tagged with the signature's number.
+|   The `_operand' functions are called by the `writeCase_a' functions for
+| each operand in turn.  The `_result' functions are called by the
+| `writeCase_z' functions; they return true if the case is to be written as
+| an example, in which case its operands have already been written.
+| `errorClasses_write' writes the count for each signature seen since the
+| last call, and forgets them.
+*----------------------------------------------------------------------------*/
+extern bool errorClasses_active;
+
+/*----------------------------------------------------------------------------
+| The classes, and their names.  `errorClasses_floatClass' returns the class
+| of a floating-point value from its biased exponent, the largest biased
+| exponent, whether its fraction is zero, and whether the top bit of its
+| fraction (the quiet bit of a NaN) is set.
+*----------------------------------------------------------------------------*/
+enum {
+    errorClasses_zero,
+    errorClasses_subnormal,
+    errorClasses_normal,
+    errorClasses_infinity,
+    errorClasses_qNaN,
+    errorClasses_sNaN,
+    errorClasses_numClasses
+};
+
+extern const char * const errorClasses_names[errorClasses_numClasses];
+
+int errorClasses_floatClass( uint_fast32_t, uint_fast32_t, bool, bool );
+
+enum { errorClasses_maxExamples = 3 };
+
+void errorClasses_ui32Operand( uint_fast32_t );
+void errorClasses_ui64Operand( uint_fast64_t );
+#ifdef FLOAT16
+void errorClasses_f16Operand( float16_t );
+#endif
+void errorClasses_bf16Operand( float16_t );
+void errorClasses_f32Operand( float32_t );
+#ifdef FLOAT64
+void errorClasses_f64Operand( float64_t );
+#endif
+#ifdef EXTFLOAT80
+void errorClasses_extF80MOperand( const extFloat80_t * );
+#endif
+#ifdef FLOAT128
+void errorClasses_f128MOperand( const float128_t * );
+#endif
+
+bool errorClasses_boolResult( bool, uint_fast8_t, bool, uint_fast8_t );
+bool
+ errorClasses_ui32Result(
+     uint_fast32_t, uint_fast8_t, uint_fast32_t, uint_fast8_t );
+bool
+ errorClasses_ui64Result(
+     uint_fast64_t, uint_fast8_t, uint_fast64_t, uint_fast8_t );
+#ifdef FLOAT16
+bool
+ errorClasses_f16Result( float16_t, uint_fast8_t, float16_t, uint_fast8_t );
+#endif
+bool
+ errorClasses_bf16Result( float16_t, uint_fast8_t, float16_t, uint_fast8_t );
+bool
+ errorClasses_f32Result( float32_t, uint_fast8_t, float32_t, uint_fast8_t );
+#ifdef FLOAT64
+bool
+ errorClasses_f64Result( float64_t, uint_fast8_t, float64_t, uint_fast8_t );
+#endif
+#ifdef EXTFLOAT80
+bool
+ errorClasses_extF80MResult(
+     const extFloat80_t *, uint_fast8_t, const extFloat80_t *, uint_fast8_t );
+#endif
+#ifdef FLOAT128
+bool
+ errorClasses_f128MResult(
+     const float128_t *, uint_fast8_t, const float128_t *, uint_fast8_t );
+#endif
+
+void errorClasses_write( void );
+
@@ -0,0 +1,67 @@
+
+/*============================================================================
+
+This C header file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*----------------------------------------------------------------------------
+| A history of how often each function has failed, used to test first what
+| is most likely to fail.  `failFast_load' reads the history from the file at
+| `path', if the file exists; `failFast_save' writes it back.
+| `failFast_record' adds one test of the named function, which found errors
+| if `failed' is true.  `failFast_score' returns the estimated chance that
+| the next test of the named function fails, (failures + 1) / (tests + 2),
+| so that a function with no history comes before one with a clean record.
+*----------------------------------------------------------------------------*/
+void failFast_load( const char *path );
+void failFast_save( const char *path );
+void failFast_record( const char *namePtr, bool failed );
+double failFast_score( const char *namePtr );
+
+/*----------------------------------------------------------------------------
+| `failFast_makeProbe' makes the cases to replay from the corpus (see
+| `corpus.h') a probe of the named function, which takes `numOperands'
+| operands of the type at the start of its name:  cases in which operands of
+| the classes that have failed before take a few typical values each, and
+| the other operands take the typical values of every class.  The classes
+| are those of the operands of the recorded corpus's cases for the function,
+| or for all functions if it has none, and those with the most failures come
+| first.  Returns the number of cases, which is zero if there is no history
+| of failing classes.
+*----------------------------------------------------------------------------*/
+uint_fast64_t failFast_makeProbe( const char *namePtr, int numOperands );
+
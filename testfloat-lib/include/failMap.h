@@ -0,0 +1,69 @@
+
+/*============================================================================
+
+This C header file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*----------------------------------------------------------------------------
+| Failure maps, for exhaustive testing.  After `failMap_open', the number of
+| every failing case (see `testLoops_keepErrorCase') is kept as a bit of a
+| map belonging to the thread that ran the case, and
+| `failMap_finishInstance', called when each instance is finished, adds the
+| calling thread's map to the named file if any case failed and then clears
+| it.  A map is held in tiles of 65536 cases, and only the tiles with
+| failures take room, in memory or in the file.
+|   So that every case is run, `failMap_open' sets `verCases_maxErrorCount'
+| to zero, keeping its former value in `failMap_maxErrorCount' as the number
+| of errors written for each instance (none if zero).
+|   A worker thread ends with `failMap_endPart', which hands over its map for
+| the thread finishing the instance to merge into its own with
+| `failMap_addPart'.  `failMap_nextCase' returns the number of the first
+| failing case of the calling thread's map not less than `caseNum', or
+| `UINT64_MAX' if none.
+*----------------------------------------------------------------------------*/
+extern bool failMap_active;
+extern uint_fast32_t failMap_maxErrorCount;
+
+struct failMap_part;
+
+void failMap_open( const char *path );
+void failMap_add( uint_fast64_t caseNum );
+struct failMap_part *failMap_endPart( void );
+void failMap_addPart( struct failMap_part * );
+uint_fast64_t failMap_nextCase( uint_fast64_t caseNum );
+void failMap_finishInstance( void );
+
@@ -0,0 +1,57 @@
+
+/*============================================================================
+
+This C header file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+#include <stdbool.h>
+
+/*----------------------------------------------------------------------------
+| The registry pairs each entry of `standardFunctionInfos' with its subject
+| function, by name, from the list `subjfloat_functions' that the
+| preprocessor builds out of "subjfloat_config.h".  It must be set up by
+| `functionRegistry_init' before any other use.
+|   `functionRegistry_subjFunctions' is indexed like `standardFunctionInfos',
+| with a null entry for each function that is not to be tested.
+| `functionRegistry_find' returns the index of the standard function named
+| `namePtr', or -1 if there is none.  `functionRegistry_select' limits
+| testing to the functions selected by it:  the first call drops all others,
+| and each call puts back the function at `standardFunctionNum', returning
+| false if that function has no subject function.
+*----------------------------------------------------------------------------*/
+extern void (**functionRegistry_subjFunctions)();
+
+void functionRegistry_init( void );
+int functionRegistry_find( const char *namePtr );
+bool functionRegistry_select( int standardFunctionNum );
+
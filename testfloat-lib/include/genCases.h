@@ -37,86 +37,224 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 #include "softfloat.h"
 
 extern int genCases_level;
 
 void genCases_setLevel( int );
 
-extern uint_fast64_t genCases_total;
-extern bool genCases_done;
+extern THREAD_LOCAL uint_fast64_t genCases_total;
+extern THREAD_LOCAL bool genCases_done;
+
+/*----------------------------------------------------------------------------
+| The cases of a generator are numbered from zero, and each case's operands
+| depend only on its number and the stream of the thread's random state (see
+| `random.h') when the generator's `_init' function was called:  every case
+| draws its random numbers from a run of that stream of its own.  So a case
+| can be made without making the ones before it.  After `genCases_seek', the
+| next call of a `_next' function gives case `caseNum' and continues from
+| there.  The `_at' functions do the same as `genCases_seek' followed by
+| `_next'.
+|   After `genCases_setPart', the `_init' functions in this thread limit the
+| cases to part `partNum' of `numParts' nearly equal consecutive parts, and
+| set `genCases_firstCaseNum' to the number of the part's first case;
+| `genCases_done' is set on the last case of the part.  A single part, the
+| default, has all of the cases.  `genCases_endPart' cuts the part short, so
+| that the next case given by a `_next' function is its last.
+| `genCases_caseNum' is the number of the case last given by a `_next'
+| function.
+|   Every `_init' function calls `genCases_startCases' with its number of
+| cases, and every `_next' function calls `genCases_nextCase' before making a
+| case.  That returns true if the case does not follow the one before it, so
+| that the generator must first find its place from `genCases_caseNum'.
+*----------------------------------------------------------------------------*/
+extern THREAD_LOCAL uint_fast64_t genCases_caseNum;
+extern THREAD_LOCAL uint_fast64_t genCases_firstCaseNum;
+
+void genCases_setPart( int partNum, int numParts );
+void genCases_endPart( void );
+void genCases_seek( uint_fast64_t caseNum );
+void genCases_startCases( uint_fast64_t total );
+bool genCases_nextCase( void );
+
+/*----------------------------------------------------------------------------
+| When `genCases_quick' is nonzero, the generators give a quick check in place
+| of the testing level's cases:  each operand's values are split into strata
+| by sign and by the exponents of the generator's tables, which also set
+| apart zero or subnormal and infinity or NaN, and `genCases_quick' cases are
+| drawn from every combination of the operands' strata.  Integer operands
+| are split by sign and the number of significant bits.  `genCases_setQuick'
+| sets the number of cases per stratum.
+|   `genCases_quickStart' starts a quick check of `numOperands' operands of
+| `numStrata' strata each.  For case `genCases_caseNum', `genCases_quickNext'
+| sets `genCases_quickStrata' to the strata of its operands and
+| `genCases_quickCaseNum' to its number within the combination.
+| `genCases_quickNumStrata' is the number of combinations of strata.
+*----------------------------------------------------------------------------*/
+extern int genCases_quick;
+
+void genCases_setQuick( int );
+void genCases_quickStart( int numStrata, int numOperands );
+void genCases_quickNext( void );
+extern THREAD_LOCAL int genCases_quickStrata[3];
+extern THREAD_LOCAL int genCases_quickCaseNum;
+extern THREAD_LOCAL uint_fast64_t genCases_quickNumStrata;
+
+/*----------------------------------------------------------------------------
+| When `genCases_exhaustive' is true, the generators of a single 32-bit
+| operand (`genCases_ui32_a', `genCases_i32_a' and `genCases_f32_a') give all
+| 2^32 values in place of the testing level's cases, case `genCases_caseNum'
+| being the value with that bit pattern.  Likewise, the generators of two
+| 16-bit operands (`genCases_f16_ab' and `genCases_bf16_ab') give all 2^32
+| pairs, operand `a' from the upper 16 bits of the case number and `b' from
+| the lower 16, so that any run of 65536 cases holds one value of `a' with
+| every value of `b'.  Other generators are unchanged.
+*----------------------------------------------------------------------------*/
+extern bool genCases_exhaustive;
+
+/*----------------------------------------------------------------------------
+| Each `_init' function points `genCases_writeCase' at a function that writes
+| the operands of the current case, in hexadecimal and separated by spaces,
+| to standard output.
+|   While `corpus_replaying' is true, the generators give only the cases
+| selected from the corpus (see `corpus.h'), in place of their own.
+*----------------------------------------------------------------------------*/
+extern THREAD_LOCAL void (*genCases_writeCase)( void );
 
 void genCases_ui32_a_init( void );
 void genCases_ui32_a_next( void );
-extern uint32_t genCases_ui32_a;
+void genCases_ui32_a_at( uint_fast64_t );
+extern THREAD_LOCAL uint32_t genCases_ui32_a;
 
 void genCases_ui64_a_init( void );
 void genCases_ui64_a_next( void );
-extern uint64_t genCases_ui64_a;
+void genCases_ui64_a_at( uint_fast64_t );
+extern THREAD_LOCAL uint64_t genCases_ui64_a;
 
 void genCases_i32_a_init( void );
 void genCases_i32_a_next( void );
-extern int32_t genCases_i32_a;
+void genCases_i32_a_at( uint_fast64_t );
+extern THREAD_LOCAL int32_t genCases_i32_a;
 
 void genCases_i64_a_init( void );
 void genCases_i64_a_next( void );
-extern int64_t genCases_i64_a;
+void genCases_i64_a_at( uint_fast64_t );
+extern THREAD_LOCAL int64_t genCases_i64_a;
 
 #ifdef FLOAT16
 void genCases_f16_a_init( void );
 void genCases_f16_a_next( void );
+void genCases_f16_a_at( uint_fast64_t );
 void genCases_f16_ab_init( void );
 void genCases_f16_ab_next( void );
+void genCases_f16_ab_at( uint_fast64_t );
 void genCases_f16_abc_init( void );
 void genCases_f16_abc_next( void );
-extern float16_t genCases_f16_a, genCases_f16_b, genCases_f16_c;
+void genCases_f16_abc_at( uint_fast64_t );
+extern THREAD_LOCAL float16_t genCases_f16_a, genCases_f16_b, genCases_f16_c;
 #endif
 
 void genCases_bf16_a_init( void );
 void genCases_bf16_a_next( void );
+void genCases_bf16_a_at( uint_fast64_t );
 void genCases_bf16_ab_init( void );
 void genCases_bf16_ab_next( void );
+void genCases_bf16_ab_at( uint_fast64_t );
 void genCases_bf16_abc_init( void );
 void genCases_bf16_abc_next( void );
-extern float16_t genCases_bf16_a, genCases_bf16_b, genCases_bf16_c;
+void genCases_bf16_abc_at( uint_fast64_t );
+extern THREAD_LOCAL float16_t
+ genCases_bf16_a, genCases_bf16_b, genCases_bf16_c;
 
 void genCases_f32_a_init( void );
 void genCases_f32_a_next( void );
+void genCases_f32_a_at( uint_fast64_t );
 void genCases_f32_ab_init( void );
 void genCases_f32_ab_next( void );
+void genCases_f32_ab_at( uint_fast64_t );
 void genCases_f32_abc_init( void );
 void genCases_f32_abc_next( void );
-extern float32_t genCases_f32_a, genCases_f32_b, genCases_f32_c;
+void genCases_f32_abc_at( uint_fast64_t );
+extern THREAD_LOCAL float32_t genCases_f32_a, genCases_f32_b, genCases_f32_c;
 
 #ifdef FLOAT64
 void genCases_f64_a_init( void );
 void genCases_f64_a_next( void );
+void genCases_f64_a_at( uint_fast64_t );
 void genCases_f64_ab_init( void );
 void genCases_f64_ab_next( void );
+void genCases_f64_ab_at( uint_fast64_t );
 void genCases_f64_abc_init( void );
 void genCases_f64_abc_next( void );
-extern float64_t genCases_f64_a, genCases_f64_b, genCases_f64_c;
+void genCases_f64_abc_at( uint_fast64_t );
+extern THREAD_LOCAL float64_t genCases_f64_a, genCases_f64_b, genCases_f64_c;
 #endif
 
 #ifdef EXTFLOAT80
 void genCases_extF80_a_init( void );
 void genCases_extF80_a_next( void );
+void genCases_extF80_a_at( uint_fast64_t );
 void genCases_extF80_ab_init( void );
 void genCases_extF80_ab_next( void );
+void genCases_extF80_ab_at( uint_fast64_t );
 void genCases_extF80_abc_init( void );
 void genCases_extF80_abc_next( void );
-extern extFloat80_t genCases_extF80_a, genCases_extF80_b, genCases_extF80_c;
+void genCases_extF80_abc_at( uint_fast64_t );
+extern THREAD_LOCAL extFloat80_t
+ genCases_extF80_a, genCases_extF80_b, genCases_extF80_c;
 #endif
 
 #ifdef FLOAT128
 void genCases_f128_a_init( void );
 void genCases_f128_a_next( void );
+void genCases_f128_a_at( uint_fast64_t );
 void genCases_f128_ab_init( void );
 void genCases_f128_ab_next( void );
+void genCases_f128_ab_at( uint_fast64_t );
 void genCases_f128_abc_init( void );
 void genCases_f128_abc_next( void );
-extern float128_t genCases_f128_a, genCases_f128_b, genCases_f128_c;
+void genCases_f128_abc_at( uint_fast64_t );
+extern THREAD_LOCAL float128_t
+ genCases_f128_a, genCases_f128_b, genCases_f128_c;
 #endif
 
 void genCases_writeTestsTotal( bool );
 
+/*----------------------------------------------------------------------------
+| `genCases_writeState' writes the whole state of every case generator, in
+| this thread, to `file', and `genCases_readState' reads it back, returning
+| false if the file ends too soon.  The saved form is only for the same build
+| of the same program.
+*----------------------------------------------------------------------------*/
+void genCases_writeState( FILE *file );
+bool genCases_readState( FILE *file );
+void genCases_ui32_writeState( FILE * );
+bool genCases_ui32_readState( FILE * );
+void genCases_ui64_writeState( FILE * );
+bool genCases_ui64_readState( FILE * );
+void genCases_i32_writeState( FILE * );
+bool genCases_i32_readState( FILE * );
+void genCases_i64_writeState( FILE * );
+bool genCases_i64_readState( FILE * );
+#ifdef FLOAT16
+void genCases_f16_writeState( FILE * );
+bool genCases_f16_readState( FILE * );
+#endif
+void genCases_bf16_writeState( FILE * );
+bool genCases_bf16_readState( FILE * );
+void genCases_f32_writeState( FILE * );
+bool genCases_f32_readState( FILE * );
+#ifdef FLOAT64
+void genCases_f64_writeState( FILE * );
+bool genCases_f64_readState( FILE * );
+#endif
+#ifdef EXTFLOAT80
+void genCases_extF80_writeState( FILE * );
+bool genCases_extF80_readState( FILE * );
+#endif
+#ifdef FLOAT128
+void genCases_f128_writeState( FILE * );
+bool genCases_f128_readState( FILE * );
+#endif
+
@@ -0,0 +1,130 @@
+
+/*============================================================================
+
+This C header file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*----------------------------------------------------------------------------
+| Live statistics, published in a named shared-memory segment so that a run
+| can be watched from another process (see `testfloat-stats') without
+| reading its output.  The segment holds one `liveStats_thread' slot for
+| each thread running cases, in this process or, with `-processes', in its
+| children:  the test the thread is on, the number of cases it has tested
+| and its recent rate in cases per second, the errors it has found, how far
+| it is through the cases of its current instance, and what it is doing.  A
+| slot is claimed by setting `inUse' atomically; after that every field has
+| a single writer and is stored whole, with no locking, so a reader may see
+| the fields of a slot from slightly different moments.  The counts of a
+| slot go on growing when it is released and claimed again, so their sum
+| over all slots covers the whole run.  `ended' is set when the process that
+| created the segment exits normally.
+*----------------------------------------------------------------------------*/
+enum {
+    liveStats_magic = 0x5446534C,
+    liveStats_maxThreads = 64,
+    liveStats_maxNameSize = 96
+};
+
+enum {
+    liveStats_idle,
+    liveStats_testing,
+    liveStats_generating,
+    liveStats_waiting,
+    liveStats_replaying,
+    liveStats_numStates
+};
+
+struct liveStats_thread {
+    volatile uint64_t numCases;
+    volatile uint64_t numErrors;
+    volatile uint64_t caseNum;
+    volatile uint64_t instanceNumCases;
+    volatile double casesPerSecond;
+    volatile uint32_t inUse;
+    volatile uint32_t state;
+    volatile uint32_t processId;
+    char testName[liveStats_maxNameSize];
+};
+
+struct liveStats_segment {
+    uint32_t magic;
+    uint32_t size;
+    volatile uint32_t ended;
+    struct liveStats_thread threads[liveStats_maxThreads];
+};
+
+extern const char * const liveStats_stateNames[liveStats_numStates];
+
+/*----------------------------------------------------------------------------
+| `liveStats_create' creates the segment called `name', or clears it if it
+| exists, and starts publishing to it.  `liveStats_join' publishes to an
+| existing segment without clearing it, as a `-processes' child does; the
+| child's slots are released when it exits.  Either way the calling thread
+| takes a slot.  `liveStats_attach' maps an existing segment for reading,
+| returning null if there is none.
+*----------------------------------------------------------------------------*/
+void liveStats_create( const char *name );
+void liveStats_join( const char *name );
+const struct liveStats_segment *liveStats_attach( const char *name );
+
+/*----------------------------------------------------------------------------
+| Publishing, all of which does nothing unless the segment was created or
+| joined.  `liveStats_claimSlot' returns a free slot for a worker thread,
+| named for the test set in `verCases', or -1 if all slots are taken, and
+| `liveStats_releaseSlot' frees it once the thread is joined.  A thread
+| starts publishing to a slot with `liveStats_useSlot'.
+| `liveStats_setState' sets the calling thread's state.  The test loops
+| count each case tested in `liveStats_numCases', and `liveStats_batch'
+| publishes the count (and the rate, about once a second) at the start of
+| each batch, with the number of cases generated so far in the instance,
+| `caseNum', of `instanceNumCases'.  `liveStats_endInstance' publishes the
+| count once more when the thread's test loop returns, to cover its last
+| batch.  `liveStats_errorFound' counts one error.  `liveStats_startInstance' names the calling thread's slot for the
+| test about to be finished, from `verCases'.
+*----------------------------------------------------------------------------*/
+extern bool liveStats_active;
+extern THREAD_LOCAL uint_fast64_t liveStats_numCases;
+
+int liveStats_claimSlot( void );
+void liveStats_releaseSlot( int );
+void liveStats_useSlot( int );
+void liveStats_setState( int );
+void liveStats_batch( uint_fast64_t caseNum, uint_fast64_t instanceNumCases );
+void liveStats_endInstance( void );
+void liveStats_errorFound( void );
+void liveStats_startInstance( void );
+
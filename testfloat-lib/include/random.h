@@ -37,6 +37,20 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdint.h>
 
+/*----------------------------------------------------------------------------
+| The seed is shared by all threads and should be set before any start.  Each
+| thread has its own state, naming a stream of random numbers and a position
+| in that stream; different streams are independent.  A new thread starts at
+| the beginning of stream 0.
+*----------------------------------------------------------------------------*/
+struct random_state { uint_fast64_t stream, count; };
+
+uint_fast64_t random_getSeed( void );
+void random_setSeed( uint_fast64_t );
+struct random_state random_getState( void );
+void random_setState( struct random_state );
+void random_setStream( uint_fast64_t );
+
 uint_fast8_t random_ui8( void );
 uint_fast16_t random_ui16( void );
 uint_fast32_t random_ui32( void );
@@ -76,7 +76,10 @@ All such modifications placed in the public domain by Stephen R. Orso
 # define softfloat_raiseFlags(flags) softfloat_exceptionFlags |= flags
 
 # ifndef SF_THREAD_LOCAL
-#  if __STDC_VERSION__ >= 201112 && !defined __STDC_NO_THREADS__
+#  ifdef THREAD_LOCAL
+#   define SF_THREAD_LOCAL THREAD_LOCAL
+
+#  elif __STDC_VERSION__ >= 201112 && !defined __STDC_NO_THREADS__
 #   define SF_THREAD_LOCAL _Thread_local
 
 #  elif defined _WIN32 && (          /* Windows platform and             */      \
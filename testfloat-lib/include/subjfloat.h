@@ -39,7 +39,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdint.h>
 #include "softfloat.h"
 
-extern void (*const subjfloat_functions[])();
+/*----------------------------------------------------------------------------
+| The subject functions that exist, by the names of their standard functions,
+| ending with a null name.  See "functionRegistry.h".
+*----------------------------------------------------------------------------*/
+struct subjFunctionInfo {
+    const char *namePtr;
+    void (*functionPtr)();
+};
+extern const struct subjFunctionInfo subjfloat_functions[];
 
 void subjfloat_setRoundingMode( uint_fast8_t );
 void subjfloat_setExtF80RoundingPrecision( uint_fast8_t );
@@ -0,0 +1,78 @@
+
+/*============================================================================
+
+This C header file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+/*----------------------------------------------------------------------------
+| Minimal portable child processes, used to run tests apart from the process
+| that reports on them, so that a crash in the functions being tested ends
+| only the child.  `subprocess_start' runs the program `argv[0]' with the
+| null-terminated argument list `argv', sending the child's standard output
+| and standard error to the files `outFile' and `errFile'.  The handle it
+| returns must be passed to `subprocess_wait' once.
+|   `subprocess_wait' waits until any one of the `numSubprocesses' (at most
+| `subprocess_maxWait') processes in `subprocesses' has ended, and returns
+| its index.  The process's exit status is stored at `statusPtr', except that
+| if the process was ended by a signal or an exception, `*crashedPtr' is set
+| true and the signal number or exception code is stored instead.
+*----------------------------------------------------------------------------*/
+struct subprocess;
+
+enum { subprocess_maxWait = 64 };
+
+struct subprocess *
+ subprocess_start( const char * const argv[], FILE *outFile, FILE *errFile );
+int
+ subprocess_wait(
+     struct subprocess * const subprocesses[],
+     int numSubprocesses,
+     int *statusPtr,
+     bool *crashedPtr
+ );
+
+/*----------------------------------------------------------------------------
+| Makes the calling process a fork server:  it reads requests, one per line,
+| from `requestFile', and for each forks a child that returns from this
+| function with the request split at white space into at most `maxArgs'
+| words at `args', returning the number of words.  The server meanwhile
+| waits for the child and writes `exit <status>' or `crash <signal>' as a
+| line to `statusFile'.  At the end of the requests the server returns -1.
+| Only the first forked child returns from each request, so start-up done
+| before the call is paid once.  Not available on Windows.
+*----------------------------------------------------------------------------*/
+int
+ subprocess_forkServer(
+     FILE *requestFile, FILE *statusFile, char *args[], int maxArgs );
+
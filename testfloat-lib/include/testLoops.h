@@ -41,9 +41,328 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "softfloat.h"
 
 extern bool testLoops_forever;
+extern int testLoops_numThreads;
 
-extern uint_fast8_t *testLoops_trueFlagsPtr;
+extern THREAD_LOCAL uint_fast8_t *testLoops_trueFlagsPtr;
 extern uint_fast8_t (*testLoops_subjFlagsFunction)( void );
+extern void (*testLoops_subjRoundingModeFunction)( uint_fast8_t );
+
+/*----------------------------------------------------------------------------
+| The test loops work on batches of up to `testLoops_batchSize' cases:  all of
+| a batch's operands are generated first, then the true function is applied
+| to the whole batch, then the subject function, and finally the results are
+| checked in order.  Keeping each pass to a single function makes the inner
+| loops tight; the outcome and output are the same as checking each case as
+| it is generated.
+*----------------------------------------------------------------------------*/
+enum { testLoops_batchSize = 256 };
+
+/*----------------------------------------------------------------------------
+| A test loop is run by a function of the form `function( argPtr )', which
+| must establish whatever rounding mode and other settings the loop needs.
+| Several such loops (instances) may be in progress at once:  after a call to
+| `testLoops_startInstances' giving their number, each is handed to
+| `testLoops_startInstance', and then `testLoops_finishInstance' is called
+| once per instance, in the same order, to produce that instance's output on
+| the calling thread.
+|   With more than one thread (`testLoops_numThreads'), each started instance
+| runs on its share of the threads, each of which generates only its own part
+| of the instance's cases (see `genCases_setPart') and only notes which cases
+| fail; `testLoops_finishInstance' then waits for the instance and calls
+| `function' once more to evaluate just those cases, so the output is the
+| same as for a serial run.  Workers start with the random-number state and
+| SoftFloat modes the calling thread had when the instance was started.
+|   Within a loop, `testLoops_skipCase' is called once for every generated
+| case and returns true if the case is not to be evaluated, and
+| `testLoops_errorFound' is called for every error, with the same count as
+| `verCases_writeErrorFound' takes, and returns true if the case should be
+| written.
+*----------------------------------------------------------------------------*/
+void testLoops_startInstances( int );
+void testLoops_startInstance( void function( void * ), void *argPtr );
+void testLoops_finishInstance( void );
+bool testLoops_skipCase( void );
+bool testLoops_errorFound( int );
+
+/*----------------------------------------------------------------------------
+| `testLoops_keepErrorCase' is the part of `testLoops_errorFound' that does
+| not write anything:  given the zero-based number of a failing case, it
+| returns false if the case has only been noted for a later replay (on a
+| worker thread), or true if the caller should report the error itself.
+| While a failure map is kept (see `failMap.h'), the case is also added to
+| the map, and false is returned once the instance has had more errors than
+| are to be written.
+|   When a worker thread's errors are replayed, the cases between them are
+| passed over by seeking the case generators.  A loop that can allow this
+| calls `testLoops_selectBatch' (done by `testLoops_startBatch') at the start
+| of each batch of cases, while its count of ten-thousands is still right
+| for every case it has generated.
+*----------------------------------------------------------------------------*/
+bool testLoops_keepErrorCase( uint_fast64_t );
+void testLoops_selectBatch( void );
+
+/*----------------------------------------------------------------------------
+| While `testLoops_deadline' is nonzero, a loop that starts a batch (see
+| `testLoops_selectBatch') once `thread_seconds' has reached that time ends
+| with the batch's first case, so that it stops within a batch of the
+| deadline; the replay of a worker thread's errors is never cut short.  Each
+| finished instance adds the number of cases its loop generated to
+| `testLoops_numCasesRun'.
+*----------------------------------------------------------------------------*/
+extern double testLoops_deadline;
+extern uint_fast64_t testLoops_numCasesRun;
+
+/*----------------------------------------------------------------------------
+| Checkpoints, for serial testing only.  While `testLoops_checkpointPath' is
+| set, the (unfused) test loops save to that file, at most once every
+| `testLoops_checkpointSeconds' seconds, everything needed to go on from the
+| next case:  how many instances were finished before, the state of the case
+| generators and of the random-number generator, the test and error counts,
+| and `testLoops_anyEarlierErrors', which the program sets to whether any
+| test finished before the current function's found errors.  Checkpoints are
+| taken only at a batch that starts on a multiple of 10000 cases, where the
+| loops' own counts need nothing more.
+|   `testLoops_resume' reads the checkpoint at `testLoops_checkpointPath'.
+| If the same instances are then run in the same order, those finished
+| before the checkpoint are skipped, and the one it was taken in continues
+| from its next case, with `testLoops_anyEarlierErrors' set again from the
+| checkpoint.  Anything written after the checkpoint was taken is written
+| again.  `testLoops_skippingInstance' returns true if the next instance to
+| be finished is to be skipped.
+|   Each loop calls `testLoops_startBatch' before generating a batch of cases.
+| `testLoops_caseNum' and `testLoops_setCaseNum' get and set the number of
+| cases the current loop has generated.
+*----------------------------------------------------------------------------*/
+extern const char *testLoops_checkpointPath;
+extern double testLoops_checkpointSeconds;
+extern bool testLoops_anyEarlierErrors;
+void testLoops_resume( void );
+bool testLoops_skippingInstance( void );
+void testLoops_startBatch( void );
+void testLoops_instanceDone( void );
+uint_fast64_t testLoops_caseNum( void );
+void testLoops_setCaseNum( uint_fast64_t );
+
+/*----------------------------------------------------------------------------
+| Hang watchdog.  After `testLoops_startWatchdog', a watchdog thread checks
+| every watched thread about four times per `testLoops_hangSeconds'.  A
+| thread whose subject function has not returned for that long is reported,
+| with the operands of the hung case (generated again from its number on the
+| watchdog thread), and the whole process then exits with
+| status `testLoops_hangExitStatus', as a hung thread cannot be stopped
+| otherwise.  The subject function is recognized by the calls to
+| `testLoops_subjFlagsFunction' around it, so that must be set first.
+| Threads are watched only in the unfused loops.
+|   `testLoops_startWatch' returns a watch for an instance about to run from
+| the given random-number state (or null if there is no watchdog), which a
+| thread then takes up with `testLoops_setWatch'; `testLoops_endWatch' gives
+| it back.  `testLoops_startBatch' calls `testLoops_watchBatch', which
+| returns false when nothing but the generation of cases is wanted, and
+| `testLoops_watchResumed' once the instance's state is read from a
+| checkpoint (it can then not be generated again).  `testLoops_skipCase'
+| passes each case's number and its own result through
+| `testLoops_watchCase'.
+*----------------------------------------------------------------------------*/
+extern double testLoops_hangSeconds;
+enum { testLoops_hangExitStatus = 3 };
+struct testLoops_watch;
+struct random_state;
+void testLoops_startWatchdog( void );
+struct testLoops_watch *
+ testLoops_startWatch(
+     void function( void * ),
+     void *argPtr,
+     const struct random_state *randomStatePtr
+ );
+void testLoops_setWatch( struct testLoops_watch * );
+void testLoops_endWatch( struct testLoops_watch * );
+bool testLoops_watchBatch( void );
+void testLoops_watchResumed( void );
+bool testLoops_watchCase( uint_fast64_t, bool );
+
+/*----------------------------------------------------------------------------
+| Fused loops test several functions of the same form in one pass over a
+| single stream of operands.  Each function is described by a
+| `testLoops_fusedInfo':  its name; the rounding mode to establish before it
+| is run, with `roundingCode' zero to leave the current rounding mode as is;
+| whether that rounding mode is fixed by the function (in which case only
+| SoftFloat's rounding mode is changed, and the mode is not written after the
+| function's name); and, for functions taking a rounding mode argument,
+| `exact'.  The same function may appear several times with different
+| rounding modes, so that all modes are checked for each operand.
+|   Each function's errors are kept (as records of `errorCaseSize' bytes) and
+| reported separately once the pass is complete, in the same format as the
+| individual loops would use.
+|   `testLoops_setFusedRounding' establishes a function's rounding mode and
+| returns the rounding mode to pass to functions taking one.  Subject
+| functions never take a rounding mode argument in fused loops; they round
+| as their names say or as the subject's rounding mode was last set by
+| `testLoops_subjRoundingModeFunction'.
+| `testLoops_fusedErrorFound' is called with the one-based number of the
+| failing test and returns where to store the error's record, or null if no
+| record is wanted; once a function reaches `verCases_maxErrorCount' errors,
+| its `done' becomes true.  `testLoops_finishFused' writes the reports for
+| all functions given the number of tests performed, using `writeErrorCase'
+| for each stored record, and frees the array.
+*----------------------------------------------------------------------------*/
+struct testLoops_fusedInfo {
+    const char *namePtr;
+    int roundingCode;
+    uint_fast8_t roundingMode;
+    bool fixedRounding;
+    bool exact;
+};
+
+struct testLoops_fused {
+    struct testLoops_fusedInfo info;
+    bool done;
+    uint_fast32_t errorCount;
+    uint_fast64_t numTests;
+    size_t errorCaseSize, numErrorCases, maxErrorCases;
+    void *errorCases;
+};
+
+struct testLoops_fused *
+ testLoops_startFused(
+     int, const struct testLoops_fusedInfo [], size_t errorCaseSize );
+uint_fast8_t testLoops_setFusedRounding( const struct testLoops_fused * );
+void *testLoops_fusedErrorFound( struct testLoops_fused *, uint_fast64_t );
+void
+ testLoops_finishFused(
+     struct testLoops_fused *,
+     int,
+     uint_fast64_t,
+     void writeErrorCase( const void * )
+ );
+
+void
+ test_abz_f32_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     float32_t ( * const [] )( float32_t, float32_t ),
+     float32_t ( * const [] )( float32_t, float32_t )
+ );
+void
+ test_ab_f32_z_bool_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     bool ( * const [] )( float32_t, float32_t ),
+     bool ( * const [] )( float32_t, float32_t )
+ );
+void
+ test_az_f32_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     float32_t ( * const [] )( float32_t ),
+     float32_t ( * const [] )( float32_t )
+ );
+void
+ test_abcz_f32_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     float32_t ( * const [] )( float32_t, float32_t, float32_t ),
+     float32_t ( * const [] )( float32_t, float32_t, float32_t )
+ );
+void
+ test_az_f32_rx_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     float32_t ( * const [] )( float32_t, uint_fast8_t, bool ),
+     float32_t ( * const [] )( float32_t )
+ );
+void
+ test_a_f32_z_ui32_rx_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     uint_fast32_t ( * const [] )( float32_t, uint_fast8_t, bool ),
+     uint_fast32_t ( * const [] )( float32_t )
+ );
+void
+ test_a_f32_z_ui64_rx_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     uint_fast64_t ( * const [] )( float32_t, uint_fast8_t, bool ),
+     uint_fast64_t ( * const [] )( float32_t )
+ );
+void
+ test_a_f32_z_i32_rx_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     int_fast32_t ( * const [] )( float32_t, uint_fast8_t, bool ),
+     int_fast32_t ( * const [] )( float32_t )
+ );
+void
+ test_a_f32_z_i64_rx_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     int_fast64_t ( * const [] )( float32_t, uint_fast8_t, bool ),
+     int_fast64_t ( * const [] )( float32_t )
+ );
+#ifdef FLOAT64
+void
+ test_abz_f64_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     float64_t ( * const [] )( float64_t, float64_t ),
+     float64_t ( * const [] )( float64_t, float64_t )
+ );
+void
+ test_ab_f64_z_bool_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     bool ( * const [] )( float64_t, float64_t ),
+     bool ( * const [] )( float64_t, float64_t )
+ );
+void
+ test_az_f64_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     float64_t ( * const [] )( float64_t ),
+     float64_t ( * const [] )( float64_t )
+ );
+void
+ test_abcz_f64_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     float64_t ( * const [] )( float64_t, float64_t, float64_t ),
+     float64_t ( * const [] )( float64_t, float64_t, float64_t )
+ );
+void
+ test_az_f64_rx_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     float64_t ( * const [] )( float64_t, uint_fast8_t, bool ),
+     float64_t ( * const [] )( float64_t )
+ );
+void
+ test_a_f64_z_ui32_rx_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     uint_fast32_t ( * const [] )( float64_t, uint_fast8_t, bool ),
+     uint_fast32_t ( * const [] )( float64_t )
+ );
+void
+ test_a_f64_z_ui64_rx_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     uint_fast64_t ( * const [] )( float64_t, uint_fast8_t, bool ),
+     uint_fast64_t ( * const [] )( float64_t )
+ );
+void
+ test_a_f64_z_i32_rx_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     int_fast32_t ( * const [] )( float64_t, uint_fast8_t, bool ),
+     int_fast32_t ( * const [] )( float64_t )
+ );
+void
+ test_a_f64_z_i64_rx_fused(
+     int,
+     const struct testLoops_fusedInfo [],
+     int_fast64_t ( * const [] )( float64_t, uint_fast8_t, bool ),
+     int_fast64_t ( * const [] )( float64_t )
+ );
+#endif
 
 /*----------------------------------------------------------------------------
 *----------------------------------------------------------------------------*/
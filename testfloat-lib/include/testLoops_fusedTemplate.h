@@ -0,0 +1,356 @@
+
+/*============================================================================
+
+This C header file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+/*----------------------------------------------------------------------------
+| A template for the fused test loops (see `testLoops_fusedInfo' in
+| "testLoops.h"), which test several functions of the same form in one pass
+| over a single stream of operands.
+|   Before including this file, define `testLoop_fusedFunction' as the name
+| of the loop, such as `test_abz_f32_fused'.  Define `testLoop_a' as the
+| format of the operands (f32 or f64), `testLoop_numOperands' as the number
+| of operands (1, 2 or 3), and `testLoop_z' as the format of the result
+| (f32, f64, boolean, ui32, ui64, i32 or i64).  Define `testLoop_rx' if the
+| true functions also take a rounding mode and `exact', and
+| `testLoop_longCase' if failing cases are written over two lines, as for
+| "testLoops_template.h".  Integer results are checked as the `test_*'
+| functions for conversions to integers check them.  The `testLoop_*' macros
+| are undefined again at the end of the file.
+*----------------------------------------------------------------------------*/
+
+#include "testLoops_template.h"
+
+#ifndef testLoops_fusedTemplate_h
+#define testLoops_fusedTemplate_h 1
+
+#define testLoops_resultType_f32     float32_t
+#define testLoops_resultType_f64     float64_t
+#define testLoops_resultType_boolean bool
+#define testLoops_resultType_ui32    uint_fast32_t
+#define testLoops_resultType_ui64    uint_fast64_t
+#define testLoops_resultType_i32     int_fast32_t
+#define testLoops_resultType_i64     int_fast64_t
+
+#define testLoops_isInt_f32     0
+#define testLoops_isInt_f64     0
+#define testLoops_isInt_boolean 0
+#define testLoops_isInt_ui32    1
+#define testLoops_isInt_ui64    1
+#define testLoops_isInt_i32     1
+#define testLoops_isInt_i64     1
+
+/*----------------------------------------------------------------------------
+| The results given for an invalid conversion to each integer format.
+*----------------------------------------------------------------------------*/
+#define testLoops_maxZ_ui32 0xFFFFFFFF
+#define testLoops_minZ_ui32 0
+#define testLoops_maxZ_ui64 UINT64_C( 0xFFFFFFFFFFFFFFFF )
+#define testLoops_minZ_ui64 0
+#define testLoops_maxZ_i32  0x7FFFFFFF
+#define testLoops_minZ_i32  (-0x7FFFFFFF - 1)
+#define testLoops_maxZ_i64  INT64_C( 0x7FFFFFFFFFFFFFFF )
+#define testLoops_minZ_i64  (-INT64_C( 0x7FFFFFFFFFFFFFFF ) - 1)
+
+#endif
+
+#define testLoop_typeA testLoops_paste( testLoops_type_, testLoop_a )
+#define testLoop_typeZ testLoops_paste( testLoops_resultType_, testLoop_z )
+#define testLoop_genCases( part )\
+    testLoops_paste3(\
+        genCases_,\
+        testLoop_a,\
+        testLoops_paste(\
+            testLoops_paste( testLoops_genCasesForm, testLoop_numOperands ),\
+            part\
+        )\
+    )
+#define testLoop_genCasesOperand( operand )\
+    testLoops_paste3( genCases_, testLoop_a, operand )
+#define testLoop_isNaN testLoops_paste( testLoop_a, _isNaN )
+#define testLoop_isSignalingNaN testLoops_paste( testLoop_a, _isSignalingNaN )
+#if testLoops_paste( testLoops_isFloat_, testLoop_z )
+#define testLoop_sameZ testLoops_paste( testLoop_z, _same )
+#define testLoop_isNaNZ testLoops_paste( testLoop_z, _isNaN )
+#define testLoop_isSignalingNaNZ testLoops_paste( testLoop_z, _isSignalingNaN )
+#elif testLoops_paste( testLoops_isInt_, testLoop_z )
+#define testLoop_maxZ testLoops_paste( testLoops_maxZ_, testLoop_z )
+#define testLoop_minZ testLoops_paste( testLoops_minZ_, testLoop_z )
+#endif
+#define testLoop_write\
+    testLoops_paste3(\
+        testLoops_write,\
+        testLoop_numOperands,\
+        testLoops_paste( _, testLoop_a )\
+    )
+#ifdef testLoop_longCase
+#define testLoop_separator "\n\t"
+#else
+#define testLoop_separator "  "
+#endif
+#if testLoop_numOperands == 1
+#define testLoop_params testLoop_typeA
+#define testLoop_call( function ) function( a[i] )
+#define testLoop_anySignalingNaN() testLoop_isSignalingNaN( a[i] )
+#define testLoop_writeOperands( ptr )\
+    testLoop_write( ptr->a, 0, 0, testLoop_separator )
+#elif testLoop_numOperands == 2
+#define testLoop_params testLoop_typeA, testLoop_typeA
+#define testLoop_call( function ) function( a[i], b[i] )
+#define testLoop_anySignalingNaN()\
+    (testLoop_isSignalingNaN( a[i] ) || testLoop_isSignalingNaN( b[i] ))
+#define testLoop_writeOperands( ptr )\
+    testLoop_write( ptr->a, ptr->b, 0, testLoop_separator )
+#else
+#define testLoop_params testLoop_typeA, testLoop_typeA, testLoop_typeA
+#define testLoop_call( function ) function( a[i], b[i], c[i] )
+#define testLoop_anySignalingNaN()\
+    (   testLoop_isSignalingNaN( a[i] )\
+     || testLoop_isSignalingNaN( b[i] )\
+     || testLoop_isSignalingNaN( c[i] ))
+#define testLoop_writeOperands( ptr )\
+    testLoop_write( ptr->a, ptr->b, ptr->c, testLoop_separator )
+#endif
+#ifdef testLoop_rx
+#define testLoop_trueParams testLoop_typeA, uint_fast8_t, bool
+#define testLoop_callTrue( function ) function( a[i], roundingMode, exact )
+#else
+#define testLoop_trueParams testLoop_params
+#define testLoop_callTrue( function ) testLoop_call( function )
+#endif
+
+#pragma STDC FENV_ACCESS ON
+
+struct errorCase {
+    testLoop_typeA a;
+#if 2 <= testLoop_numOperands
+    testLoop_typeA b;
+#endif
+#if 3 <= testLoop_numOperands
+    testLoop_typeA c;
+#endif
+    testLoop_typeZ trueZ;
+    uint_fast8_t trueFlags;
+    testLoop_typeZ subjZ;
+    uint_fast8_t subjFlags;
+};
+
+static void writeErrorCase( const void *errorCasePtr )
+{
+    const struct errorCase *ptr = errorCasePtr;
+
+    testLoop_writeOperands( ptr );
+    testLoops_paste( testLoops_writeZ_, testLoop_z )(
+        ptr->trueZ, ptr->trueFlags, ptr->subjZ, ptr->subjFlags );
+
+}
+
+void
+ testLoop_fusedFunction(
+     int numFunctions,
+     const struct testLoops_fusedInfo infos[],
+     testLoop_typeZ ( * const trueFunctions[] )( testLoop_trueParams ),
+     testLoop_typeZ ( * const subjFunctions[] )( testLoop_params )
+ )
+{
+    struct testLoops_fused *functions;
+    bool quiet;
+    int numActive, numCases, i, j;
+    uint_fast64_t numTests;
+    testLoop_typeA a[testLoops_batchSize];
+#if 2 <= testLoop_numOperands
+    testLoop_typeA b[testLoops_batchSize];
+#endif
+#if 3 <= testLoop_numOperands
+    testLoop_typeA c[testLoops_batchSize];
+#endif
+    bool skip[testLoops_batchSize];
+#ifdef testLoop_rx
+    uint_fast8_t roundingMode;
+    bool exact;
+#endif
+    testLoop_typeZ ( *trueFunction )( testLoop_trueParams );
+    testLoop_typeZ ( *subjFunction )( testLoop_params );
+    testLoop_typeZ trueZ[testLoops_batchSize];
+    uint_fast8_t trueFlags[testLoops_batchSize];
+    testLoop_typeZ subjZ[testLoops_batchSize];
+    uint_fast8_t subjFlags[testLoops_batchSize];
+    struct errorCase *errorCasePtr;
+
+    functions =
+        testLoops_startFused(
+            numFunctions, infos, sizeof (struct errorCase) );
+    quiet = verCases_quiet;
+    verCases_quiet = true;
+    numActive = numFunctions;
+    numTests = 0;
+    testLoop_genCases( _init )();
+    while ( ! genCases_done ) {
+        if ( verCases_stop ) verCases_exitWithStatus();
+        liveStats_batch( testLoops_caseNum(), genCases_total );
+        numCases = 0;
+        do {
+            testLoop_genCases( _next )();
+            a[numCases] = testLoop_genCasesOperand( _a );
+#if 2 <= testLoop_numOperands
+            b[numCases] = testLoop_genCasesOperand( _b );
+#endif
+#if 3 <= testLoop_numOperands
+            c[numCases] = testLoop_genCasesOperand( _c );
+#endif
+            skip[numCases] = testLoops_skipCase();
+            ++numCases;
+        } while ( (numCases < testLoops_batchSize) && ! genCases_done );
+        for ( j = 0; j < numFunctions; ++j ) {
+            if ( functions[j].done ) continue;
+#ifdef testLoop_rx
+            roundingMode = testLoops_setFusedRounding( &functions[j] );
+            exact = functions[j].info.exact;
+#else
+            testLoops_setFusedRounding( &functions[j] );
+#endif
+            trueFunction = trueFunctions[j];
+            subjFunction = subjFunctions[j];
+            for ( i = 0; i < numCases; ++i ) {
+                if ( skip[i] ) continue;
+                *testLoops_trueFlagsPtr = 0;
+                trueZ[i] = testLoop_callTrue( trueFunction );
+                trueFlags[i] = *testLoops_trueFlagsPtr;
+            }
+            for ( i = 0; i < numCases; ++i ) {
+                if ( skip[i] ) continue;
+                testLoops_subjFlagsFunction();
+                subjZ[i] = testLoop_call( subjFunction );
+                subjFlags[i] = testLoops_subjFlagsFunction();
+            }
+            for ( i = 0; i < numCases; ++i ) {
+                if ( skip[i] ) continue;
+#if testLoops_paste( testLoops_isFloat_, testLoop_z )
+                if (
+                    ! testLoop_sameZ( trueZ[i], subjZ[i] )
+                        || (trueFlags[i] != subjFlags[i])
+                ) {
+#else
+                if (
+                    (trueZ[i] != subjZ[i]) || (trueFlags[i] != subjFlags[i])
+                ) {
+#endif
+#if ! testLoops_paste( testLoops_isInt_, testLoop_z )
+                    if ( ! verCases_checkNaNs && testLoop_anySignalingNaN() ) {
+                        trueFlags[i] |= softfloat_flag_invalid;
+                    }
+#endif
+#if testLoops_paste( testLoops_isFloat_, testLoop_z )
+                    if (
+                           verCases_checkNaNs
+                        || ! testLoop_isNaNZ( trueZ[i] )
+                        || ! testLoop_isNaNZ( subjZ[i] )
+                        || testLoop_isSignalingNaNZ( subjZ[i] )
+                        || (trueFlags[i] != subjFlags[i])
+                    ) {
+#elif testLoops_paste( testLoops_isInt_, testLoop_z )
+                    if (
+                           verCases_checkInvInts
+                        || (trueFlags[i] != softfloat_flag_invalid)
+                        || (subjFlags[i] != softfloat_flag_invalid)
+                        || ((subjZ[i] != testLoop_maxZ)
+                                && (subjZ[i] != testLoop_minZ)
+                                && (! testLoop_isNaN( a[i] )
+                                        || (subjZ[i] != 0)))
+                    ) {
+#else
+                    if (
+                        (trueZ[i] != subjZ[i])
+                            || (trueFlags[i] != subjFlags[i])
+                    ) {
+#endif
+                        errorCasePtr =
+                            testLoops_fusedErrorFound(
+                                &functions[j], numTests + i + 1 );
+                        if ( errorCasePtr ) {
+                            errorCasePtr->a = a[i];
+#if 2 <= testLoop_numOperands
+                            errorCasePtr->b = b[i];
+#endif
+#if 3 <= testLoop_numOperands
+                            errorCasePtr->c = c[i];
+#endif
+                            errorCasePtr->trueZ = trueZ[i];
+                            errorCasePtr->trueFlags = trueFlags[i];
+                            errorCasePtr->subjZ = subjZ[i];
+                            errorCasePtr->subjFlags = subjFlags[i];
+                        }
+                        if ( functions[j].done ) {
+                            --numActive;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+        numTests += numCases;
+        if ( ! numActive ) break;
+    }
+    verCases_quiet = quiet;
+    testLoops_finishFused( functions, numFunctions, numTests, writeErrorCase );
+
+}
+
+#undef testLoop_typeA
+#undef testLoop_typeZ
+#undef testLoop_genCases
+#undef testLoop_genCasesOperand
+#undef testLoop_isNaN
+#undef testLoop_isSignalingNaN
+#undef testLoop_sameZ
+#undef testLoop_isNaNZ
+#undef testLoop_isSignalingNaNZ
+#undef testLoop_maxZ
+#undef testLoop_minZ
+#undef testLoop_write
+#undef testLoop_separator
+#undef testLoop_params
+#undef testLoop_call
+#undef testLoop_anySignalingNaN
+#undef testLoop_writeOperands
+#undef testLoop_trueParams
+#undef testLoop_callTrue
+#undef testLoop_fusedFunction
+#undef testLoop_a
+#undef testLoop_numOperands
+#undef testLoop_z
+#undef testLoop_rx
+#undef testLoop_longCase
+
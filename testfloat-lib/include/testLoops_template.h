@@ -0,0 +1,282 @@
+
+/*============================================================================
+
+This C header file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+/*----------------------------------------------------------------------------
+| A template for a test loop specialized to one pair of true and subject
+| functions.  Where the `test_*' functions are given their true and subject
+| functions as pointers, the loop made from this template calls them
+| directly, so they can be inlined, and tests on constant settings fold
+| away.  The loop is otherwise the same as its `test_*' counterpart, and
+| writes the same reports.
+|   Before each inclusion, define `testLoop_function' as the name of the
+| function tested, such as `f32_add'.  The loop is made a static function
+| named `test_' followed by that name, testing the true function of that
+| name against the subject function of the name with `subj_' in front.
+| Define `testLoop_a' as the format of the operands (ui32, ui64, i32, i64,
+| f32 or f64), `testLoop_numOperands' as the number of operands (1, 2 or 3),
+| and `testLoop_z' as the format of the result (f32, f64 or boolean).  A loop
+| with a single 64-bit operand and a 64-bit result, or two f64 operands and
+| an f64 result, must also define `testLoop_longCase', to write its failing
+| cases over two lines as the `test_*' functions do.  The including file
+| must itself define `testLoops_checkNaNs' once, as either
+| `verCases_checkNaNs' or a constant.  The `testLoop_*' macros are undefined
+| again at the end of each inclusion.
+|   Included with no `testLoop_function' defined, this file only defines the
+| `testLoops_*' macros it shares with "testLoops_fusedTemplate.h".
+*----------------------------------------------------------------------------*/
+
+#ifndef testLoops_template_h
+#define testLoops_template_h 1
+
+#define testLoops_paste( a, b ) testLoops_paste2( a, b )
+#define testLoops_paste2( a, b ) a ## b
+#define testLoops_paste3( a, b, c ) testLoops_paste4( a, b, c )
+#define testLoops_paste4( a, b, c ) a ## b ## c
+
+#define testLoops_type_ui32 uint32_t
+#define testLoops_type_ui64 uint64_t
+#define testLoops_type_i32  int32_t
+#define testLoops_type_i64  int64_t
+#define testLoops_type_f32  float32_t
+#define testLoops_type_f64  float64_t
+#define testLoops_type_boolean bool
+
+#define testLoops_isFloat_ui32 0
+#define testLoops_isFloat_ui64 0
+#define testLoops_isFloat_i32  0
+#define testLoops_isFloat_i64  0
+#define testLoops_isFloat_f32  1
+#define testLoops_isFloat_f64  1
+#define testLoops_isFloat_boolean 0
+
+#define testLoops_genCasesForm1 _a
+#define testLoops_genCasesForm2 _ab
+#define testLoops_genCasesForm3 _abc
+
+/*----------------------------------------------------------------------------
+| The `writeCase' functions for operands differ in whether they take a
+| separator.  These give them all the same arguments.
+*----------------------------------------------------------------------------*/
+#define testLoops_write1_ui32( a, b, c, sep ) writeCase_a_ui32( a, sep )
+#define testLoops_write1_ui64( a, b, c, sep ) writeCase_a_ui64( a, sep )
+#define testLoops_write1_i32( a, b, c, sep )  writeCase_a_i32( a, sep )
+#define testLoops_write1_i64( a, b, c, sep )  writeCase_a_i64( a, sep )
+#define testLoops_write1_f32( a, b, c, sep )  writeCase_a_f32( a, sep )
+#define testLoops_write1_f64( a, b, c, sep )  writeCase_a_f64( a, sep )
+#define testLoops_write2_f32( a, b, c, sep )  writeCase_ab_f32( a, b )
+#define testLoops_write2_f64( a, b, c, sep )  writeCase_ab_f64( a, b, sep )
+#define testLoops_write3_f32( a, b, c, sep )  writeCase_abc_f32( a, b, c )
+#define testLoops_write3_f64( a, b, c, sep )  writeCase_abc_f64( a, b, c )
+#define testLoops_writeZ_f32     writeCase_z_f32
+#define testLoops_writeZ_f64     writeCase_z_f64
+#define testLoops_writeZ_boolean writeCase_z_bool
+#define testLoops_writeZ_ui32    writeCase_z_ui32
+#define testLoops_writeZ_ui64    writeCase_z_ui64
+#define testLoops_writeZ_i32     writeCase_z_i32
+#define testLoops_writeZ_i64     writeCase_z_i64
+
+#endif
+
+#ifdef testLoop_function
+
+
+#define testLoop_typeA testLoops_paste( testLoops_type_, testLoop_a )
+#define testLoop_typeZ testLoops_paste( testLoops_type_, testLoop_z )
+#define testLoop_genCases( part )\
+    testLoops_paste3(\
+        genCases_,\
+        testLoop_a,\
+        testLoops_paste(\
+            testLoops_paste( testLoops_genCasesForm, testLoop_numOperands ),\
+            part\
+        )\
+    )
+#define testLoop_genCasesOperand( operand )\
+    testLoops_paste3( genCases_, testLoop_a, operand )
+#define testLoop_isSignalingNaN testLoops_paste( testLoop_a, _isSignalingNaN )
+#define testLoop_write\
+    testLoops_paste3(\
+        testLoops_write,\
+        testLoop_numOperands,\
+        testLoops_paste( _, testLoop_a )\
+    )
+#ifdef testLoop_longCase
+#define testLoop_separator "\n\t"
+#else
+#define testLoop_separator "  "
+#endif
+#if testLoop_numOperands == 1
+#define testLoop_call( function ) function( a[i] )
+#define testLoop_anySignalingNaN() testLoop_isSignalingNaN( a[i] )
+#define testLoop_writeOperands()\
+    testLoop_write( a[i], 0, 0, testLoop_separator )
+#elif testLoop_numOperands == 2
+#define testLoop_call( function ) function( a[i], b[i] )
+#define testLoop_anySignalingNaN()\
+    (testLoop_isSignalingNaN( a[i] ) || testLoop_isSignalingNaN( b[i] ))
+#define testLoop_writeOperands()\
+    testLoop_write( a[i], b[i], 0, testLoop_separator )
+#else
+#define testLoop_call( function ) function( a[i], b[i], c[i] )
+#define testLoop_anySignalingNaN()\
+    (   testLoop_isSignalingNaN( a[i] )\
+     || testLoop_isSignalingNaN( b[i] )\
+     || testLoop_isSignalingNaN( c[i] ))
+#define testLoop_writeOperands()\
+    testLoop_write( a[i], b[i], c[i], testLoop_separator )
+#endif
+
+static void testLoops_paste( test_, testLoop_function )( void )
+{
+    int count, numCases, i;
+    testLoop_typeA a[testLoops_batchSize];
+#if 2 <= testLoop_numOperands
+    testLoop_typeA b[testLoops_batchSize];
+#endif
+#if 3 <= testLoop_numOperands
+    testLoop_typeA c[testLoops_batchSize];
+#endif
+    bool skip[testLoops_batchSize];
+    testLoop_typeZ trueZ[testLoops_batchSize];
+    uint_fast8_t trueFlags[testLoops_batchSize];
+    testLoop_typeZ subjZ[testLoops_batchSize];
+    uint_fast8_t subjFlags[testLoops_batchSize];
+
+    testLoop_genCases( _init )();
+    genCases_writeTestsTotal( testLoops_forever );
+    verCases_errorCount = 0;
+    verCases_tenThousandsCount = 0;
+    count = 10000;
+    while ( ! genCases_done || testLoops_forever ) {
+        testLoops_startBatch();
+        numCases = 0;
+        do {
+            testLoop_genCases( _next )();
+            a[numCases] = testLoop_genCasesOperand( _a );
+#if 2 <= testLoop_numOperands
+            b[numCases] = testLoop_genCasesOperand( _b );
+#endif
+#if 3 <= testLoop_numOperands
+            c[numCases] = testLoop_genCasesOperand( _c );
+#endif
+            skip[numCases] = testLoops_skipCase();
+            ++numCases;
+        } while (
+            (numCases < testLoops_batchSize)
+                && (! genCases_done || testLoops_forever)
+        );
+        for ( i = 0; i < numCases; ++i ) {
+            if ( skip[i] ) continue;
+            *testLoops_trueFlagsPtr = 0;
+            trueZ[i] = testLoop_call( testLoop_function );
+            trueFlags[i] = *testLoops_trueFlagsPtr;
+        }
+        for ( i = 0; i < numCases; ++i ) {
+            if ( skip[i] ) continue;
+            testLoops_subjFlagsFunction();
+            subjZ[i] =
+                testLoop_call( testLoops_paste( subj_, testLoop_function ) );
+            subjFlags[i] = testLoops_subjFlagsFunction();
+        }
+        for ( i = 0; i < numCases; ++i ) {
+            --count;
+            if ( ! count ) {
+                verCases_perTenThousand();
+                count = 10000;
+            }
+            if ( skip[i] ) continue;
+#if testLoops_paste( testLoops_isFloat_, testLoop_z )
+            if (
+                ! testLoops_paste( testLoop_z, _same )( trueZ[i], subjZ[i] )
+                    || (trueFlags[i] != subjFlags[i])
+            ) {
+#else
+            if ( (trueZ[i] != subjZ[i]) || (trueFlags[i] != subjFlags[i]) ) {
+#endif
+#if testLoops_paste( testLoops_isFloat_, testLoop_a )
+                if ( ! testLoops_checkNaNs && testLoop_anySignalingNaN() ) {
+                    trueFlags[i] |= softfloat_flag_invalid;
+                }
+#endif
+#if testLoops_paste( testLoops_isFloat_, testLoop_z )
+                if (
+                       testLoops_checkNaNs
+                    || ! testLoops_paste( testLoop_z, _isNaN )( trueZ[i] )
+                    || ! testLoops_paste( testLoop_z, _isNaN )( subjZ[i] )
+                    || testLoops_paste( testLoop_z, _isSignalingNaN )(
+                           subjZ[i] )
+                    || (trueFlags[i] != subjFlags[i])
+                ) {
+#else
+                if (
+                    (trueZ[i] != subjZ[i])
+                        || (trueFlags[i] != subjFlags[i])
+                ) {
+#endif
+                    ++verCases_errorCount;
+                    if ( testLoops_errorFound( 10000 - count ) ) {
+                        testLoop_writeOperands();
+                        testLoops_paste( testLoops_writeZ_, testLoop_z )(
+                            trueZ[i], trueFlags[i], subjZ[i], subjFlags[i] );
+                    }
+                    if ( verCases_errorCount == verCases_maxErrorCount ) break;
+                }
+            }
+        }
+        if ( i < numCases ) break;
+    }
+    verCases_writeTestsPerformed( 10000 - count );
+
+}
+
+#undef testLoop_typeA
+#undef testLoop_typeZ
+#undef testLoop_genCases
+#undef testLoop_genCasesOperand
+#undef testLoop_isSignalingNaN
+#undef testLoop_write
+#undef testLoop_call
+#undef testLoop_anySignalingNaN
+#undef testLoop_writeOperands
+#undef testLoop_separator
+#undef testLoop_function
+#undef testLoop_a
+#undef testLoop_numOperands
+#undef testLoop_z
+#undef testLoop_longCase
+
+#endif
+
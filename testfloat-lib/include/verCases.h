@@ -56,6 +56,12 @@ extern bool verCases_errorStop;
 
 void verCases_writeFunctionName( FILE * );
 
+/*----------------------------------------------------------------------------
+| Puts the name that `verCases_writeFunctionName' would write in the buffer
+| at `bufPtr' of `size' bytes, shortened if need be.
+*----------------------------------------------------------------------------*/
+void verCases_formatFunctionName( char *bufPtr, size_t size );
+
 extern volatile sig_atomic_t verCases_stop;
 
 extern bool verCases_anyErrors;
@@ -204,9 +210,24 @@ bool f128M_isNaN( const float128_t * );
 
 #endif
 
-extern uint_fast32_t verCases_tenThousandsCount, verCases_errorCount;
+extern THREAD_LOCAL uint_fast32_t
+ verCases_tenThousandsCount, verCases_errorCount;
+
+/*----------------------------------------------------------------------------
+| When `verCases_quiet' is true (as it is in test-loop worker threads), cases
+| are counted but no progress or totals are written.
+*----------------------------------------------------------------------------*/
+extern THREAD_LOCAL bool verCases_quiet;
 
 void verCases_writeTestsPerformed( int );
 void verCases_perTenThousand( void );
 void verCases_writeErrorFound( int );
 
+/*----------------------------------------------------------------------------
+| Error reports are not flushed case by case.  `verCases_flushErrors' flushes
+| standard output if any error has been reported since the last flush; it is
+| called at the start of every batch of cases, before progress is written,
+| and when a loop's totals are written.
+*----------------------------------------------------------------------------*/
+void verCases_flushErrors( void );
+
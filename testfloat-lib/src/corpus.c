@@ -0,0 +1,750 @@
+
+/*============================================================================
+
+This C source file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "platform.h"
+#include "fail.h"
+#include "uint128.h"
+#include "softfloat.h"
+#include "verCases.h"
+#include "errorClasses.h"
+#include "corpus.h"
+
+bool corpus_recording = false;
+bool corpus_replaying = false;
+
+static const char corpusMagic[8] = "TFCORP1";
+
+/*----------------------------------------------------------------------------
+| In a corpus file, `corpusMagic' is followed by the cases, one after
+| another.  Each case is stored as:  the length of the function's name, in a
+| single byte; the name; the rounding code, the rounding precision, the
+| number of operands and the size in bytes of each operand, in a byte each;
+| and then the operands, each with its least-significant byte first.  An
+| 80-bit extended operand is its significand followed by its sign and
+| exponent, and a 128-bit operand is its low half followed by its high half.
+*----------------------------------------------------------------------------*/
+enum {
+    maxOperands = 3,
+    maxOperandSize = 16,
+    maxCaseSize = 1 + 255 + 4 + maxOperands * maxOperandSize
+};
+
+/*----------------------------------------------------------------------------
+| A corpus in memory keeps all its cases, in their file form, in `bytes',
+| with the start of each in `caseStarts'.  `hashTable' is an open-addressed
+| table of the numbers of the cases plus one, by the hash of their bytes,
+| with zero for an unused slot; it is kept at most half full.
+*----------------------------------------------------------------------------*/
+struct corpus {
+    unsigned char *bytes;
+    size_t size, maxSize;
+    size_t *caseStarts;
+    size_t numCases, maxNumCases;
+    size_t *hashTable;
+    size_t hashTableSize;
+};
+
+static struct corpus recordCorpus, replayCorpus;
+static const char *recordPath;
+static FILE *recordFile;
+
+static int numPendingOperands = 0;
+static int pendingOperandSize;
+static unsigned char pendingOperands[maxOperands * maxOperandSize];
+
+static THREAD_LOCAL size_t selectedCaseNum, numSelectedCases;
+static THREAD_LOCAL const unsigned char *casePtr = 0;
+
+static size_t caseSize( const unsigned char *ptr )
+{
+    size_t nameSize;
+
+    nameSize = ptr[0];
+    return 1 + nameSize + 4 + ptr[nameSize + 3] * ptr[nameSize + 4];
+
+}
+
+static uint_fast32_t hashCase( const unsigned char *ptr, size_t size )
+{
+    uint_fast32_t hash;
+
+    hash = 2166136261U;
+    while ( size-- ) hash = ((hash ^ *ptr++) * 16777619U) & 0xFFFFFFFF;
+    return hash;
+
+}
+
+static void insertHash( struct corpus *corpusPtr, size_t caseNum )
+{
+    const unsigned char *ptr;
+    size_t slot;
+
+    ptr = corpusPtr->bytes + corpusPtr->caseStarts[caseNum];
+    slot = hashCase( ptr, caseSize( ptr ) );
+    for (;;) {
+        slot &= corpusPtr->hashTableSize - 1;
+        if ( ! corpusPtr->hashTable[slot] ) break;
+        ++slot;
+    }
+    corpusPtr->hashTable[slot] = caseNum + 1;
+
+}
+
+/*----------------------------------------------------------------------------
+| Adds the case at `ptr' to the corpus at `corpusPtr' and returns true, or
+| returns false if the corpus has it already.
+*----------------------------------------------------------------------------*/
+static bool addCase( struct corpus *corpusPtr, const unsigned char *ptr )
+{
+    size_t size, slot, caseNum, i;
+    const unsigned char *otherPtr;
+
+    size = caseSize( ptr );
+    if ( corpusPtr->hashTableSize ) {
+        slot = hashCase( ptr, size );
+        for (;;) {
+            slot &= corpusPtr->hashTableSize - 1;
+            if ( ! corpusPtr->hashTable[slot] ) break;
+            otherPtr =
+                corpusPtr->bytes
+                    + corpusPtr->caseStarts[corpusPtr->hashTable[slot] - 1];
+            if (
+                (caseSize( otherPtr ) == size)
+                    && ! memcmp( otherPtr, ptr, size )
+            ) {
+                return false;
+            }
+            ++slot;
+        }
+    }
+    if ( corpusPtr->maxSize < corpusPtr->size + size ) {
+        corpusPtr->maxSize = 2 * corpusPtr->maxSize + 4096;
+        corpusPtr->bytes = realloc( corpusPtr->bytes, corpusPtr->maxSize );
+        if ( ! corpusPtr->bytes ) fail( "Out of memory" );
+    }
+    if ( corpusPtr->numCases == corpusPtr->maxNumCases ) {
+        corpusPtr->maxNumCases = 2 * corpusPtr->maxNumCases + 256;
+        corpusPtr->caseStarts =
+            realloc(
+                corpusPtr->caseStarts,
+                corpusPtr->maxNumCases * sizeof *corpusPtr->caseStarts
+            );
+        if ( ! corpusPtr->caseStarts ) fail( "Out of memory" );
+    }
+    caseNum = corpusPtr->numCases++;
+    corpusPtr->caseStarts[caseNum] = corpusPtr->size;
+    memcpy( corpusPtr->bytes + corpusPtr->size, ptr, size );
+    corpusPtr->size += size;
+    if ( corpusPtr->hashTableSize < 2 * corpusPtr->numCases ) {
+        free( corpusPtr->hashTable );
+        corpusPtr->hashTableSize =
+            corpusPtr->hashTableSize ? 2 * corpusPtr->hashTableSize : 1024;
+        corpusPtr->hashTable =
+            calloc(
+                corpusPtr->hashTableSize, sizeof *corpusPtr->hashTable );
+        if ( ! corpusPtr->hashTable ) fail( "Out of memory" );
+        for ( i = 0; i < corpusPtr->numCases; ++i ) {
+            insertHash( corpusPtr, i );
+        }
+    } else {
+        insertHash( corpusPtr, caseNum );
+    }
+    return true;
+
+}
+
+/*----------------------------------------------------------------------------
+| Reads the cases of the open corpus file `file', named `path', into the
+| corpus at `corpusPtr'.  Returns true if the file is exactly as it would be
+| written out again:  every case whole and valid, and none repeated.
+*----------------------------------------------------------------------------*/
+static
+bool
+ loadCorpus( struct corpus *corpusPtr, FILE *file, const char *path )
+{
+    char magic[sizeof corpusMagic];
+    size_t n;
+    bool exact;
+    unsigned char bytes[maxCaseSize];
+    const unsigned char *headPtr;
+
+    n = fread( magic, 1, sizeof magic, file );
+    if ( ! n ) return false;
+    if ( (n < sizeof magic) || memcmp( magic, corpusMagic, sizeof magic ) ) {
+        fail( "`%s' is not a corpus file", path );
+    }
+    exact = true;
+    for (;;) {
+        if ( ! fread( bytes, 1, 1, file ) ) break;
+        headPtr = bytes + 1 + bytes[0];
+        if (
+               ! bytes[0]
+            || ! fread( bytes + 1, bytes[0] + 4, 1, file )
+            || ! headPtr[2] || (maxOperands < headPtr[2])
+            || ! headPtr[3] || (maxOperandSize < headPtr[3])
+            || ! fread(
+                     bytes + 5 + bytes[0], headPtr[2] * headPtr[3], 1, file )
+        ) {
+            exact = false;
+            break;
+        }
+        if ( ! addCase( corpusPtr, bytes ) ) exact = false;
+    }
+    return exact;
+
+}
+
+static void writeCorpus( const struct corpus *corpusPtr, const char *path )
+{
+    char *newPath;
+    FILE *file;
+
+    newPath = malloc( strlen( path ) + 5 );
+    if ( ! newPath ) fail( "Out of memory" );
+    strcpy( newPath, path );
+    strcat( newPath, ".new" );
+    file = fopen( newPath, "wb" );
+    if ( ! file ) fail( "Cannot write `%s'", newPath );
+    fwrite( corpusMagic, sizeof corpusMagic, 1, file );
+    if ( corpusPtr->size ) {
+        fwrite( corpusPtr->bytes, corpusPtr->size, 1, file );
+    }
+    if ( ferror( file ) | fclose( file ) ) {
+        fail( "Cannot write `%s'", newPath );
+    }
+    remove( path );
+    if ( rename( newPath, path ) ) fail( "Cannot rename `%s'", newPath );
+    free( newPath );
+
+}
+
+void corpus_record( const char *path )
+{
+    FILE *file;
+    bool exact;
+
+    file = fopen( path, "rb" );
+    exact = false;
+    if ( file ) {
+        exact = loadCorpus( &recordCorpus, file, path );
+        fclose( file );
+    }
+    if ( ! exact ) writeCorpus( &recordCorpus, path );
+    recordFile = fopen( path, "ab" );
+    if ( ! recordFile ) fail( "Cannot write `%s'", path );
+    recordPath = path;
+    corpus_recording = true;
+
+}
+
+static void putBytes( unsigned char *ptr, uint_fast64_t v, int size )
+{
+
+    for ( ; size; --size ) {
+        *ptr++ = v;
+        v >>= 8;
+    }
+
+}
+
+static uint_fast64_t getBytes( const unsigned char *ptr, int size )
+{
+    uint_fast64_t v;
+
+    v = 0;
+    while ( size ) {
+        --size;
+        v = v<<8 | ptr[size];
+    }
+    return v;
+
+}
+
+static
+bool
+ caseMatches(
+     const unsigned char *ptr,
+     const char *namePtr,
+     int roundingCode,
+     int roundingPrecision
+ )
+{
+    size_t nameSize;
+
+    nameSize = strlen( namePtr );
+    return
+           (ptr[0] == nameSize)
+        && ! memcmp( ptr + 1, namePtr, nameSize )
+        && ((roundingCode < 0) || (ptr[nameSize + 1] == roundingCode))
+        && ((roundingPrecision < 0)
+                || (ptr[nameSize + 2] == roundingPrecision));
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns where the next pending operand of `size' bytes goes, or null if
+| there are too many.
+*----------------------------------------------------------------------------*/
+static unsigned char *nextOperand( int size )
+{
+
+    if ( numPendingOperands == maxOperands ) return 0;
+    pendingOperandSize = size;
+    return pendingOperands + numPendingOperands++ * size;
+
+}
+
+void corpus_ui16Operand( uint_fast16_t a )
+{
+    unsigned char *ptr;
+
+    ptr = nextOperand( 2 );
+    if ( ptr ) putBytes( ptr, a, 2 );
+
+}
+
+void corpus_ui32Operand( uint_fast32_t a )
+{
+    unsigned char *ptr;
+
+    ptr = nextOperand( 4 );
+    if ( ptr ) putBytes( ptr, a, 4 );
+
+}
+
+void corpus_ui64Operand( uint_fast64_t a )
+{
+    unsigned char *ptr;
+
+    ptr = nextOperand( 8 );
+    if ( ptr ) putBytes( ptr, a, 8 );
+
+}
+
+#ifdef EXTFLOAT80
+
+void corpus_extF80MOperand( const extFloat80_t *aPtr )
+{
+    const struct extFloat80M *aSPtr;
+    unsigned char *ptr;
+
+    aSPtr = (const struct extFloat80M *) aPtr;
+    ptr = nextOperand( 10 );
+    if ( ! ptr ) return;
+    putBytes( ptr, aSPtr->signif, 8 );
+    putBytes( ptr + 8, aSPtr->signExp, 2 );
+
+}
+
+#endif
+
+#ifdef FLOAT128
+
+void corpus_f128MOperand( const float128_t *aPtr )
+{
+    const struct uint128 *uiAPtr;
+    unsigned char *ptr;
+
+    uiAPtr = (const struct uint128 *) aPtr;
+    ptr = nextOperand( 16 );
+    if ( ! ptr ) return;
+    putBytes( ptr, uiAPtr->v0, 8 );
+    putBytes( ptr + 8, uiAPtr->v64, 8 );
+
+}
+
+#endif
+
+/*----------------------------------------------------------------------------
+| Puts at `bytes' a case of the named function with the pending operands, and
+| returns its size, or zero if there are no pending operands.
+*----------------------------------------------------------------------------*/
+static
+size_t
+ makeCase(
+     unsigned char *bytes,
+     const char *namePtr,
+     int roundingCode,
+     int roundingPrecision
+ )
+{
+    size_t nameSize, operandsSize;
+    unsigned char *headPtr;
+
+    if ( ! numPendingOperands ) return 0;
+    nameSize = strlen( namePtr );
+    if ( 255 < nameSize ) nameSize = 255;
+    operandsSize = numPendingOperands * pendingOperandSize;
+    bytes[0] = nameSize;
+    memcpy( bytes + 1, namePtr, nameSize );
+    headPtr = bytes + 1 + nameSize;
+    headPtr[0] = roundingCode;
+    headPtr[1] = roundingPrecision;
+    headPtr[2] = numPendingOperands;
+    headPtr[3] = pendingOperandSize;
+    memcpy( headPtr + 4, pendingOperands, operandsSize );
+    numPendingOperands = 0;
+    return 1 + nameSize + 4 + operandsSize;
+
+}
+
+void corpus_addCase( void )
+{
+    unsigned char bytes[maxCaseSize];
+    size_t size;
+
+    size =
+        makeCase(
+            bytes,
+            verCases_functionNamePtr,
+            verCases_roundingCode,
+            verCases_roundingPrecision
+        );
+    if ( ! size || ! addCase( &recordCorpus, bytes ) ) return;
+    fwrite( bytes, size, 1, recordFile );
+    if ( fflush( recordFile ) || ferror( recordFile ) ) {
+        fail( "Cannot write `%s'", recordPath );
+    }
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns true if the name of the function of the case at `ptr' starts with
+| the type named `typeNamePtr' followed by an underscore.
+*----------------------------------------------------------------------------*/
+static bool caseTypeIs( const unsigned char *ptr, const char *typeNamePtr )
+{
+    size_t typeNameSize;
+
+    typeNameSize = strlen( typeNamePtr );
+    return
+           (typeNameSize < ptr[0])
+        && ! memcmp( ptr + 1, typeNamePtr, typeNameSize )
+        && (ptr[1 + typeNameSize] == '_');
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns the class of the operand at `operandPtr', of `size' bytes, of the
+| case at `ptr'.  The operand's type is the start of the function's name.
+*----------------------------------------------------------------------------*/
+static
+int
+ operandClass(
+     const unsigned char *ptr, const unsigned char *operandPtr, int size )
+{
+    uint_fast64_t ui, ui64;
+
+    ui = getBytes( operandPtr, (8 < size) ? 8 : size );
+    if ( (size == 2) && caseTypeIs( ptr, "f16" ) ) {
+        return
+            errorClasses_floatClass(
+                ui>>10 & 0x1F, 0x1F, ! (ui & 0x3FF), ui>>9 & 1 );
+    }
+    if ( (size == 2) && caseTypeIs( ptr, "bf16" ) ) {
+        return
+            errorClasses_floatClass(
+                ui>>7 & 0xFF, 0xFF, ! (ui & 0x7F), ui>>6 & 1 );
+    }
+    if ( (size == 4) && caseTypeIs( ptr, "f32" ) ) {
+        return
+            errorClasses_floatClass(
+                ui>>23 & 0xFF, 0xFF, ! (ui & 0x007FFFFF), ui>>22 & 1 );
+    }
+    if ( (size == 8) && caseTypeIs( ptr, "f64" ) ) {
+        return
+            errorClasses_floatClass(
+                ui>>52 & 0x7FF,
+                0x7FF,
+                ! (ui & UINT64_C( 0x000FFFFFFFFFFFFF )),
+                ui>>51 & 1
+            );
+    }
+    if ( size == 10 ) {
+        ui64 = getBytes( operandPtr + 8, 2 ) & 0x7FFF;
+        if ( ! ui64 ) {
+            return ui ? errorClasses_subnormal : errorClasses_zero;
+        }
+        return
+            errorClasses_floatClass(
+                ui64,
+                0x7FFF,
+                ! (ui & UINT64_C( 0x7FFFFFFFFFFFFFFF )),
+                ui>>62 & 1
+            );
+    }
+    if ( size == 16 ) {
+        ui64 = getBytes( operandPtr + 8, 8 );
+        return
+            errorClasses_floatClass(
+                ui64>>48 & 0x7FFF,
+                0x7FFF,
+                ! (ui64 & UINT64_C( 0x0000FFFFFFFFFFFF )) && ! ui,
+                ui64>>47 & 1
+            );
+    }
+    return ui ? errorClasses_normal : errorClasses_zero;
+
+}
+
+void corpus_countClasses( const char *namePtr, uint_fast64_t counts[] )
+{
+    size_t i;
+    const unsigned char *ptr, *headPtr;
+    int operandNum;
+
+    for ( i = 0; i < recordCorpus.numCases; ++i ) {
+        ptr = recordCorpus.bytes + recordCorpus.caseStarts[i];
+        if ( namePtr && ! caseMatches( ptr, namePtr, -1, -1 ) ) continue;
+        headPtr = ptr + 1 + ptr[0];
+        for ( operandNum = 0; operandNum < headPtr[2]; ++operandNum ) {
+            ++counts[
+                  operandClass(
+                      ptr, headPtr + 4 + operandNum * headPtr[3], headPtr[3] )
+              ];
+        }
+    }
+
+}
+
+/*----------------------------------------------------------------------------
+| For replaying, the cases are sorted so that those of each function,
+| rounding code and rounding precision are together.
+*----------------------------------------------------------------------------*/
+static int compareCases( const void *aPtr, const void *bPtr )
+{
+    const unsigned char *caseAPtr, *caseBPtr;
+    size_t sizeA, sizeB;
+    int result;
+
+    caseAPtr = replayCorpus.bytes + *(const size_t *) aPtr;
+    caseBPtr = replayCorpus.bytes + *(const size_t *) bPtr;
+    sizeA = caseSize( caseAPtr );
+    sizeB = caseSize( caseBPtr );
+    result = memcmp( caseAPtr, caseBPtr, (sizeA < sizeB) ? sizeA : sizeB );
+    if ( result ) return result;
+    return (sizeA < sizeB) ? -1 : (sizeB < sizeA);
+
+}
+
+void corpus_replay( const char *path )
+{
+    FILE *file;
+
+    file = fopen( path, "rb" );
+    if ( ! file ) fail( "Cannot read `%s'", path );
+    loadCorpus( &replayCorpus, file, path );
+    fclose( file );
+    if ( replayCorpus.numCases ) {
+        qsort(
+            replayCorpus.caseStarts,
+            replayCorpus.numCases,
+            sizeof *replayCorpus.caseStarts,
+            compareCases
+        );
+    }
+    corpus_replaying = true;
+
+}
+
+void corpus_clearReplay( void )
+{
+
+    replayCorpus.size = 0;
+    replayCorpus.numCases = 0;
+    if ( replayCorpus.hashTableSize ) {
+        memset(
+            replayCorpus.hashTable,
+            0,
+            replayCorpus.hashTableSize * sizeof *replayCorpus.hashTable
+        );
+    }
+
+}
+
+void corpus_addReplayCase( const char *namePtr )
+{
+    unsigned char bytes[maxCaseSize];
+
+    if ( makeCase( bytes, namePtr, 0, 0 ) ) addCase( &replayCorpus, bytes );
+
+}
+
+uint_fast64_t
+ corpus_numCases(
+     const char *namePtr, int roundingCode, int roundingPrecision )
+{
+    size_t i;
+    uint_fast64_t count;
+
+    count = 0;
+    for ( i = 0; i < replayCorpus.numCases; ++i ) {
+        count +=
+            caseMatches(
+                replayCorpus.bytes + replayCorpus.caseStarts[i],
+                namePtr,
+                roundingCode,
+                roundingPrecision
+            );
+    }
+    return count;
+
+}
+
+void
+ corpus_selectCases(
+     const char *namePtr, int roundingCode, int roundingPrecision )
+{
+    size_t i;
+
+    numSelectedCases = 0;
+    for ( i = 0; i < replayCorpus.numCases; ++i ) {
+        if (
+            caseMatches(
+                replayCorpus.bytes + replayCorpus.caseStarts[i],
+                namePtr,
+                roundingCode,
+                roundingPrecision
+            )
+        ) {
+            if ( ! numSelectedCases ) selectedCaseNum = i;
+            ++numSelectedCases;
+        } else if ( numSelectedCases ) {
+            break;
+        }
+    }
+
+}
+
+uint_fast64_t corpus_startCases( void )
+{
+
+    casePtr = 0;
+    return numSelectedCases;
+
+}
+
+void corpus_setCase( uint_fast64_t caseNum )
+{
+
+    if ( ! numSelectedCases ) return;
+    casePtr =
+        replayCorpus.bytes
+            + replayCorpus.caseStarts[
+                  selectedCaseNum + caseNum % numSelectedCases];
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns the operand `operandNum' of the current case, if it is there and of
+| `size' bytes, or else null.
+*----------------------------------------------------------------------------*/
+static const unsigned char *caseOperand( int operandNum, int size )
+{
+    const unsigned char *headPtr;
+
+    if ( ! casePtr ) return 0;
+    headPtr = casePtr + 1 + casePtr[0];
+    if ( (headPtr[2] <= operandNum) || (headPtr[3] != size) ) return 0;
+    return headPtr + 4 + operandNum * size;
+
+}
+
+uint_fast16_t corpus_ui16Case( int operandNum )
+{
+    const unsigned char *ptr;
+
+    ptr = caseOperand( operandNum, 2 );
+    return ptr ? getBytes( ptr, 2 ) : 0;
+
+}
+
+uint_fast32_t corpus_ui32Case( int operandNum )
+{
+    const unsigned char *ptr;
+
+    ptr = caseOperand( operandNum, 4 );
+    return ptr ? getBytes( ptr, 4 ) : 0;
+
+}
+
+uint_fast64_t corpus_ui64Case( int operandNum )
+{
+    const unsigned char *ptr;
+
+    ptr = caseOperand( operandNum, 8 );
+    return ptr ? getBytes( ptr, 8 ) : 0;
+
+}
+
+#ifdef EXTFLOAT80
+
+void corpus_extF80MCase( int operandNum, extFloat80_t *zPtr )
+{
+    const unsigned char *ptr;
+    struct extFloat80M *zSPtr;
+
+    ptr = caseOperand( operandNum, 10 );
+    zSPtr = (struct extFloat80M *) zPtr;
+    zSPtr->signif = ptr ? getBytes( ptr, 8 ) : 0;
+    zSPtr->signExp = ptr ? getBytes( ptr + 8, 2 ) : 0;
+
+}
+
+#endif
+
+#ifdef FLOAT128
+
+void corpus_f128MCase( int operandNum, float128_t *zPtr )
+{
+    const unsigned char *ptr;
+    struct uint128 *uiZPtr;
+
+    ptr = caseOperand( operandNum, 16 );
+    uiZPtr = (struct uint128 *) zPtr;
+    uiZPtr->v0 = ptr ? getBytes( ptr, 8 ) : 0;
+    uiZPtr->v64 = ptr ? getBytes( ptr + 8, 8 ) : 0;
+
+}
+
+#endif
+
@@ -0,0 +1,665 @@
+
+/*============================================================================
+
+This C source file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "platform.h"
+#include "uint128.h"
+#include "softfloat.h"
+#include "writeHex.h"
+#include "errorClasses.h"
+
+bool errorClasses_active = false;
+
+enum { classNone = 7 };
+
+const char * const errorClasses_names[errorClasses_numClasses] = {
+    "zero", "subnormal", "normal", "infinity", "qNaN", "sNaN"
+};
+
+enum {
+    maxOperands   = 3,
+    maxSignatures = 1024,
+    flagsMask     = 0x1F
+};
+
+union operandValue {
+    uint_fast64_t ui;
+    float16_t f16;
+    float32_t f32;
+#ifdef FLOAT64
+    float64_t f64;
+#endif
+#ifdef EXTFLOAT80
+    extFloat80_t extF80;
+#endif
+#ifdef FLOAT128
+    float128_t f128;
+#endif
+};
+
+struct operand {
+    void (*writeFunction)( const union operandValue * );
+    union operandValue value;
+};
+
+/*----------------------------------------------------------------------------
+| A signature's `key' packs, three bits each, the classes of up to three
+| operands (`classNone' for those missing) and of the expected and actual
+| results, followed by five bits each of missing and extra flags.
+*----------------------------------------------------------------------------*/
+struct signature {
+    uint_fast32_t key;
+    uint_fast64_t count;
+    int numExamples;
+};
+
+static int numOperands = 0;
+static int operandClasses[maxOperands];
+static struct operand operands[maxOperands];
+static struct signature signatures[maxSignatures];
+static int numSignatures = 0;
+static uint_fast64_t numOtherErrors = 0;
+
+int
+ errorClasses_floatClass(
+     uint_fast32_t exp, uint_fast32_t maxExp, bool fracIsZero, bool quiet )
+{
+
+    if ( ! exp ) {
+        return fracIsZero ? errorClasses_zero : errorClasses_subnormal;
+    }
+    if ( exp != maxExp ) return errorClasses_normal;
+    if ( fracIsZero ) return errorClasses_infinity;
+    return quiet ? errorClasses_qNaN : errorClasses_sNaN;
+
+}
+
+static int ui16Class( uint_fast16_t uiA, int expWidth, int fracWidth )
+{
+    uint_fast16_t fracMask;
+
+    fracMask = ((uint_fast16_t) 1<<fracWidth) - 1;
+    return
+        errorClasses_floatClass(
+            uiA>>fracWidth & (((uint_fast16_t) 1<<expWidth) - 1),
+            ((uint_fast16_t) 1<<expWidth) - 1,
+            ! (uiA & fracMask),
+            uiA>>(fracWidth - 1) & 1
+        );
+
+}
+
+#ifdef FLOAT16
+
+static int f16Class( float16_t a )
+{
+    union { uint16_t ui; float16_t f; } uA;
+
+    uA.f = a;
+    return ui16Class( uA.ui, 5, 10 );
+
+}
+
+#endif
+
+static int bf16Class( float16_t a )
+{
+    union { uint16_t ui; float16_t f; } uA;
+
+    uA.f = a;
+    return ui16Class( uA.ui, 8, 7 );
+
+}
+
+static int f32Class( float32_t a )
+{
+    union { uint32_t ui; float32_t f; } uA;
+
+    uA.f = a;
+    return
+        errorClasses_floatClass(
+            uA.ui>>23 & 0xFF,
+            0xFF,
+            ! (uA.ui & 0x007FFFFF),
+            (uA.ui & 0x00400000) != 0
+        );
+
+}
+
+#ifdef FLOAT64
+
+static int f64Class( float64_t a )
+{
+    union { uint64_t ui; float64_t f; } uA;
+
+    uA.f = a;
+    return
+        errorClasses_floatClass(
+            uA.ui>>52 & 0x7FF,
+            0x7FF,
+            ! (uA.ui & UINT64_C( 0x000FFFFFFFFFFFFF )),
+            (uA.ui & UINT64_C( 0x0008000000000000 )) != 0
+        );
+
+}
+
+#endif
+
+#ifdef EXTFLOAT80
+
+static int extF80MClass( const extFloat80_t *aPtr )
+{
+    const struct extFloat80M *aSPtr;
+
+    aSPtr = (const struct extFloat80M *) aPtr;
+    if ( ! (aSPtr->signExp & 0x7FFF) ) {
+        return aSPtr->signif ? errorClasses_subnormal : errorClasses_zero;
+    }
+    return
+        errorClasses_floatClass(
+            aSPtr->signExp & 0x7FFF,
+            0x7FFF,
+            ! (aSPtr->signif & UINT64_C( 0x7FFFFFFFFFFFFFFF )),
+            (aSPtr->signif & UINT64_C( 0x4000000000000000 )) != 0
+        );
+
+}
+
+#endif
+
+#ifdef FLOAT128
+
+static int f128MClass( const float128_t *aPtr )
+{
+    const struct uint128 *uiAPtr;
+
+    uiAPtr = (const struct uint128 *) aPtr;
+    return
+        errorClasses_floatClass(
+            uiAPtr->v64>>48 & 0x7FFF,
+            0x7FFF,
+            ! (uiAPtr->v64 & UINT64_C( 0x0000FFFFFFFFFFFF )) && ! uiAPtr->v0,
+            (uiAPtr->v64 & UINT64_C( 0x0000800000000000 )) != 0
+        );
+
+}
+
+#endif
+
+static void writeUI32( const union operandValue *valuePtr )
+{
+
+    writeHex_ui32( valuePtr->ui, 0 );
+
+}
+
+static void writeUI64( const union operandValue *valuePtr )
+{
+
+    writeHex_ui64( valuePtr->ui, 0 );
+
+}
+
+#ifdef FLOAT16
+
+static void writeF16( const union operandValue *valuePtr )
+{
+
+    writeHex_f16( valuePtr->f16, 0 );
+
+}
+
+#endif
+
+static void writeBF16( const union operandValue *valuePtr )
+{
+
+    writeHex_bf16( valuePtr->f16, 0 );
+
+}
+
+static void writeF32( const union operandValue *valuePtr )
+{
+
+    writeHex_f32( valuePtr->f32, 0 );
+
+}
+
+#ifdef FLOAT64
+
+static void writeF64( const union operandValue *valuePtr )
+{
+
+    writeHex_f64( valuePtr->f64, 0 );
+
+}
+
+#endif
+
+#ifdef EXTFLOAT80
+
+static void writeExtF80M( const union operandValue *valuePtr )
+{
+
+    writeHex_extF80M( &valuePtr->extF80, 0 );
+
+}
+
+#endif
+
+#ifdef FLOAT128
+
+static void writeF128M( const union operandValue *valuePtr )
+{
+
+    writeHex_f128M( &valuePtr->f128, 0 );
+
+}
+
+#endif
+
+static struct operand *addOperand( int class )
+{
+
+    if ( numOperands == maxOperands ) return &operands[0];
+    operandClasses[numOperands] = class;
+    return &operands[numOperands++];
+
+}
+
+/*----------------------------------------------------------------------------
+| Counts the case with the operands added so far under its signature, and
+| if the signature wants another example, writes the tag and the operands
+| and returns true.
+*----------------------------------------------------------------------------*/
+static
+bool
+ addResult(
+     int trueClass,
+     uint_fast8_t trueFlags,
+     int subjClass,
+     uint_fast8_t subjFlags
+ )
+{
+    uint_fast32_t key;
+    int i;
+    struct signature *signaturePtr;
+
+    key = 0;
+    for ( i = 0; i < maxOperands; ++i ) {
+        key = key<<3 | ((i < numOperands) ? operandClasses[i] : classNone);
+    }
+    key = key<<3 | trueClass;
+    key = key<<3 | subjClass;
+    key = key<<5 | (trueFlags & ~subjFlags & flagsMask);
+    key = key<<5 | (subjFlags & ~trueFlags & flagsMask);
+    for ( i = 0; i < numSignatures; ++i ) {
+        if ( signatures[i].key == key ) break;
+    }
+    if ( i == numSignatures ) {
+        if ( numSignatures == maxSignatures ) {
+            ++numOtherErrors;
+            numOperands = 0;
+            return false;
+        }
+        signatures[i].key = key;
+        signatures[i].count = 0;
+        signatures[i].numExamples = 0;
+        ++numSignatures;
+    }
+    signaturePtr = &signatures[i];
+    ++signaturePtr->count;
+    if ( errorClasses_maxExamples <= signaturePtr->numExamples ) {
+        numOperands = 0;
+        return false;
+    }
+    ++signaturePtr->numExamples;
+    printf( "[%d] ", i + 1 );
+    for ( i = 0; i < numOperands; ++i ) {
+        operands[i].writeFunction( &operands[i].value );
+        fputs( "  ", stdout );
+    }
+    numOperands = 0;
+    return true;
+
+}
+
+void errorClasses_ui32Operand( uint_fast32_t a )
+{
+    struct operand *operandPtr;
+
+    operandPtr = addOperand( a ? errorClasses_normal : errorClasses_zero );
+    operandPtr->writeFunction = writeUI32;
+    operandPtr->value.ui = a;
+
+}
+
+void errorClasses_ui64Operand( uint_fast64_t a )
+{
+    struct operand *operandPtr;
+
+    operandPtr = addOperand( a ? errorClasses_normal : errorClasses_zero );
+    operandPtr->writeFunction = writeUI64;
+    operandPtr->value.ui = a;
+
+}
+
+#ifdef FLOAT16
+
+void errorClasses_f16Operand( float16_t a )
+{
+    struct operand *operandPtr;
+
+    operandPtr = addOperand( f16Class( a ) );
+    operandPtr->writeFunction = writeF16;
+    operandPtr->value.f16 = a;
+
+}
+
+#endif
+
+void errorClasses_bf16Operand( float16_t a )
+{
+    struct operand *operandPtr;
+
+    operandPtr = addOperand( bf16Class( a ) );
+    operandPtr->writeFunction = writeBF16;
+    operandPtr->value.f16 = a;
+
+}
+
+void errorClasses_f32Operand( float32_t a )
+{
+    struct operand *operandPtr;
+
+    operandPtr = addOperand( f32Class( a ) );
+    operandPtr->writeFunction = writeF32;
+    operandPtr->value.f32 = a;
+
+}
+
+#ifdef FLOAT64
+
+void errorClasses_f64Operand( float64_t a )
+{
+    struct operand *operandPtr;
+
+    operandPtr = addOperand( f64Class( a ) );
+    operandPtr->writeFunction = writeF64;
+    operandPtr->value.f64 = a;
+
+}
+
+#endif
+
+#ifdef EXTFLOAT80
+
+void errorClasses_extF80MOperand( const extFloat80_t *aPtr )
+{
+    struct operand *operandPtr;
+
+    operandPtr = addOperand( extF80MClass( aPtr ) );
+    operandPtr->writeFunction = writeExtF80M;
+    operandPtr->value.extF80 = *aPtr;
+
+}
+
+#endif
+
+#ifdef FLOAT128
+
+void errorClasses_f128MOperand( const float128_t *aPtr )
+{
+    struct operand *operandPtr;
+
+    operandPtr = addOperand( f128MClass( aPtr ) );
+    operandPtr->writeFunction = writeF128M;
+    operandPtr->value.f128 = *aPtr;
+
+}
+
+#endif
+
+bool
+ errorClasses_boolResult(
+     bool trueZ, uint_fast8_t trueFlags, bool subjZ, uint_fast8_t subjFlags )
+{
+
+    return
+        addResult(
+            trueZ ? errorClasses_normal : errorClasses_zero,
+            trueFlags,
+            subjZ ? errorClasses_normal : errorClasses_zero,
+            subjFlags
+        );
+
+}
+
+bool
+ errorClasses_ui32Result(
+     uint_fast32_t trueZ,
+     uint_fast8_t trueFlags,
+     uint_fast32_t subjZ,
+     uint_fast8_t subjFlags
+ )
+{
+
+    return
+        addResult(
+            trueZ ? errorClasses_normal : errorClasses_zero,
+            trueFlags,
+            subjZ ? errorClasses_normal : errorClasses_zero,
+            subjFlags
+        );
+
+}
+
+bool
+ errorClasses_ui64Result(
+     uint_fast64_t trueZ,
+     uint_fast8_t trueFlags,
+     uint_fast64_t subjZ,
+     uint_fast8_t subjFlags
+ )
+{
+
+    return
+        addResult(
+            trueZ ? errorClasses_normal : errorClasses_zero,
+            trueFlags,
+            subjZ ? errorClasses_normal : errorClasses_zero,
+            subjFlags
+        );
+
+}
+
+#ifdef FLOAT16
+
+bool
+ errorClasses_f16Result(
+     float16_t trueZ,
+     uint_fast8_t trueFlags,
+     float16_t subjZ,
+     uint_fast8_t subjFlags
+ )
+{
+
+    return
+        addResult(
+            f16Class( trueZ ), trueFlags, f16Class( subjZ ), subjFlags );
+
+}
+
+#endif
+
+bool
+ errorClasses_bf16Result(
+     float16_t trueZ,
+     uint_fast8_t trueFlags,
+     float16_t subjZ,
+     uint_fast8_t subjFlags
+ )
+{
+
+    return
+        addResult(
+            bf16Class( trueZ ), trueFlags, bf16Class( subjZ ), subjFlags );
+
+}
+
+bool
+ errorClasses_f32Result(
+     float32_t trueZ,
+     uint_fast8_t trueFlags,
+     float32_t subjZ,
+     uint_fast8_t subjFlags
+ )
+{
+
+    return
+        addResult(
+            f32Class( trueZ ), trueFlags, f32Class( subjZ ), subjFlags );
+
+}
+
+#ifdef FLOAT64
+
+bool
+ errorClasses_f64Result(
+     float64_t trueZ,
+     uint_fast8_t trueFlags,
+     float64_t subjZ,
+     uint_fast8_t subjFlags
+ )
+{
+
+    return
+        addResult(
+            f64Class( trueZ ), trueFlags, f64Class( subjZ ), subjFlags );
+
+}
+
+#endif
+
+#ifdef EXTFLOAT80
+
+bool
+ errorClasses_extF80MResult(
+     const extFloat80_t *trueZPtr,
+     uint_fast8_t trueFlags,
+     const extFloat80_t *subjZPtr,
+     uint_fast8_t subjFlags
+ )
+{
+
+    return
+        addResult(
+            extF80MClass( trueZPtr ),
+            trueFlags,
+            extF80MClass( subjZPtr ),
+            subjFlags
+        );
+
+}
+
+#endif
+
+#ifdef FLOAT128
+
+bool
+ errorClasses_f128MResult(
+     const float128_t *trueZPtr,
+     uint_fast8_t trueFlags,
+     const float128_t *subjZPtr,
+     uint_fast8_t subjFlags
+ )
+{
+
+    return
+        addResult(
+            f128MClass( trueZPtr ),
+            trueFlags,
+            f128MClass( subjZPtr ),
+            subjFlags
+        );
+
+}
+
+#endif
+
+void errorClasses_write( void )
+{
+    int i, operandNum, class;
+    uint_fast32_t key;
+
+    if ( ! numSignatures ) return;
+    fputs( "Error classes (operands => result, expected):\n", stdout );
+    for ( i = 0; i < numSignatures; ++i ) {
+        key = signatures[i].key;
+        printf(
+            "[%d] %llu:  ", i + 1, (unsigned long long) signatures[i].count );
+        for ( operandNum = 0; operandNum < maxOperands; ++operandNum ) {
+            class = key>>(22 - 3 * operandNum) & 7;
+            if ( class != classNone ) {
+                printf( "%s  ", errorClasses_names[class] );
+            }
+        }
+        printf(
+            "=> %s, expected %s",
+            errorClasses_names[key>>10 & 7],
+            errorClasses_names[key>>13 & 7]
+        );
+        if ( key & 0x3FF ) {
+            fputs( "; flags missing ", stdout );
+            writeHex_softfloat_flags( key>>5 & flagsMask, 0 );
+            fputs( ", extra ", stdout );
+            writeHex_softfloat_flags( key & flagsMask, 0 );
+        }
+        fputc( '\n', stdout );
+    }
+    if ( numOtherErrors ) {
+        printf(
+            "%llu errors of other classes.\n",
+            (unsigned long long) numOtherErrors
+        );
+    }
+    numSignatures = 0;
+    numOtherErrors = 0;
+
+}
+
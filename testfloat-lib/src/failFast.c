@@ -0,0 +1,492 @@
+
+/*============================================================================
+
+This C source file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "platform.h"
+#include "fail.h"
+#include "uint128.h"
+#include "softfloat.h"
+#include "errorClasses.h"
+#include "corpus.h"
+#include "failFast.h"
+
+enum { maxNameLength = 47 };
+
+struct failStat {
+    char name[maxNameLength + 1];
+    unsigned long numTests, numFailures;
+};
+
+static struct failStat *failStats;
+static int numFailStats, maxFailStats;
+
+static struct failStat *findFailStat( const char *namePtr )
+{
+    int i;
+
+    for ( i = 0; i < numFailStats; ++i ) {
+        if ( ! strcmp( failStats[i].name, namePtr ) ) return &failStats[i];
+    }
+    return 0;
+
+}
+
+static struct failStat *addFailStat( const char *namePtr )
+{
+    struct failStat *failStatPtr;
+
+    if ( numFailStats == maxFailStats ) {
+        maxFailStats = maxFailStats ? 2 * maxFailStats : 256;
+        failStats = realloc( failStats, maxFailStats * sizeof *failStats );
+        if ( ! failStats ) fail( "Out of memory" );
+    }
+    failStatPtr = &failStats[numFailStats];
+    ++numFailStats;
+    strncpy( failStatPtr->name, namePtr, maxNameLength );
+    failStatPtr->name[maxNameLength] = 0;
+    failStatPtr->numTests = 0;
+    failStatPtr->numFailures = 0;
+    return failStatPtr;
+
+}
+
+void failFast_load( const char *path )
+{
+    FILE *file;
+    char name[maxNameLength + 1];
+    unsigned long numTests, numFailures;
+    struct failStat *failStatPtr;
+
+    file = fopen( path, "r" );
+    if ( ! file ) return;
+    while (
+        fscanf( file, "%47s %lu %lu", name, &numTests, &numFailures ) == 3
+    ) {
+        if ( findFailStat( name ) ) continue;
+        failStatPtr = addFailStat( name );
+        failStatPtr->numTests = numTests;
+        failStatPtr->numFailures = numFailures;
+    }
+    fclose( file );
+
+}
+
+void failFast_save( const char *path )
+{
+    FILE *file;
+    int i;
+
+    file = fopen( path, "w" );
+    if ( ! file ) fail( "Cannot write `%s'", path );
+    for ( i = 0; i < numFailStats; ++i ) {
+        fprintf(
+            file,
+            "%s %lu %lu\n",
+            failStats[i].name,
+            failStats[i].numTests,
+            failStats[i].numFailures
+        );
+    }
+    fclose( file );
+
+}
+
+void failFast_record( const char *namePtr, bool failed )
+{
+    struct failStat *failStatPtr;
+
+    failStatPtr = findFailStat( namePtr );
+    if ( ! failStatPtr ) failStatPtr = addFailStat( namePtr );
+    ++failStatPtr->numTests;
+    if ( failed ) ++failStatPtr->numFailures;
+
+}
+
+double failFast_score( const char *namePtr )
+{
+    struct failStat *failStatPtr;
+
+    failStatPtr = findFailStat( namePtr );
+    if ( ! failStatPtr ) return 0.5;
+    return
+        (failStatPtr->numFailures + 1.0) / (failStatPtr->numTests + 2.0);
+
+}
+
+/*----------------------------------------------------------------------------
+| Typical values of each class, for each operand type.  For an integer type,
+| only the classes zero and normal apply.  `v64' holds the sign and exponent
+| of an 80-bit extended value, whose significand is in `v0', and the high half
+| of a 128-bit value.
+*----------------------------------------------------------------------------*/
+struct probeValue {
+    int class;
+    uint64_t v64, v0;
+};
+
+static const struct probeValue ui32Values[] = {
+    { errorClasses_zero, 0, 0 },
+    { errorClasses_normal, 0, 1 },
+    { errorClasses_normal, 0, 0x00FFFFFF },
+    { errorClasses_normal, 0, 0x01000001 },
+    { errorClasses_normal, 0, 0x7FFFFFFF },
+    { errorClasses_normal, 0, 0x80000000 },
+    { errorClasses_normal, 0, 0xFFFFFFFF }
+};
+
+static const struct probeValue ui64Values[] = {
+    { errorClasses_zero, 0, 0 },
+    { errorClasses_normal, 0, 1 },
+    { errorClasses_normal, 0, UINT64_C( 0x001FFFFFFFFFFFFF ) },
+    { errorClasses_normal, 0, UINT64_C( 0x0020000000000001 ) },
+    { errorClasses_normal, 0, UINT64_C( 0x7FFFFFFFFFFFFFFF ) },
+    { errorClasses_normal, 0, UINT64_C( 0x8000000000000000 ) },
+    { errorClasses_normal, 0, UINT64_C( 0xFFFFFFFFFFFFFFFF ) }
+};
+
+static const struct probeValue f16Values[] = {
+    { errorClasses_zero, 0, 0x0000 },
+    { errorClasses_zero, 0, 0x8000 },
+    { errorClasses_subnormal, 0, 0x0001 },
+    { errorClasses_subnormal, 0, 0x03FF },
+    { errorClasses_subnormal, 0, 0x8001 },
+    { errorClasses_subnormal, 0, 0x83FF },
+    { errorClasses_normal, 0, 0x0400 },
+    { errorClasses_normal, 0, 0x3C00 },
+    { errorClasses_normal, 0, 0x7BFF },
+    { errorClasses_normal, 0, 0x8400 },
+    { errorClasses_normal, 0, 0xBC00 },
+    { errorClasses_normal, 0, 0xFBFF },
+    { errorClasses_infinity, 0, 0x7C00 },
+    { errorClasses_infinity, 0, 0xFC00 },
+    { errorClasses_qNaN, 0, 0x7E00 },
+    { errorClasses_qNaN, 0, 0xFE01 },
+    { errorClasses_sNaN, 0, 0x7C01 },
+    { errorClasses_sNaN, 0, 0xFDFF }
+};
+
+static const struct probeValue bf16Values[] = {
+    { errorClasses_zero, 0, 0x0000 },
+    { errorClasses_zero, 0, 0x8000 },
+    { errorClasses_subnormal, 0, 0x0001 },
+    { errorClasses_subnormal, 0, 0x007F },
+    { errorClasses_subnormal, 0, 0x8001 },
+    { errorClasses_subnormal, 0, 0x807F },
+    { errorClasses_normal, 0, 0x0080 },
+    { errorClasses_normal, 0, 0x3F80 },
+    { errorClasses_normal, 0, 0x7F7F },
+    { errorClasses_normal, 0, 0x8080 },
+    { errorClasses_normal, 0, 0xBF80 },
+    { errorClasses_normal, 0, 0xFF7F },
+    { errorClasses_infinity, 0, 0x7F80 },
+    { errorClasses_infinity, 0, 0xFF80 },
+    { errorClasses_qNaN, 0, 0x7FC0 },
+    { errorClasses_qNaN, 0, 0xFFC1 },
+    { errorClasses_sNaN, 0, 0x7F81 },
+    { errorClasses_sNaN, 0, 0xFFBF }
+};
+
+static const struct probeValue f32Values[] = {
+    { errorClasses_zero, 0, 0x00000000 },
+    { errorClasses_zero, 0, 0x80000000 },
+    { errorClasses_subnormal, 0, 0x00000001 },
+    { errorClasses_subnormal, 0, 0x007FFFFF },
+    { errorClasses_subnormal, 0, 0x80000001 },
+    { errorClasses_subnormal, 0, 0x807FFFFF },
+    { errorClasses_normal, 0, 0x00800000 },
+    { errorClasses_normal, 0, 0x3F800000 },
+    { errorClasses_normal, 0, 0x7F7FFFFF },
+    { errorClasses_normal, 0, 0x80800000 },
+    { errorClasses_normal, 0, 0xBF800000 },
+    { errorClasses_normal, 0, 0xFF7FFFFF },
+    { errorClasses_infinity, 0, 0x7F800000 },
+    { errorClasses_infinity, 0, 0xFF800000 },
+    { errorClasses_qNaN, 0, 0x7FC00000 },
+    { errorClasses_qNaN, 0, 0xFFC00001 },
+    { errorClasses_sNaN, 0, 0x7F800001 },
+    { errorClasses_sNaN, 0, 0xFFBFFFFF }
+};
+
+static const struct probeValue f64Values[] = {
+    { errorClasses_zero, 0, UINT64_C( 0x0000000000000000 ) },
+    { errorClasses_zero, 0, UINT64_C( 0x8000000000000000 ) },
+    { errorClasses_subnormal, 0, UINT64_C( 0x0000000000000001 ) },
+    { errorClasses_subnormal, 0, UINT64_C( 0x000FFFFFFFFFFFFF ) },
+    { errorClasses_subnormal, 0, UINT64_C( 0x8000000000000001 ) },
+    { errorClasses_subnormal, 0, UINT64_C( 0x800FFFFFFFFFFFFF ) },
+    { errorClasses_normal, 0, UINT64_C( 0x0010000000000000 ) },
+    { errorClasses_normal, 0, UINT64_C( 0x3FF0000000000000 ) },
+    { errorClasses_normal, 0, UINT64_C( 0x7FEFFFFFFFFFFFFF ) },
+    { errorClasses_normal, 0, UINT64_C( 0x8010000000000000 ) },
+    { errorClasses_normal, 0, UINT64_C( 0xBFF0000000000000 ) },
+    { errorClasses_normal, 0, UINT64_C( 0xFFEFFFFFFFFFFFFF ) },
+    { errorClasses_infinity, 0, UINT64_C( 0x7FF0000000000000 ) },
+    { errorClasses_infinity, 0, UINT64_C( 0xFFF0000000000000 ) },
+    { errorClasses_qNaN, 0, UINT64_C( 0x7FF8000000000000 ) },
+    { errorClasses_qNaN, 0, UINT64_C( 0xFFF8000000000001 ) },
+    { errorClasses_sNaN, 0, UINT64_C( 0x7FF0000000000001 ) },
+    { errorClasses_sNaN, 0, UINT64_C( 0xFFF7FFFFFFFFFFFF ) }
+};
+
+#ifdef EXTFLOAT80
+
+static const struct probeValue extF80Values[] = {
+    { errorClasses_zero, 0x0000, 0 },
+    { errorClasses_zero, 0x8000, 0 },
+    { errorClasses_subnormal, 0x0000, 1 },
+    { errorClasses_subnormal, 0x0000, UINT64_C( 0x7FFFFFFFFFFFFFFF ) },
+    { errorClasses_subnormal, 0x8000, 1 },
+    { errorClasses_subnormal, 0x8000, UINT64_C( 0x7FFFFFFFFFFFFFFF ) },
+    { errorClasses_normal, 0x0001, UINT64_C( 0x8000000000000000 ) },
+    { errorClasses_normal, 0x3FFF, UINT64_C( 0x8000000000000000 ) },
+    { errorClasses_normal, 0x7FFE, UINT64_C( 0xFFFFFFFFFFFFFFFF ) },
+    { errorClasses_normal, 0x8001, UINT64_C( 0x8000000000000000 ) },
+    { errorClasses_normal, 0xBFFF, UINT64_C( 0x8000000000000000 ) },
+    { errorClasses_normal, 0xFFFE, UINT64_C( 0xFFFFFFFFFFFFFFFF ) },
+    { errorClasses_infinity, 0x7FFF, UINT64_C( 0x8000000000000000 ) },
+    { errorClasses_infinity, 0xFFFF, UINT64_C( 0x8000000000000000 ) },
+    { errorClasses_qNaN, 0x7FFF, UINT64_C( 0xC000000000000000 ) },
+    { errorClasses_qNaN, 0xFFFF, UINT64_C( 0xC000000000000001 ) },
+    { errorClasses_sNaN, 0x7FFF, UINT64_C( 0x8000000000000001 ) },
+    { errorClasses_sNaN, 0xFFFF, UINT64_C( 0xBFFFFFFFFFFFFFFF ) }
+};
+
+#endif
+
+#ifdef FLOAT128
+
+static const struct probeValue f128Values[] = {
+    { errorClasses_zero, UINT64_C( 0x0000000000000000 ), 0 },
+    { errorClasses_zero, UINT64_C( 0x8000000000000000 ), 0 },
+    { errorClasses_subnormal, UINT64_C( 0x0000000000000000 ), 1 },
+    {
+        errorClasses_subnormal,
+        UINT64_C( 0x0000FFFFFFFFFFFF ),
+        UINT64_C( 0xFFFFFFFFFFFFFFFF )
+    },
+    { errorClasses_subnormal, UINT64_C( 0x8000000000000000 ), 1 },
+    {
+        errorClasses_subnormal,
+        UINT64_C( 0x8000FFFFFFFFFFFF ),
+        UINT64_C( 0xFFFFFFFFFFFFFFFF )
+    },
+    { errorClasses_normal, UINT64_C( 0x0001000000000000 ), 0 },
+    { errorClasses_normal, UINT64_C( 0x3FFF000000000000 ), 0 },
+    {
+        errorClasses_normal,
+        UINT64_C( 0x7FFEFFFFFFFFFFFF ),
+        UINT64_C( 0xFFFFFFFFFFFFFFFF )
+    },
+    { errorClasses_normal, UINT64_C( 0x8001000000000000 ), 0 },
+    { errorClasses_normal, UINT64_C( 0xBFFF000000000000 ), 0 },
+    {
+        errorClasses_normal,
+        UINT64_C( 0xFFFEFFFFFFFFFFFF ),
+        UINT64_C( 0xFFFFFFFFFFFFFFFF )
+    },
+    { errorClasses_infinity, UINT64_C( 0x7FFF000000000000 ), 0 },
+    { errorClasses_infinity, UINT64_C( 0xFFFF000000000000 ), 0 },
+    { errorClasses_qNaN, UINT64_C( 0x7FFF800000000000 ), 0 },
+    { errorClasses_qNaN, UINT64_C( 0xFFFF800000000000 ), 1 },
+    { errorClasses_sNaN, UINT64_C( 0x7FFF000000000000 ), 1 },
+    {
+        errorClasses_sNaN,
+        UINT64_C( 0xFFFF7FFFFFFFFFFF ),
+        UINT64_C( 0xFFFFFFFFFFFFFFFF )
+    }
+};
+
+#endif
+
+#define probeType( typeName, size, values )\
+    { typeName, size, values, sizeof values / sizeof *values }
+
+static const struct {
+    const char *typeNamePtr;
+    int size;
+    const struct probeValue *valuesPtr;
+    int numValues;
+} probeTypes[] = {
+    probeType( "ui32", 4, ui32Values ),
+    probeType( "i32", 4, ui32Values ),
+    probeType( "ui64", 8, ui64Values ),
+    probeType( "i64", 8, ui64Values ),
+    probeType( "f16", 2, f16Values ),
+    probeType( "bf16", 2, bf16Values ),
+    probeType( "f32", 4, f32Values ),
+    probeType( "f64", 8, f64Values ),
+#ifdef EXTFLOAT80
+    probeType( "extF80", 10, extF80Values ),
+#endif
+#ifdef FLOAT128
+    probeType( "f128", 16, f128Values ),
+#endif
+    { 0 }
+};
+
+static void addOperand( int size, const struct probeValue *valuePtr )
+{
+#ifdef EXTFLOAT80
+    struct extFloat80M extF80;
+#endif
+#ifdef FLOAT128
+    struct uint128 f128;
+#endif
+
+    switch ( size ) {
+     case 2:
+        corpus_ui16Operand( valuePtr->v0 );
+        break;
+     case 4:
+        corpus_ui32Operand( valuePtr->v0 );
+        break;
+     case 8:
+        corpus_ui64Operand( valuePtr->v0 );
+        break;
+#ifdef EXTFLOAT80
+     case 10:
+        extF80.signExp = valuePtr->v64;
+        extF80.signif = valuePtr->v0;
+        corpus_extF80MOperand( (const extFloat80_t *) &extF80 );
+        break;
+#endif
+#ifdef FLOAT128
+     case 16:
+        f128.v64 = valuePtr->v64;
+        f128.v0 = valuePtr->v0;
+        corpus_f128MOperand( (const float128_t *) &f128 );
+        break;
+#endif
+    }
+
+}
+
+uint_fast64_t failFast_makeProbe( const char *namePtr, int numOperands )
+{
+    size_t typeNameSize;
+    int typeNum, numValues, numClasses, class, i, operandNum, valueNum;
+    const struct probeValue *valuesPtr;
+    uint_fast64_t counts[errorClasses_numClasses];
+    int classes[errorClasses_numClasses];
+    long numOthers, otherNum, n;
+    int otherOperandNum;
+
+    if ( (numOperands < 1) || (3 < numOperands) ) return 0;
+    typeNameSize = strcspn( namePtr, "_" );
+    for ( typeNum = 0; probeTypes[typeNum].typeNamePtr; ++typeNum ) {
+        if (
+            (strlen( probeTypes[typeNum].typeNamePtr ) == typeNameSize)
+                && ! strncmp(
+                         probeTypes[typeNum].typeNamePtr,
+                         namePtr,
+                         typeNameSize
+                     )
+        ) {
+            break;
+        }
+    }
+    if ( ! probeTypes[typeNum].typeNamePtr ) return 0;
+    valuesPtr = probeTypes[typeNum].valuesPtr;
+    numValues = probeTypes[typeNum].numValues;
+    /*------------------------------------------------------------------------
+    | The classes with failures, most failures first.
+    *------------------------------------------------------------------------*/
+    memset( counts, 0, sizeof counts );
+    corpus_countClasses( namePtr, counts );
+    for ( class = 0; class < errorClasses_numClasses; ++class ) {
+        if ( counts[class] ) break;
+    }
+    if ( class == errorClasses_numClasses ) corpus_countClasses( 0, counts );
+    numClasses = 0;
+    for ( class = 0; class < errorClasses_numClasses; ++class ) {
+        if ( ! counts[class] ) continue;
+        for (
+            i = numClasses;
+            i && (counts[classes[i - 1]] < counts[class]);
+            --i
+        ) {
+            classes[i] = classes[i - 1];
+        }
+        classes[i] = class;
+        ++numClasses;
+    }
+    if ( ! numClasses ) return 0;
+    /*------------------------------------------------------------------------
+    | For each class in turn, each operand in turn takes the class's values
+    | while the others take all values.  A case made more than once is kept
+    | only the first time.
+    *------------------------------------------------------------------------*/
+    corpus_clearReplay();
+    numOthers = 1;
+    for ( i = 1; i < numOperands; ++i ) numOthers *= numValues;
+    for ( i = 0; i < numClasses; ++i ) {
+        for ( operandNum = 0; operandNum < numOperands; ++operandNum ) {
+            for ( valueNum = 0; valueNum < numValues; ++valueNum ) {
+                if ( valuesPtr[valueNum].class != classes[i] ) continue;
+                for ( otherNum = 0; otherNum < numOthers; ++otherNum ) {
+                    n = otherNum;
+                    for (
+                        otherOperandNum = 0;
+                        otherOperandNum < numOperands;
+                        ++otherOperandNum
+                    ) {
+                        if ( otherOperandNum == operandNum ) {
+                            addOperand(
+                                probeTypes[typeNum].size,
+                                &valuesPtr[valueNum]
+                            );
+                        } else {
+                            addOperand(
+                                probeTypes[typeNum].size,
+                                &valuesPtr[n % numValues]
+                            );
+                            n /= numValues;
+                        }
+                    }
+                    corpus_addReplayCase( namePtr );
+                }
+            }
+        }
+    }
+    return corpus_numCases( namePtr, -1, -1 );
+
+}
+
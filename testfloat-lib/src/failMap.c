@@ -0,0 +1,226 @@
+
+/*============================================================================
+
+This C source file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "platform.h"
+#include "fail.h"
+#include "genCases.h"
+#include "verCases.h"
+#include "failMap.h"
+
+bool failMap_active = false;
+uint_fast32_t failMap_maxErrorCount;
+
+static const char failMapMagic[8] = "TFFMAP1";
+
+/*----------------------------------------------------------------------------
+| In a failure map file, `failMapMagic' is followed by the maps, one after
+| another.  Each map starts with:  the length of the function's name, in a
+| single byte; the name; the rounding code and the rounding precision, in a
+| byte each (as in `verCases_roundingCode' and `verCases_roundingPrecision');
+| the total number of cases, in 8 bytes; and the number of tiles that
+| follow, in 4 bytes.  Each tile is its number, in 4 bytes, and then the
+| bits of its cases, case `tileNum * 65536 + i' being bit `i % 8' of byte
+| `i / 8'.  All numbers are written least-significant byte first.  For an
+| exhaustive test, the number of a case is the bit pattern of its operand,
+| or of its two 16-bit operands with `a' in the upper half.
+*----------------------------------------------------------------------------*/
+enum {
+    tileNumBits  = 16,
+    tileNumCases = 1<<tileNumBits,
+    tileSize     = tileNumCases / 8
+};
+
+struct failMap_part {
+    unsigned char **tiles;
+    size_t numTiles;
+};
+
+static const char *path;
+static FILE *file;
+static THREAD_LOCAL struct failMap_part map;
+
+void failMap_open( const char *newPath )
+{
+
+    file = fopen( newPath, "wb" );
+    if ( ! file ) fail( "Cannot write `%s'", newPath );
+    fwrite( failMapMagic, sizeof failMapMagic, 1, file );
+    path = newPath;
+    failMap_maxErrorCount = verCases_maxErrorCount;
+    verCases_maxErrorCount = 0;
+    failMap_active = true;
+
+}
+
+static unsigned char *tileAt( size_t tileNum )
+{
+    size_t newNumTiles;
+    unsigned char **newTiles;
+    unsigned char *tilePtr;
+
+    if ( map.numTiles <= tileNum ) {
+        newNumTiles = tileNum + 1;
+        if ( newNumTiles < 2 * map.numTiles ) newNumTiles = 2 * map.numTiles;
+        newTiles = realloc( map.tiles, newNumTiles * sizeof *newTiles );
+        if ( ! newTiles ) fail( "Out of memory" );
+        memset(
+            newTiles + map.numTiles,
+            0,
+            (newNumTiles - map.numTiles) * sizeof *newTiles
+        );
+        map.tiles = newTiles;
+        map.numTiles = newNumTiles;
+    }
+    tilePtr = map.tiles[tileNum];
+    if ( ! tilePtr ) {
+        tilePtr = calloc( tileSize, 1 );
+        if ( ! tilePtr ) fail( "Out of memory" );
+        map.tiles[tileNum] = tilePtr;
+    }
+    return tilePtr;
+
+}
+
+void failMap_add( uint_fast64_t caseNum )
+{
+    unsigned char *tilePtr;
+
+    tilePtr = tileAt( caseNum>>tileNumBits );
+    caseNum &= tileNumCases - 1;
+    tilePtr[caseNum>>3] |= 1<<(caseNum & 7);
+
+}
+
+struct failMap_part *failMap_endPart( void )
+{
+    struct failMap_part *partPtr;
+
+    partPtr = malloc( sizeof *partPtr );
+    if ( ! partPtr ) fail( "Out of memory" );
+    *partPtr = map;
+    map.tiles = 0;
+    map.numTiles = 0;
+    return partPtr;
+
+}
+
+void failMap_addPart( struct failMap_part *partPtr )
+{
+    size_t tileNum;
+    unsigned char *partTilePtr, *tilePtr;
+    int i;
+
+    for ( tileNum = 0; tileNum < partPtr->numTiles; ++tileNum ) {
+        partTilePtr = partPtr->tiles[tileNum];
+        if ( ! partTilePtr ) continue;
+        tilePtr = tileAt( tileNum );
+        for ( i = 0; i < tileSize; ++i ) tilePtr[i] |= partTilePtr[i];
+        free( partTilePtr );
+    }
+    free( partPtr->tiles );
+    free( partPtr );
+
+}
+
+uint_fast64_t failMap_nextCase( uint_fast64_t caseNum )
+{
+    size_t tileNum;
+    unsigned char *tilePtr;
+    int i;
+
+    tileNum = caseNum>>tileNumBits;
+    i = caseNum & (tileNumCases - 1);
+    for ( ; tileNum < map.numTiles; ++tileNum, i = 0 ) {
+        tilePtr = map.tiles[tileNum];
+        if ( ! tilePtr ) continue;
+        for ( ; i < tileNumCases; ++i ) {
+            if ( ! tilePtr[i>>3] ) {
+                i |= 7;
+                continue;
+            }
+            if ( tilePtr[i>>3] & (1<<(i & 7)) ) {
+                return (uint_fast64_t) tileNum<<tileNumBits | i;
+            }
+        }
+    }
+    return UINT64_MAX;
+
+}
+
+static void putBytes( uint_fast64_t v, int size )
+{
+
+    for ( ; size; --size ) {
+        fputc( v & 0xFF, file );
+        v >>= 8;
+    }
+
+}
+
+void failMap_finishInstance( void )
+{
+    size_t numUsedTiles, tileNum, nameSize;
+
+    numUsedTiles = 0;
+    for ( tileNum = 0; tileNum < map.numTiles; ++tileNum ) {
+        if ( map.tiles[tileNum] ) ++numUsedTiles;
+    }
+    if ( ! numUsedTiles ) return;
+    nameSize = strlen( verCases_functionNamePtr );
+    if ( 255 < nameSize ) nameSize = 255;
+    putBytes( nameSize, 1 );
+    fwrite( verCases_functionNamePtr, nameSize, 1, file );
+    putBytes( verCases_roundingCode, 1 );
+    putBytes( verCases_roundingPrecision, 1 );
+    putBytes( genCases_total, 8 );
+    putBytes( numUsedTiles, 4 );
+    for ( tileNum = 0; tileNum < map.numTiles; ++tileNum ) {
+        if ( ! map.tiles[tileNum] ) continue;
+        putBytes( tileNum, 4 );
+        fwrite( map.tiles[tileNum], tileSize, 1, file );
+        free( map.tiles[tileNum] );
+        map.tiles[tileNum] = 0;
+    }
+    if ( fflush( file ) || ferror( file ) ) fail( "Cannot write `%s'", path );
+
+}
+
@@ -0,0 +1,163 @@
+
+/*============================================================================
+
+This C source file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "platform.h"
+#include "fail.h"
+#include "functions.h"
+#include "subjfloat.h"
+#include "functionRegistry.h"
+
+/*----------------------------------------------------------------------------
+| `hashTable' is an open-addressed table of the indexes of the standard
+| functions plus one, by the hash of their names, with zero for an unused
+| slot.  It holds at most half as many functions as it has slots.
+*----------------------------------------------------------------------------*/
+enum { hashTableSize = 1024 };
+
+static uint16_t hashTable[hashTableSize];
+static void (**allSubjFunctions)();
+static int numStandardFunctions;
+static bool selected = false;
+
+void (**functionRegistry_subjFunctions)();
+
+static uint_fast32_t hashName( const char *namePtr )
+{
+    uint_fast32_t hash;
+
+    hash = 2166136261U;
+    while ( *namePtr ) {
+        hash = ((hash ^ (unsigned char) *namePtr++) * 16777619U) & 0xFFFFFFFF;
+    }
+    return hash;
+
+}
+
+int functionRegistry_find( const char *namePtr )
+{
+    uint_fast32_t slot;
+    int standardFunctionNum;
+
+    slot = hashName( namePtr );
+    for (;;) {
+        slot &= hashTableSize - 1;
+        if ( ! hashTable[slot] ) return -1;
+        standardFunctionNum = hashTable[slot] - 1;
+        if (
+            ! strcmp(
+                  standardFunctionInfos[standardFunctionNum].namePtr, namePtr )
+        ) {
+            return standardFunctionNum;
+        }
+        ++slot;
+    }
+
+}
+
+void functionRegistry_init( void )
+{
+    int i, standardFunctionNum;
+    uint_fast32_t slot;
+    const struct subjFunctionInfo *subjInfoPtr;
+
+    if ( allSubjFunctions ) return;
+    for (
+        numStandardFunctions = 0;
+        standardFunctionInfos[numStandardFunctions].namePtr;
+        ++numStandardFunctions
+    ) {
+        continue;
+    }
+    if ( hashTableSize < 2 * numStandardFunctions ) {
+        fail( "Function registry too small" );
+    }
+    for ( i = 0; i < numStandardFunctions; ++i ) {
+        slot = hashName( standardFunctionInfos[i].namePtr );
+        for (;;) {
+            slot &= hashTableSize - 1;
+            if ( ! hashTable[slot] ) break;
+            ++slot;
+        }
+        hashTable[slot] = i + 1;
+    }
+    allSubjFunctions =
+        calloc( numStandardFunctions, sizeof *allSubjFunctions );
+    functionRegistry_subjFunctions =
+        malloc(
+            numStandardFunctions * sizeof *functionRegistry_subjFunctions );
+    if ( ! allSubjFunctions || ! functionRegistry_subjFunctions ) {
+        fail( "Out of memory" );
+    }
+    for (
+        subjInfoPtr = subjfloat_functions;
+        subjInfoPtr->namePtr;
+        ++subjInfoPtr
+    ) {
+        standardFunctionNum = functionRegistry_find( subjInfoPtr->namePtr );
+        if ( standardFunctionNum < 0 ) {
+            fail( "Unknown subject function '%s'", subjInfoPtr->namePtr );
+        }
+        allSubjFunctions[standardFunctionNum] = subjInfoPtr->functionPtr;
+    }
+    memcpy(
+        functionRegistry_subjFunctions,
+        allSubjFunctions,
+        numStandardFunctions * sizeof *functionRegistry_subjFunctions
+    );
+
+}
+
+bool functionRegistry_select( int standardFunctionNum )
+{
+
+    if ( ! selected ) {
+        memset(
+            functionRegistry_subjFunctions,
+            0,
+            numStandardFunctions * sizeof *functionRegistry_subjFunctions
+        );
+        selected = true;
+    }
+    functionRegistry_subjFunctions[standardFunctionNum] =
+        allSubjFunctions[standardFunctionNum];
+    return allSubjFunctions[standardFunctionNum] != 0;
+
+}
+
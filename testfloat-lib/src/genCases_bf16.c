@@ -37,10 +37,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 #include "platform.h"
 #include "random.h"
 #include "softfloat.h"
 #include "genCases.h"
+#include "corpus.h"
+#include "writeHex.h"
 
 struct sequence {
     int expNum, term1Num, term2Num;
@@ -354,29 +357,192 @@ static float16_t bf16Random( void )
 
 }
 
-static struct sequence sequenceA, sequenceB, sequenceC;
-static float16_t currentA, currentB, currentC;
-static int subcase;
+/*----------------------------------------------------------------------------
+| Like `f32Quick' in `genCases_f32.c', for bf16.
+*----------------------------------------------------------------------------*/
+static float16_t bf16Quick( const uint16_t *q, int numQ, int operandNum )
+{
+    int stratum, caseNum;
+    uint_fast16_t uiQ, exp, expEnd, sig;
+    union ui16_bf16 uZ;
+
+    stratum = genCases_quickStrata[operandNum];
+    caseNum = genCases_quickCaseNum;
+    uiQ = q[stratum];
+    exp = uiQ & 0x7F80;
+    sig = (caseNum < bf16NumP1) ? bf16P1[caseNum] : random_ui16() & 0x007F;
+    if ( ! exp || (exp == 0x7F80) ) {
+        if ( caseNum && ! sig ) sig = 1;
+        uZ.ui = uiQ | sig;
+        return uZ.f;
+    }
+    expEnd = exp + 0x0080;
+    if (
+           (stratum + 1 < numQ) && ! ((uiQ ^ q[stratum + 1]) & 0x8000)
+        && ((q[stratum + 1] & 0x7F80) != 0x7F80)
+    ) {
+        expEnd = q[stratum + 1] & 0x7F80;
+    }
+    if ( caseNum == 1 ) {
+        exp = expEnd - 0x0080;
+    } else if ( caseNum ) {
+        exp += (uint_fast16_t) randomN_ui8( (expEnd - exp)>>7 )<<7;
+    }
+    uZ.ui = (uiQ & 0x8000) | exp | sig;
+    return uZ.f;
+
+}
+
+static THREAD_LOCAL struct sequence sequenceA, sequenceB, sequenceC;
+static THREAD_LOCAL float16_t currentA, currentB, currentC;
+static THREAD_LOCAL int subcase;
+
+THREAD_LOCAL float16_t genCases_bf16_a, genCases_bf16_b, genCases_bf16_c;
+
+static void writeCaseA( void )
+{
+
+    writeHex_bf16( genCases_bf16_a, 0 );
+
+}
+
+static void writeCaseAB( void )
+{
+
+    writeHex_bf16( genCases_bf16_a, ' ' );
+    writeHex_bf16( genCases_bf16_b, 0 );
+
+}
+
+static void writeCaseABC( void )
+{
+
+    writeHex_bf16( genCases_bf16_a, ' ' );
+    writeHex_bf16( genCases_bf16_b, ' ' );
+    writeHex_bf16( genCases_bf16_c, 0 );
+
+}
+
+/*----------------------------------------------------------------------------
+| Sets `sequencePtr' to its entry `entryNum', where each exponent has
+| `numSigs' entries.
+*----------------------------------------------------------------------------*/
+static void
+ seekSequence(
+     struct sequence *sequencePtr, uint_fast64_t entryNum, int numSigs )
+{
+
+    sequencePtr->expNum = entryNum / numSigs;
+    sequencePtr->term1Num = entryNum % numSigs;
+    sequencePtr->term2Num = 0;
+    sequencePtr->done = false;
+
+}
+
+/*----------------------------------------------------------------------------
+| Each of these sets the state of the matching `_next' function for it to
+| give case `caseNum'.  The values from the sequences that come before the
+| case are found again from their places in the sequences.
+*----------------------------------------------------------------------------*/
+static void seekA( uint_fast64_t caseNum )
+{
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 3;
+        seekSequence( &sequenceA, caseNum / 3, bf16NumP1 );
+    } else {
+        subcase = caseNum % 2;
+        seekSequence( &sequenceA, caseNum / 2, bf16NumP2 );
+    }
+
+}
+
+static void seekAB( uint_fast64_t caseNum )
+{
+    uint_fast64_t groupNum;
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 6;
+        groupNum = caseNum / 6;
+        seekSequence( &sequenceA, groupNum / bf16NumQInP1, bf16NumP1 );
+        currentA = bf16NextQInP1( &sequenceA );
+        seekSequence( &sequenceB, groupNum % bf16NumQInP1, bf16NumP1 );
+        if ( subcase ) currentB = bf16NextQInP1( &sequenceB );
+    } else {
+        subcase = caseNum % 2;
+        groupNum = caseNum / 2;
+        seekSequence( &sequenceA, groupNum / bf16NumQInP2, bf16NumP2 );
+        currentA = bf16NextQInP2( &sequenceA );
+        seekSequence( &sequenceB, groupNum % bf16NumQInP2, bf16NumP2 );
+    }
+
+}
+
+static void seekABC( uint_fast64_t caseNum )
+{
+    uint_fast64_t groupNum;
 
-float16_t genCases_bf16_a, genCases_bf16_b, genCases_bf16_c;
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 9;
+        groupNum = caseNum / 9;
+        seekSequence(
+            &sequenceA, groupNum / (bf16NumQInP1 * bf16NumQInP1), bf16NumP1 );
+        currentA = bf16NextQInP1( &sequenceA );
+        seekSequence(
+            &sequenceB, groupNum / bf16NumQInP1 % bf16NumQInP1, bf16NumP1 );
+        currentB = bf16NextQInP1( &sequenceB );
+        seekSequence( &sequenceC, groupNum % bf16NumQInP1, bf16NumP1 );
+        if ( subcase ) currentC = bf16NextQInP1( &sequenceC );
+    } else {
+        subcase = caseNum % 2;
+        groupNum = caseNum / 2;
+        seekSequence(
+            &sequenceA, groupNum / (bf16NumQInP2 * bf16NumQInP2), bf16NumP2 );
+        currentA = bf16NextQInP2( &sequenceA );
+        seekSequence(
+            &sequenceB, groupNum / bf16NumQInP2 % bf16NumQInP2, bf16NumP2 );
+        currentB = bf16NextQInP2( &sequenceB );
+        seekSequence( &sequenceC, groupNum % bf16NumQInP2, bf16NumP2 );
+    }
+
+}
 
 void genCases_bf16_a_init( void )
 {
 
+    genCases_writeCase = writeCaseA;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( bf16NumQOut, 1 );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
     sequenceA.done = false;
     subcase = 0;
-    genCases_total =
-        (genCases_level == 1) ? 3 * bf16NumQOutP1 : 2 * bf16NumQOutP2;
-    genCases_done = false;
+    genCases_startCases(
+        (genCases_level == 1) ? 3 * bf16NumQOutP1 : 2 * bf16NumQOutP2 );
 
 }
 
 void genCases_bf16_a_next( void )
 {
 
+    if ( genCases_nextCase() ) seekA( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_bf16_a.v = corpus_ui16Case( 0 );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_bf16_a = bf16Quick( bf16QOut, bf16NumQOut, 0 );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -385,7 +551,6 @@ void genCases_bf16_a_next( void )
             break;
          case 2:
             genCases_bf16_a = bf16NextQOutP1( &sequenceA );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -396,7 +561,6 @@ void genCases_bf16_a_next( void )
             break;
          case 1:
             genCases_bf16_a = bf16NextQOutP2( &sequenceA );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -405,9 +569,30 @@ void genCases_bf16_a_next( void )
 
 }
 
+void genCases_bf16_a_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_bf16_a_next();
+
+}
+
 void genCases_bf16_ab_init( void )
 {
 
+    genCases_writeCase = writeCaseAB;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( bf16NumQIn, 2 );
+        return;
+    }
+    if ( genCases_exhaustive ) {
+        genCases_startCases( UINT64_C( 0x100000000 ) );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
@@ -424,13 +609,33 @@ void genCases_bf16_ab_init( void )
         genCases_total = 2 * bf16NumQInP2 * bf16NumQInP2;
         currentA = bf16NextQInP2( &sequenceA );
     }
-    genCases_done = false;
+    genCases_startCases( genCases_total );
 
 }
 
 void genCases_bf16_ab_next( void )
 {
 
+    if ( genCases_nextCase() && ! genCases_exhaustive ) {
+        seekAB( genCases_caseNum % genCases_total );
+    }
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_bf16_a.v = corpus_ui16Case( 0 );
+        genCases_bf16_b.v = corpus_ui16Case( 1 );
+        return;
+    }
+    if ( genCases_exhaustive ) {
+        genCases_bf16_a.v = genCases_caseNum>>16;
+        genCases_bf16_b.v = genCases_caseNum & 0xFFFF;
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_bf16_a = bf16Quick( bf16QIn, bf16NumQIn, 0 );
+        genCases_bf16_b = bf16Quick( bf16QIn, bf16NumQIn, 1 );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -455,7 +660,6 @@ void genCases_bf16_ab_next( void )
          case 5:
             genCases_bf16_a = currentA;
             genCases_bf16_b = currentB;
-            genCases_done = sequenceA.done & sequenceB.done;
             subcase = -1;
             break;
         }
@@ -472,7 +676,6 @@ void genCases_bf16_ab_next( void )
             }
             genCases_bf16_a = currentA;
             genCases_bf16_b = bf16NextQInP2( &sequenceB );
-            genCases_done = sequenceA.done & sequenceB.done;
             subcase = -1;
             break;
         }
@@ -481,9 +684,26 @@ void genCases_bf16_ab_next( void )
 
 }
 
+void genCases_bf16_ab_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_bf16_ab_next();
+
+}
+
 void genCases_bf16_abc_init( void )
 {
 
+    genCases_writeCase = writeCaseABC;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( bf16NumQIn, 3 );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
@@ -506,13 +726,28 @@ void genCases_bf16_abc_init( void )
         currentA = bf16NextQInP2( &sequenceA );
         currentB = bf16NextQInP2( &sequenceB );
     }
-    genCases_done = false;
+    genCases_startCases( genCases_total );
 
 }
 
 void genCases_bf16_abc_next( void )
 {
 
+    if ( genCases_nextCase() ) seekABC( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_bf16_a.v = corpus_ui16Case( 0 );
+        genCases_bf16_b.v = corpus_ui16Case( 1 );
+        genCases_bf16_c.v = corpus_ui16Case( 2 );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_bf16_a = bf16Quick( bf16QIn, bf16NumQIn, 0 );
+        genCases_bf16_b = bf16Quick( bf16QIn, bf16NumQIn, 1 );
+        genCases_bf16_c = bf16Quick( bf16QIn, bf16NumQIn, 2 );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -568,7 +803,6 @@ void genCases_bf16_abc_next( void )
             genCases_bf16_a = currentA;
             genCases_bf16_b = currentB;
             genCases_bf16_c = currentC;
-            genCases_done = sequenceA.done & sequenceB.done & sequenceC.done;
             subcase = -1;
             break;
         }
@@ -591,7 +825,6 @@ void genCases_bf16_abc_next( void )
             genCases_bf16_a = currentA;
             genCases_bf16_b = currentB;
             genCases_bf16_c = bf16NextQInP2( &sequenceC );
-            genCases_done = sequenceA.done & sequenceB.done & sequenceC.done;
             subcase = -1;
             break;
         }
@@ -600,3 +833,44 @@ void genCases_bf16_abc_next( void )
 
 }
 
+void genCases_bf16_abc_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_bf16_abc_next();
+
+}
+
+void genCases_bf16_writeState( FILE *file )
+{
+
+    fwrite( &sequenceA, sizeof sequenceA, 1, file );
+    fwrite( &sequenceB, sizeof sequenceB, 1, file );
+    fwrite( &sequenceC, sizeof sequenceC, 1, file );
+    fwrite( &currentA, sizeof currentA, 1, file );
+    fwrite( &currentB, sizeof currentB, 1, file );
+    fwrite( &currentC, sizeof currentC, 1, file );
+    fwrite( &subcase, sizeof subcase, 1, file );
+    fwrite( &genCases_bf16_a, sizeof genCases_bf16_a, 1, file );
+    fwrite( &genCases_bf16_b, sizeof genCases_bf16_b, 1, file );
+    fwrite( &genCases_bf16_c, sizeof genCases_bf16_c, 1, file );
+
+}
+
+bool genCases_bf16_readState( FILE *file )
+{
+
+    return
+        fread( &sequenceA, sizeof sequenceA, 1, file )
+            && fread( &sequenceB, sizeof sequenceB, 1, file )
+            && fread( &sequenceC, sizeof sequenceC, 1, file )
+            && fread( &currentA, sizeof currentA, 1, file )
+            && fread( &currentB, sizeof currentB, 1, file )
+            && fread( &currentC, sizeof currentC, 1, file )
+            && fread( &subcase, sizeof subcase, 1, file )
+            && fread( &genCases_bf16_a, sizeof genCases_bf16_a, 1, file )
+            && fread( &genCases_bf16_b, sizeof genCases_bf16_b, 1, file )
+            && fread( &genCases_bf16_c, sizeof genCases_bf16_c, 1, file );
+
+}
+
@@ -37,8 +37,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 #include "platform.h"
 #include "fail.h"
+#include "random.h"
 #include "genCases.h"
 
 int genCases_level = 0;
@@ -53,6 +55,193 @@ void genCases_setLevel( int newLevel )
 
 }
 
-uint_fast64_t genCases_total;
-bool genCases_done;
+THREAD_LOCAL uint_fast64_t genCases_total;
+THREAD_LOCAL bool genCases_done;
+THREAD_LOCAL void (*genCases_writeCase)( void );
+
+/*----------------------------------------------------------------------------
+| Case `caseNum' draws its random numbers from the run of the thread's stream
+| that starts at byte `caseNum<<caseRandomShift'.
+*----------------------------------------------------------------------------*/
+enum { caseRandomShift = 20 };
+
+THREAD_LOCAL uint_fast64_t genCases_caseNum;
+THREAD_LOCAL uint_fast64_t genCases_firstCaseNum;
+
+static THREAD_LOCAL int partNum, numParts;
+static THREAD_LOCAL uint_fast64_t caseStream, nextCaseNum, endCaseNum;
+static THREAD_LOCAL bool seeking;
+
+void genCases_setPart( int newPartNum, int newNumParts )
+{
+
+    partNum = newPartNum;
+    numParts = newNumParts;
+
+}
+
+void genCases_endPart( void )
+{
+
+    if ( nextCaseNum < endCaseNum ) endCaseNum = nextCaseNum + 1;
+
+}
+
+void genCases_seek( uint_fast64_t caseNum )
+{
+
+    nextCaseNum = caseNum;
+    seeking = true;
+    genCases_done = false;
+
+}
+
+void genCases_startCases( uint_fast64_t total )
+{
+
+    genCases_total = total;
+    genCases_firstCaseNum = 0;
+    endCaseNum = total;
+    if ( 1 < numParts ) {
+        genCases_firstCaseNum = total * partNum / numParts;
+        endCaseNum = total * (partNum + 1) / numParts;
+    }
+    caseStream = random_getState().stream;
+    nextCaseNum = genCases_firstCaseNum;
+    seeking = (genCases_firstCaseNum != 0);
+    genCases_done = (genCases_firstCaseNum == endCaseNum);
+
+}
+
+bool genCases_nextCase( void )
+{
+    struct random_state state;
+    bool jumped;
+
+    genCases_caseNum = nextCaseNum++;
+    state.stream = caseStream;
+    state.count = (uint_fast64_t) genCases_caseNum<<caseRandomShift;
+    random_setState( state );
+    genCases_done = (nextCaseNum == endCaseNum);
+    jumped = seeking;
+    seeking = false;
+    return jumped;
+
+}
+
+int genCases_quick = 0;
+
+void genCases_setQuick( int numCases )
+{
+
+    if ( numCases < 1 ) {
+        fail( "Invalid number of cases per stratum %d", numCases );
+    }
+    genCases_quick = numCases;
+
+}
+
+bool genCases_exhaustive = false;
+
+THREAD_LOCAL int genCases_quickStrata[3];
+THREAD_LOCAL int genCases_quickCaseNum;
+THREAD_LOCAL uint_fast64_t genCases_quickNumStrata;
+
+static THREAD_LOCAL int quickNumStrata, quickNumOperands;
+
+void genCases_quickStart( int numStrata, int numOperands )
+{
+    int i;
+
+    quickNumStrata = numStrata;
+    quickNumOperands = numOperands;
+    genCases_quickNumStrata = 1;
+    for ( i = 0; i < numOperands; ++i ) genCases_quickNumStrata *= numStrata;
+    genCases_startCases( genCases_quickNumStrata * genCases_quick );
+
+}
+
+void genCases_quickNext( void )
+{
+    uint_fast64_t index;
+    int i;
+
+    /*------------------------------------------------------------------------
+    | The cases of one combination of strata are consecutive, and the last
+    | operand's stratum changes fastest.
+    *------------------------------------------------------------------------*/
+    index = genCases_caseNum % genCases_total;
+    genCases_quickCaseNum = index % genCases_quick;
+    index /= genCases_quick;
+    for ( i = quickNumOperands - 1; 0 <= i; --i ) {
+        genCases_quickStrata[i] = index % quickNumStrata;
+        index /= quickNumStrata;
+    }
+
+}
+
+void genCases_writeState( FILE *file )
+{
+
+    fwrite( &genCases_total, sizeof genCases_total, 1, file );
+    fwrite( &genCases_done, sizeof genCases_done, 1, file );
+    fwrite( &genCases_caseNum, sizeof genCases_caseNum, 1, file );
+    fwrite( &caseStream, sizeof caseStream, 1, file );
+    fwrite( &nextCaseNum, sizeof nextCaseNum, 1, file );
+    fwrite( &endCaseNum, sizeof endCaseNum, 1, file );
+    genCases_ui32_writeState( file );
+    genCases_ui64_writeState( file );
+    genCases_i32_writeState( file );
+    genCases_i64_writeState( file );
+#ifdef FLOAT16
+    genCases_f16_writeState( file );
+#endif
+    genCases_bf16_writeState( file );
+    genCases_f32_writeState( file );
+#ifdef FLOAT64
+    genCases_f64_writeState( file );
+#endif
+#ifdef EXTFLOAT80
+    genCases_extF80_writeState( file );
+#endif
+#ifdef FLOAT128
+    genCases_f128_writeState( file );
+#endif
+
+}
+
+bool genCases_readState( FILE *file )
+{
+
+    if (
+           ! fread( &genCases_total, sizeof genCases_total, 1, file )
+        || ! fread( &genCases_done, sizeof genCases_done, 1, file )
+        || ! fread( &genCases_caseNum, sizeof genCases_caseNum, 1, file )
+        || ! fread( &caseStream, sizeof caseStream, 1, file )
+        || ! fread( &nextCaseNum, sizeof nextCaseNum, 1, file )
+        || ! fread( &endCaseNum, sizeof endCaseNum, 1, file )
+        || ! genCases_ui32_readState( file )
+        || ! genCases_ui64_readState( file )
+        || ! genCases_i32_readState( file )
+        || ! genCases_i64_readState( file )
+    ) {
+        return false;
+    }
+#ifdef FLOAT16
+    if ( ! genCases_f16_readState( file ) ) return false;
+#endif
+    if ( ! genCases_bf16_readState( file ) ) return false;
+    if ( ! genCases_f32_readState( file ) ) return false;
+#ifdef FLOAT64
+    if ( ! genCases_f64_readState( file ) ) return false;
+#endif
+#ifdef EXTFLOAT80
+    if ( ! genCases_extF80_readState( file ) ) return false;
+#endif
+#ifdef FLOAT128
+    if ( ! genCases_f128_readState( file ) ) return false;
+#endif
+    return true;
+
+}
 
@@ -37,10 +37,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 #include "platform.h"
 #include "random.h"
 #include "softfloat.h"
 #include "genCases.h"
+#include "corpus.h"
+#include "writeHex.h"
 
 #ifdef EXTFLOAT80
 
@@ -670,29 +673,214 @@ static void extF80Random( extFloat80_t *zPtr )
 
 }
 
-static struct sequence sequenceA, sequenceB, sequenceC;
-static extFloat80_t currentA, currentB, currentC;
-static int subcase;
+/*----------------------------------------------------------------------------
+| Like `f32Quick' in `genCases_f32.c', for extF80.
+*----------------------------------------------------------------------------*/
+static
+void
+ extF80Quick(
+     const uint16_t *q, int numQ, int operandNum, extFloat80_t *zPtr )
+{
+    struct extFloat80M *zSPtr;
+    int stratum, caseNum;
+    uint_fast16_t uiQ, exp, expEnd;
+    uint_fast64_t sig;
+
+    zSPtr = (struct extFloat80M *) zPtr;
+    stratum = genCases_quickStrata[operandNum];
+    caseNum = genCases_quickCaseNum;
+    sig =
+        (caseNum < extF80NumP1) ? extF80P1[caseNum]
+            : random_ui64() & UINT64_C( 0x7FFFFFFFFFFFFFFF );
+    uiQ = q[stratum];
+    exp = uiQ & 0x7FFF;
+    if ( ! exp || (exp == 0x7FFF) ) {
+        if ( caseNum && ! sig ) sig = 1;
+        if ( exp ) sig |= UINT64_C( 0x8000000000000000 );
+        zSPtr->signExp = uiQ;
+        zSPtr->signif  = sig;
+        return;
+    }
+    expEnd = exp + 1;
+    if (
+           (stratum + 1 < numQ) && ! ((uiQ ^ q[stratum + 1]) & 0x8000)
+        && ((q[stratum + 1] & 0x7FFF) != 0x7FFF)
+    ) {
+        expEnd = q[stratum + 1] & 0x7FFF;
+    }
+    if ( caseNum == 1 ) {
+        exp = expEnd - 1;
+    } else if ( caseNum ) {
+        exp += randomN_ui16( expEnd - exp );
+    }
+    zSPtr->signExp = (uiQ & 0x8000) | exp;
+    zSPtr->signif  = UINT64_C( 0x8000000000000000 ) | sig;
+
+}
+
+static THREAD_LOCAL struct sequence sequenceA, sequenceB, sequenceC;
+static THREAD_LOCAL extFloat80_t currentA, currentB, currentC;
+static THREAD_LOCAL int subcase;
+
+THREAD_LOCAL extFloat80_t
+ genCases_extF80_a, genCases_extF80_b, genCases_extF80_c;
+
+static void writeCaseA( void )
+{
+
+    writeHex_extF80M( &genCases_extF80_a, 0 );
+
+}
+
+static void writeCaseAB( void )
+{
+
+    writeHex_extF80M( &genCases_extF80_a, ' ' );
+    writeHex_extF80M( &genCases_extF80_b, 0 );
+
+}
+
+static void writeCaseABC( void )
+{
+
+    writeHex_extF80M( &genCases_extF80_a, ' ' );
+    writeHex_extF80M( &genCases_extF80_b, ' ' );
+    writeHex_extF80M( &genCases_extF80_c, 0 );
+
+}
+
+/*----------------------------------------------------------------------------
+| Sets `sequencePtr' to its entry `entryNum', where each exponent has
+| `numSigs' entries.
+*----------------------------------------------------------------------------*/
+static void
+ seekSequence(
+     struct sequence *sequencePtr, uint_fast64_t entryNum, int numSigs )
+{
+
+    sequencePtr->expNum = entryNum / numSigs;
+    sequencePtr->term1Num = entryNum % numSigs;
+    sequencePtr->term2Num = 0;
+    sequencePtr->done = false;
+
+}
+
+/*----------------------------------------------------------------------------
+| Each of these sets the state of the matching `_next' function for it to
+| give case `caseNum'.  The values from the sequences that come before the
+| case are found again from their places in the sequences.
+*----------------------------------------------------------------------------*/
+static void seekA( uint_fast64_t caseNum )
+{
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 3;
+        seekSequence( &sequenceA, caseNum / 3, extF80NumP1 );
+    } else {
+        subcase = caseNum % 2;
+        seekSequence( &sequenceA, caseNum / 2, extF80NumP2 );
+    }
+
+}
+
+static void seekAB( uint_fast64_t caseNum )
+{
+    uint_fast64_t groupNum;
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 6;
+        groupNum = caseNum / 6;
+        seekSequence( &sequenceA, groupNum / extF80NumQInP1, extF80NumP1 );
+        extF80NextQInP1( &sequenceA, &currentA );
+        seekSequence( &sequenceB, groupNum % extF80NumQInP1, extF80NumP1 );
+        if ( subcase ) extF80NextQInP1( &sequenceB, &currentB );
+    } else {
+        subcase = caseNum % 2;
+        groupNum = caseNum / 2;
+        seekSequence( &sequenceA, groupNum / extF80NumQInP2, extF80NumP2 );
+        extF80NextQInP2( &sequenceA, &currentA );
+        seekSequence( &sequenceB, groupNum % extF80NumQInP2, extF80NumP2 );
+    }
+
+}
 
-extFloat80_t genCases_extF80_a, genCases_extF80_b, genCases_extF80_c;
+static void seekABC( uint_fast64_t caseNum )
+{
+    uint_fast64_t groupNum;
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 9;
+        groupNum = caseNum / 9;
+        seekSequence(
+            &sequenceA,
+            groupNum / (extF80NumQInP1 * extF80NumQInP1),
+            extF80NumP1
+        );
+        extF80NextQInP1( &sequenceA, &currentA );
+        seekSequence(
+            &sequenceB,
+            groupNum / extF80NumQInP1 % extF80NumQInP1,
+            extF80NumP1
+        );
+        extF80NextQInP1( &sequenceB, &currentB );
+        seekSequence( &sequenceC, groupNum % extF80NumQInP1, extF80NumP1 );
+        if ( subcase ) extF80NextQInP1( &sequenceC, &currentC );
+    } else {
+        subcase = caseNum % 2;
+        groupNum = caseNum / 2;
+        seekSequence(
+            &sequenceA,
+            groupNum / (extF80NumQInP2 * extF80NumQInP2),
+            extF80NumP2
+        );
+        extF80NextQInP2( &sequenceA, &currentA );
+        seekSequence(
+            &sequenceB,
+            groupNum / extF80NumQInP2 % extF80NumQInP2,
+            extF80NumP2
+        );
+        extF80NextQInP2( &sequenceB, &currentB );
+        seekSequence( &sequenceC, groupNum % extF80NumQInP2, extF80NumP2 );
+    }
+
+}
 
 void genCases_extF80_a_init( void )
 {
 
+    genCases_writeCase = writeCaseA;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( extF80NumQOut, 1 );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
     sequenceA.done = false;
     subcase = 0;
-    genCases_total =
-        (genCases_level == 1) ? 3 * extF80NumQOutP1 : 2 * extF80NumQOutP2;
-    genCases_done = false;
+    genCases_startCases(
+        (genCases_level == 1) ? 3 * extF80NumQOutP1 : 2 * extF80NumQOutP2 );
 
 }
 
 void genCases_extF80_a_next( void )
 {
 
+    if ( genCases_nextCase() ) seekA( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        corpus_extF80MCase( 0, &genCases_extF80_a );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        extF80Quick( extF80QOut, extF80NumQOut, 0, &genCases_extF80_a );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -701,7 +889,6 @@ void genCases_extF80_a_next( void )
             break;
          case 2:
             extF80NextQOutP1( &sequenceA, &genCases_extF80_a );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -712,7 +899,6 @@ void genCases_extF80_a_next( void )
             break;
          case 1:
             extF80NextQOutP2( &sequenceA, &genCases_extF80_a );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -721,9 +907,26 @@ void genCases_extF80_a_next( void )
 
 }
 
+void genCases_extF80_a_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_extF80_a_next();
+
+}
+
 void genCases_extF80_ab_init( void )
 {
 
+    genCases_writeCase = writeCaseAB;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( extF80NumQIn, 2 );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
@@ -740,13 +943,26 @@ void genCases_extF80_ab_init( void )
         genCases_total = 2 * extF80NumQInP2 * extF80NumQInP2;
         extF80NextQInP2( &sequenceA, &currentA );
     }
-    genCases_done = false;
+    genCases_startCases( genCases_total );
 
 }
 
 void genCases_extF80_ab_next( void )
 {
 
+    if ( genCases_nextCase() ) seekAB( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        corpus_extF80MCase( 0, &genCases_extF80_a );
+        corpus_extF80MCase( 1, &genCases_extF80_b );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        extF80Quick( extF80QIn, extF80NumQIn, 0, &genCases_extF80_a );
+        extF80Quick( extF80QIn, extF80NumQIn, 1, &genCases_extF80_b );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -771,7 +987,6 @@ void genCases_extF80_ab_next( void )
          case 5:
             genCases_extF80_a = currentA;
             genCases_extF80_b = currentB;
-            genCases_done = sequenceA.done & sequenceB.done;
             subcase = -1;
             break;
         }
@@ -788,7 +1003,6 @@ void genCases_extF80_ab_next( void )
             }
             genCases_extF80_a = currentA;
             extF80NextQInP2( &sequenceB, &genCases_extF80_b );
-            genCases_done = sequenceA.done & sequenceB.done;
             subcase = -1;
             break;
         }
@@ -797,9 +1011,26 @@ void genCases_extF80_ab_next( void )
 
 }
 
+void genCases_extF80_ab_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_extF80_ab_next();
+
+}
+
 void genCases_extF80_abc_init( void )
 {
 
+    genCases_writeCase = writeCaseABC;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( extF80NumQIn, 3 );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
@@ -822,13 +1053,28 @@ void genCases_extF80_abc_init( void )
         extF80NextQInP2( &sequenceA, &currentA );
         extF80NextQInP2( &sequenceB, &currentB );
     }
-    genCases_done = false;
+    genCases_startCases( genCases_total );
 
 }
 
 void genCases_extF80_abc_next( void )
 {
 
+    if ( genCases_nextCase() ) seekABC( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        corpus_extF80MCase( 0, &genCases_extF80_a );
+        corpus_extF80MCase( 1, &genCases_extF80_b );
+        corpus_extF80MCase( 2, &genCases_extF80_c );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        extF80Quick( extF80QIn, extF80NumQIn, 0, &genCases_extF80_a );
+        extF80Quick( extF80QIn, extF80NumQIn, 1, &genCases_extF80_b );
+        extF80Quick( extF80QIn, extF80NumQIn, 2, &genCases_extF80_c );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -884,7 +1130,6 @@ void genCases_extF80_abc_next( void )
             genCases_extF80_a = currentA;
             genCases_extF80_b = currentB;
             genCases_extF80_c = currentC;
-            genCases_done = sequenceA.done & sequenceB.done & sequenceC.done;
             subcase = -1;
             break;
         }
@@ -907,7 +1152,6 @@ void genCases_extF80_abc_next( void )
             genCases_extF80_a = currentA;
             genCases_extF80_b = currentB;
             extF80NextQInP2( &sequenceC, &genCases_extF80_c );
-            genCases_done = sequenceA.done & sequenceB.done & sequenceC.done;
             subcase = -1;
             break;
         }
@@ -916,5 +1160,46 @@ void genCases_extF80_abc_next( void )
 
 }
 
+void genCases_extF80_abc_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_extF80_abc_next();
+
+}
+
+void genCases_extF80_writeState( FILE *file )
+{
+
+    fwrite( &sequenceA, sizeof sequenceA, 1, file );
+    fwrite( &sequenceB, sizeof sequenceB, 1, file );
+    fwrite( &sequenceC, sizeof sequenceC, 1, file );
+    fwrite( &currentA, sizeof currentA, 1, file );
+    fwrite( &currentB, sizeof currentB, 1, file );
+    fwrite( &currentC, sizeof currentC, 1, file );
+    fwrite( &subcase, sizeof subcase, 1, file );
+    fwrite( &genCases_extF80_a, sizeof genCases_extF80_a, 1, file );
+    fwrite( &genCases_extF80_b, sizeof genCases_extF80_b, 1, file );
+    fwrite( &genCases_extF80_c, sizeof genCases_extF80_c, 1, file );
+
+}
+
+bool genCases_extF80_readState( FILE *file )
+{
+
+    return
+        fread( &sequenceA, sizeof sequenceA, 1, file )
+            && fread( &sequenceB, sizeof sequenceB, 1, file )
+            && fread( &sequenceC, sizeof sequenceC, 1, file )
+            && fread( &currentA, sizeof currentA, 1, file )
+            && fread( &currentB, sizeof currentB, 1, file )
+            && fread( &currentC, sizeof currentC, 1, file )
+            && fread( &subcase, sizeof subcase, 1, file )
+            && fread( &genCases_extF80_a, sizeof genCases_extF80_a, 1, file )
+            && fread( &genCases_extF80_b, sizeof genCases_extF80_b, 1, file )
+            && fread( &genCases_extF80_c, sizeof genCases_extF80_c, 1, file );
+
+}
+
 #endif
 
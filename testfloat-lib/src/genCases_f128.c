@@ -37,11 +37,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 #include "platform.h"
 #include "uint128.h"
 #include "random.h"
 #include "softfloat.h"
 #include "genCases.h"
+#include "corpus.h"
+#include "writeHex.h"
 
 #ifdef FLOAT128
 
@@ -840,29 +843,204 @@ static void f128Random( float128_t *zPtr )
 
 }
 
-static struct sequence sequenceA, sequenceB, sequenceC;
-static float128_t currentA, currentB, currentC;
-static int subcase;
+/*----------------------------------------------------------------------------
+| Like `f32Quick' in `genCases_f32.c', for f128.
+*----------------------------------------------------------------------------*/
+static
+void
+ f128Quick( const uint64_t *q, int numQ, int operandNum, float128_t *zPtr )
+{
+    struct uint128 *uiZPtr;
+    int stratum, caseNum;
+    uint_fast64_t uiQ, exp, expEnd, sig64, sig0;
+
+    uiZPtr = (struct uint128 *) zPtr;
+    stratum = genCases_quickStrata[operandNum];
+    caseNum = genCases_quickCaseNum;
+    if ( caseNum < f128NumP1 ) {
+        sig64 = f128P1[caseNum].v64;
+        sig0  = f128P1[caseNum].v0;
+    } else {
+        sig64 = random_ui64() & UINT64_C( 0x0000FFFFFFFFFFFF );
+        sig0  = random_ui64();
+    }
+    uiQ = q[stratum];
+    exp = uiQ & UINT64_C( 0x7FFF000000000000 );
+    if ( ! exp || (exp == UINT64_C( 0x7FFF000000000000 )) ) {
+        if ( caseNum && ! (sig64 | sig0) ) sig0 = 1;
+        uiZPtr->v64 = uiQ | sig64;
+        uiZPtr->v0  = sig0;
+        return;
+    }
+    expEnd = exp + UINT64_C( 0x0001000000000000 );
+    if (
+           (stratum + 1 < numQ)
+        && ! ((uiQ ^ q[stratum + 1]) & UINT64_C( 0x8000000000000000 ))
+        && ((q[stratum + 1] & UINT64_C( 0x7FFF000000000000 ))
+                != UINT64_C( 0x7FFF000000000000 ))
+    ) {
+        expEnd = q[stratum + 1] & UINT64_C( 0x7FFF000000000000 );
+    }
+    if ( caseNum == 1 ) {
+        exp = expEnd - UINT64_C( 0x0001000000000000 );
+    } else if ( caseNum ) {
+        exp += (uint_fast64_t) randomN_ui16( (expEnd - exp)>>48 )<<48;
+    }
+    uiZPtr->v64 = (uiQ & UINT64_C( 0x8000000000000000 )) | exp | sig64;
+    uiZPtr->v0  = sig0;
+
+}
+
+static THREAD_LOCAL struct sequence sequenceA, sequenceB, sequenceC;
+static THREAD_LOCAL float128_t currentA, currentB, currentC;
+static THREAD_LOCAL int subcase;
+
+THREAD_LOCAL float128_t genCases_f128_a, genCases_f128_b, genCases_f128_c;
+
+static void writeCaseA( void )
+{
+
+    writeHex_f128M( &genCases_f128_a, 0 );
+
+}
+
+static void writeCaseAB( void )
+{
+
+    writeHex_f128M( &genCases_f128_a, ' ' );
+    writeHex_f128M( &genCases_f128_b, 0 );
+
+}
+
+static void writeCaseABC( void )
+{
 
-float128_t genCases_f128_a, genCases_f128_b, genCases_f128_c;
+    writeHex_f128M( &genCases_f128_a, ' ' );
+    writeHex_f128M( &genCases_f128_b, ' ' );
+    writeHex_f128M( &genCases_f128_c, 0 );
+
+}
+
+/*----------------------------------------------------------------------------
+| Sets `sequencePtr' to its entry `entryNum', where each exponent has
+| `numSigs' entries.
+*----------------------------------------------------------------------------*/
+static void
+ seekSequence(
+     struct sequence *sequencePtr, uint_fast64_t entryNum, int numSigs )
+{
+
+    sequencePtr->expNum = entryNum / numSigs;
+    sequencePtr->term1Num = entryNum % numSigs;
+    sequencePtr->term2Num = 0;
+    sequencePtr->done = false;
+
+}
+
+/*----------------------------------------------------------------------------
+| Each of these sets the state of the matching `_next' function for it to
+| give case `caseNum'.  The values from the sequences that come before the
+| case are found again from their places in the sequences.
+*----------------------------------------------------------------------------*/
+static void seekA( uint_fast64_t caseNum )
+{
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 3;
+        seekSequence( &sequenceA, caseNum / 3, f128NumP1 );
+    } else {
+        subcase = caseNum % 2;
+        seekSequence( &sequenceA, caseNum / 2, f128NumP2 );
+    }
+
+}
+
+static void seekAB( uint_fast64_t caseNum )
+{
+    uint_fast64_t groupNum;
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 6;
+        groupNum = caseNum / 6;
+        seekSequence( &sequenceA, groupNum / f128NumQInP1, f128NumP1 );
+        f128NextQInP1( &sequenceA, &currentA );
+        seekSequence( &sequenceB, groupNum % f128NumQInP1, f128NumP1 );
+        if ( subcase ) f128NextQInP1( &sequenceB, &currentB );
+    } else {
+        subcase = caseNum % 2;
+        groupNum = caseNum / 2;
+        seekSequence( &sequenceA, groupNum / f128NumQInP2, f128NumP2 );
+        f128NextQInP2( &sequenceA, &currentA );
+        seekSequence( &sequenceB, groupNum % f128NumQInP2, f128NumP2 );
+    }
+
+}
+
+static void seekABC( uint_fast64_t caseNum )
+{
+    uint_fast64_t groupNum;
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 9;
+        groupNum = caseNum / 9;
+        seekSequence(
+            &sequenceA, groupNum / (f128NumQInP1 * f128NumQInP1), f128NumP1 );
+        f128NextQInP1( &sequenceA, &currentA );
+        seekSequence(
+            &sequenceB, groupNum / f128NumQInP1 % f128NumQInP1, f128NumP1 );
+        f128NextQInP1( &sequenceB, &currentB );
+        seekSequence( &sequenceC, groupNum % f128NumQInP1, f128NumP1 );
+        if ( subcase ) f128NextQInP1( &sequenceC, &currentC );
+    } else {
+        subcase = caseNum % 2;
+        groupNum = caseNum / 2;
+        seekSequence(
+            &sequenceA, groupNum / (f128NumQInP2 * f128NumQInP2), f128NumP2 );
+        f128NextQInP2( &sequenceA, &currentA );
+        seekSequence(
+            &sequenceB, groupNum / f128NumQInP2 % f128NumQInP2, f128NumP2 );
+        f128NextQInP2( &sequenceB, &currentB );
+        seekSequence( &sequenceC, groupNum % f128NumQInP2, f128NumP2 );
+    }
+
+}
 
 void genCases_f128_a_init( void )
 {
 
+    genCases_writeCase = writeCaseA;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( f128NumQOut, 1 );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
     sequenceA.done = false;
     subcase = 0;
-    genCases_total =
-        (genCases_level == 1) ? 3 * f128NumQOutP1 : 2 * f128NumQOutP2;
-    genCases_done = false;
+    genCases_startCases(
+        (genCases_level == 1) ? 3 * f128NumQOutP1 : 2 * f128NumQOutP2 );
 
 }
 
 void genCases_f128_a_next( void )
 {
 
+    if ( genCases_nextCase() ) seekA( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        corpus_f128MCase( 0, &genCases_f128_a );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        f128Quick( f128QOut, f128NumQOut, 0, &genCases_f128_a );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -871,7 +1049,6 @@ void genCases_f128_a_next( void )
             break;
          case 2:
             f128NextQOutP1( &sequenceA, &genCases_f128_a );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -882,7 +1059,6 @@ void genCases_f128_a_next( void )
             break;
          case 1:
             f128NextQOutP2( &sequenceA, &genCases_f128_a );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -891,9 +1067,26 @@ void genCases_f128_a_next( void )
 
 }
 
+void genCases_f128_a_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_f128_a_next();
+
+}
+
 void genCases_f128_ab_init( void )
 {
 
+    genCases_writeCase = writeCaseAB;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( f128NumQIn, 2 );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
@@ -910,13 +1103,26 @@ void genCases_f128_ab_init( void )
         genCases_total = 2 * f128NumQInP2 * f128NumQInP2;
         f128NextQInP2( &sequenceA, &currentA );
     }
-    genCases_done = false;
+    genCases_startCases( genCases_total );
 
 }
 
 void genCases_f128_ab_next( void )
 {
 
+    if ( genCases_nextCase() ) seekAB( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        corpus_f128MCase( 0, &genCases_f128_a );
+        corpus_f128MCase( 1, &genCases_f128_b );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        f128Quick( f128QIn, f128NumQIn, 0, &genCases_f128_a );
+        f128Quick( f128QIn, f128NumQIn, 1, &genCases_f128_b );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -941,7 +1147,6 @@ void genCases_f128_ab_next( void )
          case 5:
             genCases_f128_a = currentA;
             genCases_f128_b = currentB;
-            genCases_done = sequenceA.done & sequenceB.done;
             subcase = -1;
             break;
         }
@@ -958,7 +1163,6 @@ void genCases_f128_ab_next( void )
             }
             genCases_f128_a = currentA;
             f128NextQInP2( &sequenceB, &genCases_f128_b );
-            genCases_done = sequenceA.done & sequenceB.done;
             subcase = -1;
             break;
         }
@@ -967,9 +1171,26 @@ void genCases_f128_ab_next( void )
 
 }
 
+void genCases_f128_ab_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_f128_ab_next();
+
+}
+
 void genCases_f128_abc_init( void )
 {
 
+    genCases_writeCase = writeCaseABC;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( f128NumQIn, 3 );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
@@ -992,13 +1213,28 @@ void genCases_f128_abc_init( void )
         f128NextQInP2( &sequenceA, &currentA );
         f128NextQInP2( &sequenceB, &currentB );
     }
-    genCases_done = false;
+    genCases_startCases( genCases_total );
 
 }
 
 void genCases_f128_abc_next( void )
 {
 
+    if ( genCases_nextCase() ) seekABC( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        corpus_f128MCase( 0, &genCases_f128_a );
+        corpus_f128MCase( 1, &genCases_f128_b );
+        corpus_f128MCase( 2, &genCases_f128_c );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        f128Quick( f128QIn, f128NumQIn, 0, &genCases_f128_a );
+        f128Quick( f128QIn, f128NumQIn, 1, &genCases_f128_b );
+        f128Quick( f128QIn, f128NumQIn, 2, &genCases_f128_c );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -1054,7 +1290,6 @@ void genCases_f128_abc_next( void )
             genCases_f128_a = currentA;
             genCases_f128_b = currentB;
             genCases_f128_c = currentC;
-            genCases_done = sequenceA.done & sequenceB.done & sequenceC.done;
             subcase = -1;
             break;
         }
@@ -1077,7 +1312,6 @@ void genCases_f128_abc_next( void )
             genCases_f128_a = currentA;
             genCases_f128_b = currentB;
             f128NextQInP2( &sequenceC, &genCases_f128_c );
-            genCases_done = sequenceA.done & sequenceB.done & sequenceC.done;
             subcase = -1;
             break;
         }
@@ -1086,5 +1320,46 @@ void genCases_f128_abc_next( void )
 
 }
 
+void genCases_f128_abc_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_f128_abc_next();
+
+}
+
+void genCases_f128_writeState( FILE *file )
+{
+
+    fwrite( &sequenceA, sizeof sequenceA, 1, file );
+    fwrite( &sequenceB, sizeof sequenceB, 1, file );
+    fwrite( &sequenceC, sizeof sequenceC, 1, file );
+    fwrite( &currentA, sizeof currentA, 1, file );
+    fwrite( &currentB, sizeof currentB, 1, file );
+    fwrite( &currentC, sizeof currentC, 1, file );
+    fwrite( &subcase, sizeof subcase, 1, file );
+    fwrite( &genCases_f128_a, sizeof genCases_f128_a, 1, file );
+    fwrite( &genCases_f128_b, sizeof genCases_f128_b, 1, file );
+    fwrite( &genCases_f128_c, sizeof genCases_f128_c, 1, file );
+
+}
+
+bool genCases_f128_readState( FILE *file )
+{
+
+    return
+        fread( &sequenceA, sizeof sequenceA, 1, file )
+            && fread( &sequenceB, sizeof sequenceB, 1, file )
+            && fread( &sequenceC, sizeof sequenceC, 1, file )
+            && fread( &currentA, sizeof currentA, 1, file )
+            && fread( &currentB, sizeof currentB, 1, file )
+            && fread( &currentC, sizeof currentC, 1, file )
+            && fread( &subcase, sizeof subcase, 1, file )
+            && fread( &genCases_f128_a, sizeof genCases_f128_a, 1, file )
+            && fread( &genCases_f128_b, sizeof genCases_f128_b, 1, file )
+            && fread( &genCases_f128_c, sizeof genCases_f128_c, 1, file );
+
+}
+
 #endif
 
@@ -37,10 +37,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 #include "platform.h"
 #include "random.h"
 #include "softfloat.h"
 #include "genCases.h"
+#include "corpus.h"
+#include "writeHex.h"
 
 #ifdef FLOAT16
 
@@ -335,29 +338,192 @@ static float16_t f16Random( void )
 
 }
 
-static struct sequence sequenceA, sequenceB, sequenceC;
-static float16_t currentA, currentB, currentC;
-static int subcase;
+/*----------------------------------------------------------------------------
+| Like `f32Quick' in `genCases_f32.c', for f16.
+*----------------------------------------------------------------------------*/
+static float16_t f16Quick( const uint16_t *q, int numQ, int operandNum )
+{
+    int stratum, caseNum;
+    uint_fast16_t uiQ, exp, expEnd, sig;
+    union ui16_f16 uZ;
+
+    stratum = genCases_quickStrata[operandNum];
+    caseNum = genCases_quickCaseNum;
+    uiQ = q[stratum];
+    exp = uiQ & 0x7C00;
+    sig = (caseNum < f16NumP1) ? f16P1[caseNum] : random_ui16() & 0x03FF;
+    if ( ! exp || (exp == 0x7C00) ) {
+        if ( caseNum && ! sig ) sig = 1;
+        uZ.ui = uiQ | sig;
+        return uZ.f;
+    }
+    expEnd = exp + 0x0400;
+    if (
+           (stratum + 1 < numQ) && ! ((uiQ ^ q[stratum + 1]) & 0x8000)
+        && ((q[stratum + 1] & 0x7C00) != 0x7C00)
+    ) {
+        expEnd = q[stratum + 1] & 0x7C00;
+    }
+    if ( caseNum == 1 ) {
+        exp = expEnd - 0x0400;
+    } else if ( caseNum ) {
+        exp += (uint_fast16_t) randomN_ui8( (expEnd - exp)>>10 )<<10;
+    }
+    uZ.ui = (uiQ & 0x8000) | exp | sig;
+    return uZ.f;
+
+}
+
+static THREAD_LOCAL struct sequence sequenceA, sequenceB, sequenceC;
+static THREAD_LOCAL float16_t currentA, currentB, currentC;
+static THREAD_LOCAL int subcase;
+
+THREAD_LOCAL float16_t genCases_f16_a, genCases_f16_b, genCases_f16_c;
+
+static void writeCaseA( void )
+{
+
+    writeHex_f16( genCases_f16_a, 0 );
+
+}
+
+static void writeCaseAB( void )
+{
+
+    writeHex_f16( genCases_f16_a, ' ' );
+    writeHex_f16( genCases_f16_b, 0 );
+
+}
+
+static void writeCaseABC( void )
+{
+
+    writeHex_f16( genCases_f16_a, ' ' );
+    writeHex_f16( genCases_f16_b, ' ' );
+    writeHex_f16( genCases_f16_c, 0 );
+
+}
+
+/*----------------------------------------------------------------------------
+| Sets `sequencePtr' to its entry `entryNum', where each exponent has
+| `numSigs' entries.
+*----------------------------------------------------------------------------*/
+static void
+ seekSequence(
+     struct sequence *sequencePtr, uint_fast64_t entryNum, int numSigs )
+{
+
+    sequencePtr->expNum = entryNum / numSigs;
+    sequencePtr->term1Num = entryNum % numSigs;
+    sequencePtr->term2Num = 0;
+    sequencePtr->done = false;
+
+}
+
+/*----------------------------------------------------------------------------
+| Each of these sets the state of the matching `_next' function for it to
+| give case `caseNum'.  The values from the sequences that come before the
+| case are found again from their places in the sequences.
+*----------------------------------------------------------------------------*/
+static void seekA( uint_fast64_t caseNum )
+{
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 3;
+        seekSequence( &sequenceA, caseNum / 3, f16NumP1 );
+    } else {
+        subcase = caseNum % 2;
+        seekSequence( &sequenceA, caseNum / 2, f16NumP2 );
+    }
+
+}
+
+static void seekAB( uint_fast64_t caseNum )
+{
+    uint_fast64_t groupNum;
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 6;
+        groupNum = caseNum / 6;
+        seekSequence( &sequenceA, groupNum / f16NumQInP1, f16NumP1 );
+        currentA = f16NextQInP1( &sequenceA );
+        seekSequence( &sequenceB, groupNum % f16NumQInP1, f16NumP1 );
+        if ( subcase ) currentB = f16NextQInP1( &sequenceB );
+    } else {
+        subcase = caseNum % 2;
+        groupNum = caseNum / 2;
+        seekSequence( &sequenceA, groupNum / f16NumQInP2, f16NumP2 );
+        currentA = f16NextQInP2( &sequenceA );
+        seekSequence( &sequenceB, groupNum % f16NumQInP2, f16NumP2 );
+    }
+
+}
+
+static void seekABC( uint_fast64_t caseNum )
+{
+    uint_fast64_t groupNum;
 
-float16_t genCases_f16_a, genCases_f16_b, genCases_f16_c;
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 9;
+        groupNum = caseNum / 9;
+        seekSequence(
+            &sequenceA, groupNum / (f16NumQInP1 * f16NumQInP1), f16NumP1 );
+        currentA = f16NextQInP1( &sequenceA );
+        seekSequence(
+            &sequenceB, groupNum / f16NumQInP1 % f16NumQInP1, f16NumP1 );
+        currentB = f16NextQInP1( &sequenceB );
+        seekSequence( &sequenceC, groupNum % f16NumQInP1, f16NumP1 );
+        if ( subcase ) currentC = f16NextQInP1( &sequenceC );
+    } else {
+        subcase = caseNum % 2;
+        groupNum = caseNum / 2;
+        seekSequence(
+            &sequenceA, groupNum / (f16NumQInP2 * f16NumQInP2), f16NumP2 );
+        currentA = f16NextQInP2( &sequenceA );
+        seekSequence(
+            &sequenceB, groupNum / f16NumQInP2 % f16NumQInP2, f16NumP2 );
+        currentB = f16NextQInP2( &sequenceB );
+        seekSequence( &sequenceC, groupNum % f16NumQInP2, f16NumP2 );
+    }
+
+}
 
 void genCases_f16_a_init( void )
 {
 
+    genCases_writeCase = writeCaseA;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( f16NumQOut, 1 );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
     sequenceA.done = false;
     subcase = 0;
-    genCases_total =
-        (genCases_level == 1) ? 3 * f16NumQOutP1 : 2 * f16NumQOutP2;
-    genCases_done = false;
+    genCases_startCases(
+        (genCases_level == 1) ? 3 * f16NumQOutP1 : 2 * f16NumQOutP2 );
 
 }
 
 void genCases_f16_a_next( void )
 {
 
+    if ( genCases_nextCase() ) seekA( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_f16_a.v = corpus_ui16Case( 0 );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_f16_a = f16Quick( f16QOut, f16NumQOut, 0 );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -366,7 +532,6 @@ void genCases_f16_a_next( void )
             break;
          case 2:
             genCases_f16_a = f16NextQOutP1( &sequenceA );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -377,7 +542,6 @@ void genCases_f16_a_next( void )
             break;
          case 1:
             genCases_f16_a = f16NextQOutP2( &sequenceA );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -386,9 +550,30 @@ void genCases_f16_a_next( void )
 
 }
 
+void genCases_f16_a_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_f16_a_next();
+
+}
+
 void genCases_f16_ab_init( void )
 {
 
+    genCases_writeCase = writeCaseAB;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( f16NumQIn, 2 );
+        return;
+    }
+    if ( genCases_exhaustive ) {
+        genCases_startCases( UINT64_C( 0x100000000 ) );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
@@ -405,13 +590,33 @@ void genCases_f16_ab_init( void )
         genCases_total = 2 * f16NumQInP2 * f16NumQInP2;
         currentA = f16NextQInP2( &sequenceA );
     }
-    genCases_done = false;
+    genCases_startCases( genCases_total );
 
 }
 
 void genCases_f16_ab_next( void )
 {
 
+    if ( genCases_nextCase() && ! genCases_exhaustive ) {
+        seekAB( genCases_caseNum % genCases_total );
+    }
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_f16_a.v = corpus_ui16Case( 0 );
+        genCases_f16_b.v = corpus_ui16Case( 1 );
+        return;
+    }
+    if ( genCases_exhaustive ) {
+        genCases_f16_a.v = genCases_caseNum>>16;
+        genCases_f16_b.v = genCases_caseNum & 0xFFFF;
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_f16_a = f16Quick( f16QIn, f16NumQIn, 0 );
+        genCases_f16_b = f16Quick( f16QIn, f16NumQIn, 1 );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -436,7 +641,6 @@ void genCases_f16_ab_next( void )
          case 5:
             genCases_f16_a = currentA;
             genCases_f16_b = currentB;
-            genCases_done = sequenceA.done & sequenceB.done;
             subcase = -1;
             break;
         }
@@ -453,7 +657,6 @@ void genCases_f16_ab_next( void )
             }
             genCases_f16_a = currentA;
             genCases_f16_b = f16NextQInP2( &sequenceB );
-            genCases_done = sequenceA.done & sequenceB.done;
             subcase = -1;
             break;
         }
@@ -462,9 +665,26 @@ void genCases_f16_ab_next( void )
 
 }
 
+void genCases_f16_ab_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_f16_ab_next();
+
+}
+
 void genCases_f16_abc_init( void )
 {
 
+    genCases_writeCase = writeCaseABC;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( f16NumQIn, 3 );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
@@ -487,13 +707,28 @@ void genCases_f16_abc_init( void )
         currentA = f16NextQInP2( &sequenceA );
         currentB = f16NextQInP2( &sequenceB );
     }
-    genCases_done = false;
+    genCases_startCases( genCases_total );
 
 }
 
 void genCases_f16_abc_next( void )
 {
 
+    if ( genCases_nextCase() ) seekABC( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_f16_a.v = corpus_ui16Case( 0 );
+        genCases_f16_b.v = corpus_ui16Case( 1 );
+        genCases_f16_c.v = corpus_ui16Case( 2 );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_f16_a = f16Quick( f16QIn, f16NumQIn, 0 );
+        genCases_f16_b = f16Quick( f16QIn, f16NumQIn, 1 );
+        genCases_f16_c = f16Quick( f16QIn, f16NumQIn, 2 );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -549,7 +784,6 @@ void genCases_f16_abc_next( void )
             genCases_f16_a = currentA;
             genCases_f16_b = currentB;
             genCases_f16_c = currentC;
-            genCases_done = sequenceA.done & sequenceB.done & sequenceC.done;
             subcase = -1;
             break;
         }
@@ -572,7 +806,6 @@ void genCases_f16_abc_next( void )
             genCases_f16_a = currentA;
             genCases_f16_b = currentB;
             genCases_f16_c = f16NextQInP2( &sequenceC );
-            genCases_done = sequenceA.done & sequenceB.done & sequenceC.done;
             subcase = -1;
             break;
         }
@@ -581,5 +814,46 @@ void genCases_f16_abc_next( void )
 
 }
 
+void genCases_f16_abc_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_f16_abc_next();
+
+}
+
+void genCases_f16_writeState( FILE *file )
+{
+
+    fwrite( &sequenceA, sizeof sequenceA, 1, file );
+    fwrite( &sequenceB, sizeof sequenceB, 1, file );
+    fwrite( &sequenceC, sizeof sequenceC, 1, file );
+    fwrite( &currentA, sizeof currentA, 1, file );
+    fwrite( &currentB, sizeof currentB, 1, file );
+    fwrite( &currentC, sizeof currentC, 1, file );
+    fwrite( &subcase, sizeof subcase, 1, file );
+    fwrite( &genCases_f16_a, sizeof genCases_f16_a, 1, file );
+    fwrite( &genCases_f16_b, sizeof genCases_f16_b, 1, file );
+    fwrite( &genCases_f16_c, sizeof genCases_f16_c, 1, file );
+
+}
+
+bool genCases_f16_readState( FILE *file )
+{
+
+    return
+        fread( &sequenceA, sizeof sequenceA, 1, file )
+            && fread( &sequenceB, sizeof sequenceB, 1, file )
+            && fread( &sequenceC, sizeof sequenceC, 1, file )
+            && fread( &currentA, sizeof currentA, 1, file )
+            && fread( &currentB, sizeof currentB, 1, file )
+            && fread( &currentC, sizeof currentC, 1, file )
+            && fread( &subcase, sizeof subcase, 1, file )
+            && fread( &genCases_f16_a, sizeof genCases_f16_a, 1, file )
+            && fread( &genCases_f16_b, sizeof genCases_f16_b, 1, file )
+            && fread( &genCases_f16_c, sizeof genCases_f16_c, 1, file );
+
+}
+
 #endif
 
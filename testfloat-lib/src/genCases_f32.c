@@ -37,10 +37,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 #include "platform.h"
 #include "random.h"
 #include "softfloat.h"
 #include "genCases.h"
+#include "corpus.h"
+#include "writeHex.h"
 
 struct sequence {
     int expNum, term1Num, term2Num;
@@ -416,29 +419,208 @@ static float32_t f32Random( void )
 
 }
 
-static struct sequence sequenceA, sequenceB, sequenceC;
-static float32_t currentA, currentB, currentC;
-static int subcase;
+/*----------------------------------------------------------------------------
+| Returns case `genCases_quickCaseNum' of the stratum of operand `operandNum',
+| from `genCases_quickStrata', among the strata made from the `numQ'
+| exponents at `q'.  Each exponent of the table starts a stratum that runs up
+| to the next exponent of the same sign.  The first cases of a stratum take
+| the ends of its exponents and the significands of `f32P1', and the rest are
+| random.  In the strata of the subnormal and infinity or NaN exponents, the
+| first case is zero or infinity and the rest are subnormal or NaN.
+*----------------------------------------------------------------------------*/
+static float32_t f32Quick( const uint32_t *q, int numQ, int operandNum )
+{
+    int stratum, caseNum;
+    uint_fast32_t uiQ, exp, expEnd, sig;
+    union ui32_f32 uZ;
+
+    stratum = genCases_quickStrata[operandNum];
+    caseNum = genCases_quickCaseNum;
+    uiQ = q[stratum];
+    exp = uiQ & 0x7F800000;
+    sig = (caseNum < f32NumP1) ? f32P1[caseNum] : random_ui32() & 0x007FFFFF;
+    if ( ! exp || (exp == 0x7F800000) ) {
+        if ( caseNum && ! sig ) sig = 1;
+        uZ.ui = uiQ | sig;
+        return uZ.f;
+    }
+    expEnd = exp + 0x00800000;
+    if (
+           (stratum + 1 < numQ) && ! ((uiQ ^ q[stratum + 1]) & 0x80000000)
+        && ((q[stratum + 1] & 0x7F800000) != 0x7F800000)
+    ) {
+        expEnd = q[stratum + 1] & 0x7F800000;
+    }
+    if ( caseNum == 1 ) {
+        exp = expEnd - 0x00800000;
+    } else if ( caseNum ) {
+        exp += (uint_fast32_t) randomN_ui8( (expEnd - exp)>>23 )<<23;
+    }
+    uZ.ui = (uiQ & 0x80000000) | exp | sig;
+    return uZ.f;
+
+}
+
+static THREAD_LOCAL struct sequence sequenceA, sequenceB, sequenceC;
+static THREAD_LOCAL float32_t currentA, currentB, currentC;
+static THREAD_LOCAL int subcase;
+
+THREAD_LOCAL float32_t genCases_f32_a, genCases_f32_b, genCases_f32_c;
+
+static void writeCaseA( void )
+{
+
+    writeHex_f32( genCases_f32_a, 0 );
+
+}
+
+static void writeCaseAB( void )
+{
+
+    writeHex_f32( genCases_f32_a, ' ' );
+    writeHex_f32( genCases_f32_b, 0 );
+
+}
+
+static void writeCaseABC( void )
+{
+
+    writeHex_f32( genCases_f32_a, ' ' );
+    writeHex_f32( genCases_f32_b, ' ' );
+    writeHex_f32( genCases_f32_c, 0 );
+
+}
+
+/*----------------------------------------------------------------------------
+| Sets `sequencePtr' to its entry `entryNum', where each exponent has
+| `numSigs' entries.
+*----------------------------------------------------------------------------*/
+static void
+ seekSequence(
+     struct sequence *sequencePtr, uint_fast64_t entryNum, int numSigs )
+{
+
+    sequencePtr->expNum = entryNum / numSigs;
+    sequencePtr->term1Num = entryNum % numSigs;
+    sequencePtr->term2Num = 0;
+    sequencePtr->done = false;
+
+}
+
+/*----------------------------------------------------------------------------
+| Each of these sets the state of the matching `_next' function for it to
+| give case `caseNum'.  The values from the sequences that come before the
+| case are found again from their places in the sequences.
+*----------------------------------------------------------------------------*/
+static void seekA( uint_fast64_t caseNum )
+{
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 3;
+        seekSequence( &sequenceA, caseNum / 3, f32NumP1 );
+    } else {
+        subcase = caseNum % 2;
+        seekSequence( &sequenceA, caseNum / 2, f32NumP2 );
+    }
+
+}
+
+static void seekAB( uint_fast64_t caseNum )
+{
+    uint_fast64_t groupNum;
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 6;
+        groupNum = caseNum / 6;
+        seekSequence( &sequenceA, groupNum / f32NumQInP1, f32NumP1 );
+        currentA = f32NextQInP1( &sequenceA );
+        seekSequence( &sequenceB, groupNum % f32NumQInP1, f32NumP1 );
+        if ( subcase ) currentB = f32NextQInP1( &sequenceB );
+    } else {
+        subcase = caseNum % 2;
+        groupNum = caseNum / 2;
+        seekSequence( &sequenceA, groupNum / f32NumQInP2, f32NumP2 );
+        currentA = f32NextQInP2( &sequenceA );
+        seekSequence( &sequenceB, groupNum % f32NumQInP2, f32NumP2 );
+    }
+
+}
+
+static void seekABC( uint_fast64_t caseNum )
+{
+    uint_fast64_t groupNum;
 
-float32_t genCases_f32_a, genCases_f32_b, genCases_f32_c;
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 9;
+        groupNum = caseNum / 9;
+        seekSequence(
+            &sequenceA, groupNum / (f32NumQInP1 * f32NumQInP1), f32NumP1 );
+        currentA = f32NextQInP1( &sequenceA );
+        seekSequence(
+            &sequenceB, groupNum / f32NumQInP1 % f32NumQInP1, f32NumP1 );
+        currentB = f32NextQInP1( &sequenceB );
+        seekSequence( &sequenceC, groupNum % f32NumQInP1, f32NumP1 );
+        if ( subcase ) currentC = f32NextQInP1( &sequenceC );
+    } else {
+        subcase = caseNum % 2;
+        groupNum = caseNum / 2;
+        seekSequence(
+            &sequenceA, groupNum / (f32NumQInP2 * f32NumQInP2), f32NumP2 );
+        currentA = f32NextQInP2( &sequenceA );
+        seekSequence(
+            &sequenceB, groupNum / f32NumQInP2 % f32NumQInP2, f32NumP2 );
+        currentB = f32NextQInP2( &sequenceB );
+        seekSequence( &sequenceC, groupNum % f32NumQInP2, f32NumP2 );
+    }
+
+}
 
 void genCases_f32_a_init( void )
 {
 
+    genCases_writeCase = writeCaseA;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( f32NumQOut, 1 );
+        return;
+    }
+    if ( genCases_exhaustive ) {
+        genCases_startCases( UINT64_C( 0x100000000 ) );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
     sequenceA.done = false;
     subcase = 0;
-    genCases_total =
-        (genCases_level == 1) ? 3 * f32NumQOutP1 : 2 * f32NumQOutP2;
-    genCases_done = false;
+    genCases_startCases(
+        (genCases_level == 1) ? 3 * f32NumQOutP1 : 2 * f32NumQOutP2 );
 
 }
 
 void genCases_f32_a_next( void )
 {
 
+    if ( genCases_nextCase() && ! genCases_exhaustive ) {
+        seekA( genCases_caseNum % genCases_total );
+    }
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_f32_a.v = corpus_ui32Case( 0 );
+        return;
+    }
+    if ( genCases_exhaustive ) {
+        genCases_f32_a.v = genCases_caseNum;
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_f32_a = f32Quick( f32QOut, f32NumQOut, 0 );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -447,7 +629,6 @@ void genCases_f32_a_next( void )
             break;
          case 2:
             genCases_f32_a = f32NextQOutP1( &sequenceA );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -458,7 +639,6 @@ void genCases_f32_a_next( void )
             break;
          case 1:
             genCases_f32_a = f32NextQOutP2( &sequenceA );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -467,9 +647,26 @@ void genCases_f32_a_next( void )
 
 }
 
+void genCases_f32_a_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_f32_a_next();
+
+}
+
 void genCases_f32_ab_init( void )
 {
 
+    genCases_writeCase = writeCaseAB;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( f32NumQIn, 2 );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
@@ -486,13 +683,26 @@ void genCases_f32_ab_init( void )
         genCases_total = 2 * f32NumQInP2 * f32NumQInP2;
         currentA = f32NextQInP2( &sequenceA );
     }
-    genCases_done = false;
+    genCases_startCases( genCases_total );
 
 }
 
 void genCases_f32_ab_next( void )
 {
 
+    if ( genCases_nextCase() ) seekAB( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_f32_a.v = corpus_ui32Case( 0 );
+        genCases_f32_b.v = corpus_ui32Case( 1 );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_f32_a = f32Quick( f32QIn, f32NumQIn, 0 );
+        genCases_f32_b = f32Quick( f32QIn, f32NumQIn, 1 );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -517,7 +727,6 @@ void genCases_f32_ab_next( void )
          case 5:
             genCases_f32_a = currentA;
             genCases_f32_b = currentB;
-            genCases_done = sequenceA.done & sequenceB.done;
             subcase = -1;
             break;
         }
@@ -534,7 +743,6 @@ void genCases_f32_ab_next( void )
             }
             genCases_f32_a = currentA;
             genCases_f32_b = f32NextQInP2( &sequenceB );
-            genCases_done = sequenceA.done & sequenceB.done;
             subcase = -1;
             break;
         }
@@ -543,9 +751,26 @@ void genCases_f32_ab_next( void )
 
 }
 
+void genCases_f32_ab_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_f32_ab_next();
+
+}
+
 void genCases_f32_abc_init( void )
 {
 
+    genCases_writeCase = writeCaseABC;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( f32NumQIn, 3 );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
@@ -568,13 +793,28 @@ void genCases_f32_abc_init( void )
         currentA = f32NextQInP2( &sequenceA );
         currentB = f32NextQInP2( &sequenceB );
     }
-    genCases_done = false;
+    genCases_startCases( genCases_total );
 
 }
 
 void genCases_f32_abc_next( void )
 {
 
+    if ( genCases_nextCase() ) seekABC( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_f32_a.v = corpus_ui32Case( 0 );
+        genCases_f32_b.v = corpus_ui32Case( 1 );
+        genCases_f32_c.v = corpus_ui32Case( 2 );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_f32_a = f32Quick( f32QIn, f32NumQIn, 0 );
+        genCases_f32_b = f32Quick( f32QIn, f32NumQIn, 1 );
+        genCases_f32_c = f32Quick( f32QIn, f32NumQIn, 2 );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -630,7 +870,6 @@ void genCases_f32_abc_next( void )
             genCases_f32_a = currentA;
             genCases_f32_b = currentB;
             genCases_f32_c = currentC;
-            genCases_done = sequenceA.done & sequenceB.done & sequenceC.done;
             subcase = -1;
             break;
         }
@@ -653,7 +892,6 @@ void genCases_f32_abc_next( void )
             genCases_f32_a = currentA;
             genCases_f32_b = currentB;
             genCases_f32_c = f32NextQInP2( &sequenceC );
-            genCases_done = sequenceA.done & sequenceB.done & sequenceC.done;
             subcase = -1;
             break;
         }
@@ -662,3 +900,44 @@ void genCases_f32_abc_next( void )
 
 }
 
+void genCases_f32_abc_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_f32_abc_next();
+
+}
+
+void genCases_f32_writeState( FILE *file )
+{
+
+    fwrite( &sequenceA, sizeof sequenceA, 1, file );
+    fwrite( &sequenceB, sizeof sequenceB, 1, file );
+    fwrite( &sequenceC, sizeof sequenceC, 1, file );
+    fwrite( &currentA, sizeof currentA, 1, file );
+    fwrite( &currentB, sizeof currentB, 1, file );
+    fwrite( &currentC, sizeof currentC, 1, file );
+    fwrite( &subcase, sizeof subcase, 1, file );
+    fwrite( &genCases_f32_a, sizeof genCases_f32_a, 1, file );
+    fwrite( &genCases_f32_b, sizeof genCases_f32_b, 1, file );
+    fwrite( &genCases_f32_c, sizeof genCases_f32_c, 1, file );
+
+}
+
+bool genCases_f32_readState( FILE *file )
+{
+
+    return
+        fread( &sequenceA, sizeof sequenceA, 1, file )
+            && fread( &sequenceB, sizeof sequenceB, 1, file )
+            && fread( &sequenceC, sizeof sequenceC, 1, file )
+            && fread( &currentA, sizeof currentA, 1, file )
+            && fread( &currentB, sizeof currentB, 1, file )
+            && fread( &currentC, sizeof currentC, 1, file )
+            && fread( &subcase, sizeof subcase, 1, file )
+            && fread( &genCases_f32_a, sizeof genCases_f32_a, 1, file )
+            && fread( &genCases_f32_b, sizeof genCases_f32_b, 1, file )
+            && fread( &genCases_f32_c, sizeof genCases_f32_c, 1, file );
+
+}
+
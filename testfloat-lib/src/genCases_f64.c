@@ -37,10 +37,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 #include "platform.h"
 #include "random.h"
 #include "softfloat.h"
 #include "genCases.h"
+#include "corpus.h"
+#include "writeHex.h"
 
 #ifdef FLOAT64
 
@@ -558,29 +561,196 @@ static float64_t f64Random( void )
 
 }
 
-static struct sequence sequenceA, sequenceB, sequenceC;
-static float64_t currentA, currentB, currentC;
-static int subcase;
+/*----------------------------------------------------------------------------
+| Like `f32Quick' in `genCases_f32.c', for f64.
+*----------------------------------------------------------------------------*/
+static float64_t f64Quick( const uint64_t *q, int numQ, int operandNum )
+{
+    int stratum, caseNum;
+    uint_fast64_t uiQ, exp, expEnd, sig;
+    union ui64_f64 uZ;
+
+    stratum = genCases_quickStrata[operandNum];
+    caseNum = genCases_quickCaseNum;
+    uiQ = q[stratum];
+    exp = uiQ & UINT64_C( 0x7FF0000000000000 );
+    sig =
+        (caseNum < f64NumP1) ? f64P1[caseNum]
+            : random_ui64() & UINT64_C( 0x000FFFFFFFFFFFFF );
+    if ( ! exp || (exp == UINT64_C( 0x7FF0000000000000 )) ) {
+        if ( caseNum && ! sig ) sig = 1;
+        uZ.ui = uiQ | sig;
+        return uZ.f;
+    }
+    expEnd = exp + UINT64_C( 0x0010000000000000 );
+    if (
+           (stratum + 1 < numQ)
+        && ! ((uiQ ^ q[stratum + 1]) & UINT64_C( 0x8000000000000000 ))
+        && ((q[stratum + 1] & UINT64_C( 0x7FF0000000000000 ))
+                != UINT64_C( 0x7FF0000000000000 ))
+    ) {
+        expEnd = q[stratum + 1] & UINT64_C( 0x7FF0000000000000 );
+    }
+    if ( caseNum == 1 ) {
+        exp = expEnd - UINT64_C( 0x0010000000000000 );
+    } else if ( caseNum ) {
+        exp += (uint_fast64_t) randomN_ui16( (expEnd - exp)>>52 )<<52;
+    }
+    uZ.ui = (uiQ & UINT64_C( 0x8000000000000000 )) | exp | sig;
+    return uZ.f;
+
+}
+
+static THREAD_LOCAL struct sequence sequenceA, sequenceB, sequenceC;
+static THREAD_LOCAL float64_t currentA, currentB, currentC;
+static THREAD_LOCAL int subcase;
+
+THREAD_LOCAL float64_t genCases_f64_a, genCases_f64_b, genCases_f64_c;
+
+static void writeCaseA( void )
+{
 
-float64_t genCases_f64_a, genCases_f64_b, genCases_f64_c;
+    writeHex_f64( genCases_f64_a, 0 );
+
+}
+
+static void writeCaseAB( void )
+{
+
+    writeHex_f64( genCases_f64_a, ' ' );
+    writeHex_f64( genCases_f64_b, 0 );
+
+}
+
+static void writeCaseABC( void )
+{
+
+    writeHex_f64( genCases_f64_a, ' ' );
+    writeHex_f64( genCases_f64_b, ' ' );
+    writeHex_f64( genCases_f64_c, 0 );
+
+}
+
+/*----------------------------------------------------------------------------
+| Sets `sequencePtr' to its entry `entryNum', where each exponent has
+| `numSigs' entries.
+*----------------------------------------------------------------------------*/
+static void
+ seekSequence(
+     struct sequence *sequencePtr, uint_fast64_t entryNum, int numSigs )
+{
+
+    sequencePtr->expNum = entryNum / numSigs;
+    sequencePtr->term1Num = entryNum % numSigs;
+    sequencePtr->term2Num = 0;
+    sequencePtr->done = false;
+
+}
+
+/*----------------------------------------------------------------------------
+| Each of these sets the state of the matching `_next' function for it to
+| give case `caseNum'.  The values from the sequences that come before the
+| case are found again from their places in the sequences.
+*----------------------------------------------------------------------------*/
+static void seekA( uint_fast64_t caseNum )
+{
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 3;
+        seekSequence( &sequenceA, caseNum / 3, f64NumP1 );
+    } else {
+        subcase = caseNum % 2;
+        seekSequence( &sequenceA, caseNum / 2, f64NumP2 );
+    }
+
+}
+
+static void seekAB( uint_fast64_t caseNum )
+{
+    uint_fast64_t groupNum;
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 6;
+        groupNum = caseNum / 6;
+        seekSequence( &sequenceA, groupNum / f64NumQInP1, f64NumP1 );
+        currentA = f64NextQInP1( &sequenceA );
+        seekSequence( &sequenceB, groupNum % f64NumQInP1, f64NumP1 );
+        if ( subcase ) currentB = f64NextQInP1( &sequenceB );
+    } else {
+        subcase = caseNum % 2;
+        groupNum = caseNum / 2;
+        seekSequence( &sequenceA, groupNum / f64NumQInP2, f64NumP2 );
+        currentA = f64NextQInP2( &sequenceA );
+        seekSequence( &sequenceB, groupNum % f64NumQInP2, f64NumP2 );
+    }
+
+}
+
+static void seekABC( uint_fast64_t caseNum )
+{
+    uint_fast64_t groupNum;
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 9;
+        groupNum = caseNum / 9;
+        seekSequence(
+            &sequenceA, groupNum / (f64NumQInP1 * f64NumQInP1), f64NumP1 );
+        currentA = f64NextQInP1( &sequenceA );
+        seekSequence(
+            &sequenceB, groupNum / f64NumQInP1 % f64NumQInP1, f64NumP1 );
+        currentB = f64NextQInP1( &sequenceB );
+        seekSequence( &sequenceC, groupNum % f64NumQInP1, f64NumP1 );
+        if ( subcase ) currentC = f64NextQInP1( &sequenceC );
+    } else {
+        subcase = caseNum % 2;
+        groupNum = caseNum / 2;
+        seekSequence(
+            &sequenceA, groupNum / (f64NumQInP2 * f64NumQInP2), f64NumP2 );
+        currentA = f64NextQInP2( &sequenceA );
+        seekSequence(
+            &sequenceB, groupNum / f64NumQInP2 % f64NumQInP2, f64NumP2 );
+        currentB = f64NextQInP2( &sequenceB );
+        seekSequence( &sequenceC, groupNum % f64NumQInP2, f64NumP2 );
+    }
+
+}
 
 void genCases_f64_a_init( void )
 {
 
+    genCases_writeCase = writeCaseA;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( f64NumQOut, 1 );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
     sequenceA.done = false;
     subcase = 0;
-    genCases_total =
-        (genCases_level == 1) ? 3 * f64NumQOutP1 : 2 * f64NumQOutP2;
-    genCases_done = false;
+    genCases_startCases(
+        (genCases_level == 1) ? 3 * f64NumQOutP1 : 2 * f64NumQOutP2 );
 
 }
 
 void genCases_f64_a_next( void )
 {
 
+    if ( genCases_nextCase() ) seekA( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_f64_a.v = corpus_ui64Case( 0 );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_f64_a = f64Quick( f64QOut, f64NumQOut, 0 );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -589,7 +759,6 @@ void genCases_f64_a_next( void )
             break;
          case 2:
             genCases_f64_a = f64NextQOutP1( &sequenceA );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -600,7 +769,6 @@ void genCases_f64_a_next( void )
             break;
          case 1:
             genCases_f64_a = f64NextQOutP2( &sequenceA );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -609,9 +777,26 @@ void genCases_f64_a_next( void )
 
 }
 
+void genCases_f64_a_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_f64_a_next();
+
+}
+
 void genCases_f64_ab_init( void )
 {
 
+    genCases_writeCase = writeCaseAB;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( f64NumQIn, 2 );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
@@ -628,13 +813,26 @@ void genCases_f64_ab_init( void )
         genCases_total = 2 * f64NumQInP2 * f64NumQInP2;
         currentA = f64NextQInP2( &sequenceA );
     }
-    genCases_done = false;
+    genCases_startCases( genCases_total );
 
 }
 
 void genCases_f64_ab_next( void )
 {
 
+    if ( genCases_nextCase() ) seekAB( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_f64_a.v = corpus_ui64Case( 0 );
+        genCases_f64_b.v = corpus_ui64Case( 1 );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_f64_a = f64Quick( f64QIn, f64NumQIn, 0 );
+        genCases_f64_b = f64Quick( f64QIn, f64NumQIn, 1 );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -659,7 +857,6 @@ void genCases_f64_ab_next( void )
          case 5:
             genCases_f64_a = currentA;
             genCases_f64_b = currentB;
-            genCases_done = sequenceA.done & sequenceB.done;
             subcase = -1;
             break;
         }
@@ -676,7 +873,6 @@ void genCases_f64_ab_next( void )
             }
             genCases_f64_a = currentA;
             genCases_f64_b = f64NextQInP2( &sequenceB );
-            genCases_done = sequenceA.done & sequenceB.done;
             subcase = -1;
             break;
         }
@@ -685,9 +881,26 @@ void genCases_f64_ab_next( void )
 
 }
 
+void genCases_f64_ab_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_f64_ab_next();
+
+}
+
 void genCases_f64_abc_init( void )
 {
 
+    genCases_writeCase = writeCaseABC;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( f64NumQIn, 3 );
+        return;
+    }
     sequenceA.expNum = 0;
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
@@ -710,13 +923,28 @@ void genCases_f64_abc_init( void )
         currentA = f64NextQInP2( &sequenceA );
         currentB = f64NextQInP2( &sequenceB );
     }
-    genCases_done = false;
+    genCases_startCases( genCases_total );
 
 }
 
 void genCases_f64_abc_next( void )
 {
 
+    if ( genCases_nextCase() ) seekABC( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_f64_a.v = corpus_ui64Case( 0 );
+        genCases_f64_b.v = corpus_ui64Case( 1 );
+        genCases_f64_c.v = corpus_ui64Case( 2 );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_f64_a = f64Quick( f64QIn, f64NumQIn, 0 );
+        genCases_f64_b = f64Quick( f64QIn, f64NumQIn, 1 );
+        genCases_f64_c = f64Quick( f64QIn, f64NumQIn, 2 );
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -772,7 +1000,6 @@ void genCases_f64_abc_next( void )
             genCases_f64_a = currentA;
             genCases_f64_b = currentB;
             genCases_f64_c = currentC;
-            genCases_done = sequenceA.done & sequenceB.done & sequenceC.done;
             subcase = -1;
             break;
         }
@@ -795,7 +1022,6 @@ void genCases_f64_abc_next( void )
             genCases_f64_a = currentA;
             genCases_f64_b = currentB;
             genCases_f64_c = f64NextQInP2( &sequenceC );
-            genCases_done = sequenceA.done & sequenceB.done & sequenceC.done;
             subcase = -1;
             break;
         }
@@ -804,5 +1030,46 @@ void genCases_f64_abc_next( void )
 
 }
 
+void genCases_f64_abc_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_f64_abc_next();
+
+}
+
+void genCases_f64_writeState( FILE *file )
+{
+
+    fwrite( &sequenceA, sizeof sequenceA, 1, file );
+    fwrite( &sequenceB, sizeof sequenceB, 1, file );
+    fwrite( &sequenceC, sizeof sequenceC, 1, file );
+    fwrite( &currentA, sizeof currentA, 1, file );
+    fwrite( &currentB, sizeof currentB, 1, file );
+    fwrite( &currentC, sizeof currentC, 1, file );
+    fwrite( &subcase, sizeof subcase, 1, file );
+    fwrite( &genCases_f64_a, sizeof genCases_f64_a, 1, file );
+    fwrite( &genCases_f64_b, sizeof genCases_f64_b, 1, file );
+    fwrite( &genCases_f64_c, sizeof genCases_f64_c, 1, file );
+
+}
+
+bool genCases_f64_readState( FILE *file )
+{
+
+    return
+        fread( &sequenceA, sizeof sequenceA, 1, file )
+            && fread( &sequenceB, sizeof sequenceB, 1, file )
+            && fread( &sequenceC, sizeof sequenceC, 1, file )
+            && fread( &currentA, sizeof currentA, 1, file )
+            && fread( &currentB, sizeof currentB, 1, file )
+            && fread( &currentC, sizeof currentC, 1, file )
+            && fread( &subcase, sizeof subcase, 1, file )
+            && fread( &genCases_f64_a, sizeof genCases_f64_a, 1, file )
+            && fread( &genCases_f64_b, sizeof genCases_f64_b, 1, file )
+            && fread( &genCases_f64_c, sizeof genCases_f64_c, 1, file );
+
+}
+
 #endif
 
@@ -37,9 +37,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 #include "platform.h"
 #include "random.h"
 #include "genCases.h"
+#include "corpus.h"
+#include "writeHex.h"
 
 struct sequence {
     int term1Num, term2Num;
@@ -306,26 +309,125 @@ static int32_t i32RandomPInf( void )
 
 }
 
-static struct sequence sequenceA;
-static int subcase;
+/*----------------------------------------------------------------------------
+| Returns case `genCases_quickCaseNum' of quick-check stratum
+| `genCases_quickStrata[0]':  stratum 0 is zero, strata 1 to 31 hold the
+| positive integers of that many significant bits, and strata 32 to 63 the
+| negative integers whose magnitudes have 1 to 32 significant bits.  Each
+| stratum starts with the smallest and largest magnitudes.
+*----------------------------------------------------------------------------*/
+static int32_t i32Quick( void )
+{
+    int stratum, numBits;
+    uint_fast32_t low, sig;
+    union ui32_i32 uZ;
+
+    stratum = genCases_quickStrata[0];
+    if ( ! stratum ) return 0;
+    numBits = (stratum < 32) ? stratum : stratum - 31;
+    low = (uint_fast32_t) 1<<(numBits - 1);
+    switch ( genCases_quickCaseNum ) {
+     case 0:
+        sig = low;
+        break;
+     case 1:
+        sig = low | (low - 1);
+        break;
+     default:
+        sig = low | (random_ui32() & (low - 1));
+        break;
+    }
+    if ( stratum < 32 ) {
+        uZ.ui = sig;
+    } else {
+        if ( numBits == 32 ) sig = low;
+        uZ.ui = -sig;
+    }
+    return uZ.i;
+
+}
+
+static THREAD_LOCAL struct sequence sequenceA;
+static THREAD_LOCAL int subcase;
+
+THREAD_LOCAL int32_t genCases_i32_a;
+
+static void writeCaseA( void )
+{
+
+    writeHex_ui32( (uint32_t) genCases_i32_a, 0 );
+
+}
+
+/*----------------------------------------------------------------------------
+| Sets the state of `genCases_i32_a_next' for it to give case `caseNum'.  At
+| level 2, two of every four cases take the next value of `i32NextP2'.
+*----------------------------------------------------------------------------*/
+static void seekA( uint_fast64_t caseNum )
+{
+    uint_fast64_t entryNum;
 
-int32_t genCases_i32_a;
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 3;
+        sequenceA.term1Num = caseNum / 3;
+    } else {
+        subcase = caseNum % 4;
+        entryNum = caseNum / 4 * 2 + (2 <= subcase);
+        sequenceA.term1Num = 0;
+        while ( (uint_fast64_t) i32NumP1 - sequenceA.term1Num <= entryNum ) {
+            entryNum -= i32NumP1 - sequenceA.term1Num;
+            ++sequenceA.term1Num;
+        }
+        sequenceA.term2Num = sequenceA.term1Num + entryNum;
+    }
+    sequenceA.done = false;
+
+}
 
 void genCases_i32_a_init( void )
 {
 
+    genCases_writeCase = writeCaseA;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( 64, 1 );
+        return;
+    }
+    if ( genCases_exhaustive ) {
+        genCases_startCases( UINT64_C( 0x100000000 ) );
+        return;
+    }
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
     sequenceA.done = false;
     subcase = 0;
-    genCases_total = (genCases_level == 1) ? 3 * i32NumP1 : 2 * i32NumP2;
-    genCases_done = false;
+    genCases_startCases( (genCases_level == 1) ? 3 * i32NumP1 : 2 * i32NumP2 );
 
 }
 
 void genCases_i32_a_next( void )
 {
 
+    if ( genCases_nextCase() && ! genCases_exhaustive ) {
+        seekA( genCases_caseNum % genCases_total );
+    }
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_i32_a = (int32_t) corpus_ui32Case( 0 );
+        return;
+    }
+    if ( genCases_exhaustive ) {
+        genCases_i32_a = (int32_t) (uint32_t) genCases_caseNum;
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_i32_a = i32Quick();
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -336,7 +438,6 @@ void genCases_i32_a_next( void )
             break;
          case 2:
             genCases_i32_a = i32NextP1( &sequenceA );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -352,7 +453,6 @@ void genCases_i32_a_next( void )
             subcase = -1;
          case 1:
             genCases_i32_a = i32NextP2( &sequenceA );
-            genCases_done = sequenceA.done;
             break;
         }
     }
@@ -360,3 +460,30 @@ void genCases_i32_a_next( void )
 
 }
 
+void genCases_i32_a_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_i32_a_next();
+
+}
+
+void genCases_i32_writeState( FILE *file )
+{
+
+    fwrite( &sequenceA, sizeof sequenceA, 1, file );
+    fwrite( &subcase, sizeof subcase, 1, file );
+    fwrite( &genCases_i32_a, sizeof genCases_i32_a, 1, file );
+
+}
+
+bool genCases_i32_readState( FILE *file )
+{
+
+    return
+        fread( &sequenceA, sizeof sequenceA, 1, file )
+            && fread( &subcase, sizeof subcase, 1, file )
+            && fread( &genCases_i32_a, sizeof genCases_i32_a, 1, file );
+
+}
+
@@ -37,9 +37,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 #include "platform.h"
 #include "random.h"
 #include "genCases.h"
+#include "corpus.h"
+#include "writeHex.h"
 
 struct sequence {
     int term1Num, term2Num;
@@ -498,26 +501,115 @@ static int64_t i64RandomPInf( void )
 
 }
 
-static struct sequence sequenceA;
-static int subcase;
+/*----------------------------------------------------------------------------
+| Returns case `genCases_quickCaseNum' of quick-check stratum
+| `genCases_quickStrata[0]':  stratum 0 is zero, strata 1 to 63 hold the
+| positive integers of that many significant bits, and strata 64 to 127 the
+| negative integers whose magnitudes have 1 to 64 significant bits.  Each
+| stratum starts with the smallest and largest magnitudes.
+*----------------------------------------------------------------------------*/
+static int64_t i64Quick( void )
+{
+    int stratum, numBits;
+    uint_fast64_t low, sig;
+    union ui64_i64 uZ;
+
+    stratum = genCases_quickStrata[0];
+    if ( ! stratum ) return 0;
+    numBits = (stratum < 64) ? stratum : stratum - 63;
+    low = (uint_fast64_t) 1<<(numBits - 1);
+    switch ( genCases_quickCaseNum ) {
+     case 0:
+        sig = low;
+        break;
+     case 1:
+        sig = low | (low - 1);
+        break;
+     default:
+        sig = low | (random_ui64() & (low - 1));
+        break;
+    }
+    if ( stratum < 64 ) {
+        uZ.ui = sig;
+    } else {
+        if ( numBits == 64 ) sig = low;
+        uZ.ui = -sig;
+    }
+    return uZ.i;
+
+}
+
+static THREAD_LOCAL struct sequence sequenceA;
+static THREAD_LOCAL int subcase;
+
+THREAD_LOCAL int64_t genCases_i64_a;
+
+static void writeCaseA( void )
+{
+
+    writeHex_ui64( (uint64_t) genCases_i64_a, 0 );
+
+}
+
+/*----------------------------------------------------------------------------
+| Sets the state of `genCases_i64_a_next' for it to give case `caseNum'.  At
+| level 2, two of every four cases take the next value of `i64NextP2'.
+*----------------------------------------------------------------------------*/
+static void seekA( uint_fast64_t caseNum )
+{
+    uint_fast64_t entryNum;
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 3;
+        sequenceA.term1Num = caseNum / 3;
+    } else {
+        subcase = caseNum % 4;
+        entryNum = caseNum / 4 * 2 + (2 <= subcase);
+        sequenceA.term1Num = 0;
+        while ( (uint_fast64_t) i64NumP1 - sequenceA.term1Num <= entryNum ) {
+            entryNum -= i64NumP1 - sequenceA.term1Num;
+            ++sequenceA.term1Num;
+        }
+        sequenceA.term2Num = sequenceA.term1Num + entryNum;
+    }
+    sequenceA.done = false;
 
-int64_t genCases_i64_a;
+}
 
 void genCases_i64_a_init( void )
 {
 
+    genCases_writeCase = writeCaseA;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( 128, 1 );
+        return;
+    }
     sequenceA.term2Num = 0;
     sequenceA.term1Num = 0;
     sequenceA.done = false;
     subcase = 0;
-    genCases_total = (genCases_level == 1) ? 3 * i64NumP1 : 2 * i64NumP2;
-    genCases_done = false;
+    genCases_startCases( (genCases_level == 1) ? 3 * i64NumP1 : 2 * i64NumP2 );
 
 }
 
 void genCases_i64_a_next( void )
 {
 
+    if ( genCases_nextCase() ) seekA( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_i64_a = (int64_t) corpus_ui64Case( 0 );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_i64_a = i64Quick();
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -528,7 +620,6 @@ void genCases_i64_a_next( void )
             break;
          case 2:
             genCases_i64_a = i64NextP1( &sequenceA );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -544,7 +635,6 @@ void genCases_i64_a_next( void )
             subcase = -1;
          case 1:
             genCases_i64_a = i64NextP2( &sequenceA );
-            genCases_done = sequenceA.done;
             break;
         }
     }
@@ -552,3 +642,30 @@ void genCases_i64_a_next( void )
 
 }
 
+void genCases_i64_a_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_i64_a_next();
+
+}
+
+void genCases_i64_writeState( FILE *file )
+{
+
+    fwrite( &sequenceA, sizeof sequenceA, 1, file );
+    fwrite( &subcase, sizeof subcase, 1, file );
+    fwrite( &genCases_i64_a, sizeof genCases_i64_a, 1, file );
+
+}
+
+bool genCases_i64_readState( FILE *file )
+{
+
+    return
+        fread( &sequenceA, sizeof sequenceA, 1, file )
+            && fread( &subcase, sizeof subcase, 1, file )
+            && fread( &genCases_i64_a, sizeof genCases_i64_a, 1, file );
+
+}
+
@@ -37,9 +37,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 #include "platform.h"
 #include "random.h"
 #include "genCases.h"
+#include "corpus.h"
+#include "writeHex.h"
 
 struct sequence {
     int term1Num, term2Num;
@@ -267,26 +270,112 @@ static uint32_t ui32RandomPInf( void )
 
 }
 
-static struct sequence sequenceA;
-static int subcase;
+/*----------------------------------------------------------------------------
+| Returns case `genCases_quickCaseNum' of quick-check stratum
+| `genCases_quickStrata[0]':  stratum 0 is zero, and stratum n, from 1 to
+| 32, holds the integers of n significant bits, starting with the smallest
+| and largest of them.
+*----------------------------------------------------------------------------*/
+static uint32_t ui32Quick( void )
+{
+    int stratum;
+    uint_fast32_t low;
+
+    stratum = genCases_quickStrata[0];
+    if ( ! stratum ) return 0;
+    low = (uint_fast32_t) 1<<(stratum - 1);
+    switch ( genCases_quickCaseNum ) {
+     case 0:
+        return low;
+     case 1:
+        return low | (low - 1);
+    }
+    return low | (random_ui32() & (low - 1));
+
+}
+
+static THREAD_LOCAL struct sequence sequenceA;
+static THREAD_LOCAL int subcase;
+
+THREAD_LOCAL uint32_t genCases_ui32_a;
+
+static void writeCaseA( void )
+{
+
+    writeHex_ui32( genCases_ui32_a, 0 );
+
+}
 
-uint32_t genCases_ui32_a;
+/*----------------------------------------------------------------------------
+| Sets the state of `genCases_ui32_a_next' for it to give case `caseNum'.  At
+| level 2, two of every four cases take the next value of `ui32NextP2'.
+*----------------------------------------------------------------------------*/
+static void seekA( uint_fast64_t caseNum )
+{
+    uint_fast64_t entryNum;
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 3;
+        sequenceA.term1Num = caseNum / 3;
+    } else {
+        subcase = caseNum % 4;
+        entryNum = caseNum / 4 * 2 + (2 <= subcase);
+        sequenceA.term1Num = 0;
+        while ( (uint_fast64_t) ui32NumP1 - sequenceA.term1Num <= entryNum ) {
+            entryNum -= ui32NumP1 - sequenceA.term1Num;
+            ++sequenceA.term1Num;
+        }
+        sequenceA.term2Num = sequenceA.term1Num + entryNum;
+    }
+    sequenceA.done = false;
+
+}
 
 void genCases_ui32_a_init( void )
 {
 
+    genCases_writeCase = writeCaseA;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( 33, 1 );
+        return;
+    }
+    if ( genCases_exhaustive ) {
+        genCases_startCases( UINT64_C( 0x100000000 ) );
+        return;
+    }
     sequenceA.term1Num = 0;
     sequenceA.term2Num = 0;
     sequenceA.done = false;
     subcase = 0;
-    genCases_total = (genCases_level == 1) ? 3 * ui32NumP1 : 2 * ui32NumP2;
-    genCases_done = false;
+    genCases_startCases(
+        (genCases_level == 1) ? 3 * ui32NumP1 : 2 * ui32NumP2 );
 
 }
 
 void genCases_ui32_a_next( void )
 {
 
+    if ( genCases_nextCase() && ! genCases_exhaustive ) {
+        seekA( genCases_caseNum % genCases_total );
+    }
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_ui32_a = corpus_ui32Case( 0 );
+        return;
+    }
+    if ( genCases_exhaustive ) {
+        genCases_ui32_a = genCases_caseNum;
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_ui32_a = ui32Quick();
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -297,7 +386,6 @@ void genCases_ui32_a_next( void )
             break;
          case 2:
             genCases_ui32_a = ui32NextP1( &sequenceA );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -313,7 +401,6 @@ void genCases_ui32_a_next( void )
             subcase = -1;
          case 1:
             genCases_ui32_a = ui32NextP2( &sequenceA );
-            genCases_done = sequenceA.done;
             break;
         }
     }
@@ -321,3 +408,30 @@ void genCases_ui32_a_next( void )
 
 }
 
+void genCases_ui32_a_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_ui32_a_next();
+
+}
+
+void genCases_ui32_writeState( FILE *file )
+{
+
+    fwrite( &sequenceA, sizeof sequenceA, 1, file );
+    fwrite( &subcase, sizeof subcase, 1, file );
+    fwrite( &genCases_ui32_a, sizeof genCases_ui32_a, 1, file );
+
+}
+
+bool genCases_ui32_readState( FILE *file )
+{
+
+    return
+        fread( &sequenceA, sizeof sequenceA, 1, file )
+            && fread( &subcase, sizeof subcase, 1, file )
+            && fread( &genCases_ui32_a, sizeof genCases_ui32_a, 1, file );
+
+}
+
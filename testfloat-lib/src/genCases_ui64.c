@@ -37,9 +37,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 #include "platform.h"
 #include "random.h"
 #include "genCases.h"
+#include "corpus.h"
+#include "writeHex.h"
 
 struct sequence {
     int term1Num, term2Num;
@@ -427,26 +430,102 @@ static uint64_t ui64RandomPInf( void )
 
 }
 
-static struct sequence sequenceA;
-static int subcase;
+/*----------------------------------------------------------------------------
+| Returns case `genCases_quickCaseNum' of quick-check stratum
+| `genCases_quickStrata[0]':  stratum 0 is zero, and stratum n, from 1 to
+| 64, holds the integers of n significant bits, starting with the smallest
+| and largest of them.
+*----------------------------------------------------------------------------*/
+static uint64_t ui64Quick( void )
+{
+    int stratum;
+    uint_fast64_t low;
+
+    stratum = genCases_quickStrata[0];
+    if ( ! stratum ) return 0;
+    low = (uint_fast64_t) 1<<(stratum - 1);
+    switch ( genCases_quickCaseNum ) {
+     case 0:
+        return low;
+     case 1:
+        return low | (low - 1);
+    }
+    return low | (random_ui64() & (low - 1));
+
+}
+
+static THREAD_LOCAL struct sequence sequenceA;
+static THREAD_LOCAL int subcase;
+
+THREAD_LOCAL uint64_t genCases_ui64_a;
+
+static void writeCaseA( void )
+{
+
+    writeHex_ui64( genCases_ui64_a, 0 );
+
+}
+
+/*----------------------------------------------------------------------------
+| Sets the state of `genCases_ui64_a_next' for it to give case `caseNum'.  At
+| level 2, two of every four cases take the next value of `ui64NextP2'.
+*----------------------------------------------------------------------------*/
+static void seekA( uint_fast64_t caseNum )
+{
+    uint_fast64_t entryNum;
+
+    if ( genCases_level == 1 ) {
+        subcase = caseNum % 3;
+        sequenceA.term1Num = caseNum / 3;
+    } else {
+        subcase = caseNum % 4;
+        entryNum = caseNum / 4 * 2 + (2 <= subcase);
+        sequenceA.term1Num = 0;
+        while ( (uint_fast64_t) ui64NumP1 - sequenceA.term1Num <= entryNum ) {
+            entryNum -= ui64NumP1 - sequenceA.term1Num;
+            ++sequenceA.term1Num;
+        }
+        sequenceA.term2Num = sequenceA.term1Num + entryNum;
+    }
+    sequenceA.done = false;
 
-uint64_t genCases_ui64_a;
+}
 
 void genCases_ui64_a_init( void )
 {
 
+    genCases_writeCase = writeCaseA;
+    if ( corpus_replaying ) {
+        genCases_startCases( corpus_startCases() );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickStart( 65, 1 );
+        return;
+    }
     sequenceA.term2Num = 0;
     sequenceA.term1Num = 0;
     sequenceA.done = false;
     subcase = 0;
-    genCases_total = (genCases_level == 1) ? 3 * ui64NumP1 : 2 * ui64NumP2;
-    genCases_done = false;
+    genCases_startCases(
+        (genCases_level == 1) ? 3 * ui64NumP1 : 2 * ui64NumP2 );
 
 }
 
 void genCases_ui64_a_next( void )
 {
 
+    if ( genCases_nextCase() ) seekA( genCases_caseNum % genCases_total );
+    if ( corpus_replaying ) {
+        corpus_setCase( genCases_caseNum );
+        genCases_ui64_a = corpus_ui64Case( 0 );
+        return;
+    }
+    if ( genCases_quick ) {
+        genCases_quickNext();
+        genCases_ui64_a = ui64Quick();
+        return;
+    }
     if ( genCases_level == 1 ) {
         switch ( subcase ) {
          case 0:
@@ -457,7 +536,6 @@ void genCases_ui64_a_next( void )
             break;
          case 2:
             genCases_ui64_a = ui64NextP1( &sequenceA );
-            genCases_done = sequenceA.done;
             subcase = -1;
             break;
         }
@@ -473,7 +551,6 @@ void genCases_ui64_a_next( void )
             subcase = -1;
          case 1:
             genCases_ui64_a = ui64NextP2( &sequenceA );
-            genCases_done = sequenceA.done;
             break;
         }
     }
@@ -481,3 +558,30 @@ void genCases_ui64_a_next( void )
 
 }
 
+void genCases_ui64_a_at( uint_fast64_t caseNum )
+{
+
+    genCases_seek( caseNum );
+    genCases_ui64_a_next();
+
+}
+
+void genCases_ui64_writeState( FILE *file )
+{
+
+    fwrite( &sequenceA, sizeof sequenceA, 1, file );
+    fwrite( &subcase, sizeof subcase, 1, file );
+    fwrite( &genCases_ui64_a, sizeof genCases_ui64_a, 1, file );
+
+}
+
+bool genCases_ui64_readState( FILE *file )
+{
+
+    return
+        fread( &sequenceA, sizeof sequenceA, 1, file )
+            && fread( &subcase, sizeof subcase, 1, file )
+            && fread( &genCases_ui64_a, sizeof genCases_ui64_a, 1, file );
+
+}
+
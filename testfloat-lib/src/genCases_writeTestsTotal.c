@@ -35,13 +35,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 =============================================================================*/
 
+#include <fenv.h>
+#include <math.h>
 #include <stdio.h>
 #include "platform.h"
 #include "genCases.h"
+#include "verCases.h"
 
 void genCases_writeTestsTotal( bool forever )
 {
+    int roundingMode;
 
+    if ( verCases_quiet ) return;
     if ( forever ) {
         fputs( "Unbounded tests.\n", stderr );
     } else {
@@ -57,6 +62,25 @@ void genCases_writeTestsTotal( bool forever )
                 stderr, "\r%lu tests total.\n", (long unsigned) genCases_total
             );
         }
+        /*--------------------------------------------------------------------
+        | With no errors in `genCases_quick' cases, a stratum's failure rate
+        | is below 1 - 0.05^(1/genCases_quick) with 95% confidence.  The
+        | subject's rounding mode may still be in effect here, so the bound
+        | is computed and written rounding to nearest.
+        *--------------------------------------------------------------------*/
+        if ( genCases_quick ) {
+            roundingMode = fegetround();
+            fesetround( FE_TONEAREST );
+            fprintf(
+                stderr,
+                "%lu strata of %d cases:  a stratum without errors fails less "
+                    "than %.3g%%\nof the time, with 95%% confidence.\n",
+                (long unsigned) genCases_quickNumStrata,
+                genCases_quick,
+                100 * (1 - pow( 0.05, 1.0 / genCases_quick ))
+            );
+            fesetround( roundingMode );
+        }
     }
 
 }
@@ -0,0 +1,150 @@
+
+/*============================================================================
+
+This C source file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "platform.h"
+#include "fail.h"
+#include "jobCosts.h"
+
+enum { maxNameLength = 47 };
+
+struct jobCost {
+    char name[maxNameLength + 1];
+    double nsPerCase;
+};
+
+static struct jobCost *jobCosts;
+static int numJobCosts, maxJobCosts;
+
+static struct jobCost *findJobCost( const char *namePtr )
+{
+    int i;
+
+    for ( i = 0; i < numJobCosts; ++i ) {
+        if ( ! strcmp( jobCosts[i].name, namePtr ) ) return &jobCosts[i];
+    }
+    return 0;
+
+}
+
+static struct jobCost *addJobCost( const char *namePtr, double nsPerCase )
+{
+    struct jobCost *jobCostPtr;
+
+    if ( numJobCosts == maxJobCosts ) {
+        maxJobCosts = maxJobCosts ? 2 * maxJobCosts : 256;
+        jobCosts = realloc( jobCosts, maxJobCosts * sizeof *jobCosts );
+        if ( ! jobCosts ) fail( "Out of memory" );
+    }
+    jobCostPtr = &jobCosts[numJobCosts];
+    ++numJobCosts;
+    strncpy( jobCostPtr->name, namePtr, maxNameLength );
+    jobCostPtr->name[maxNameLength] = 0;
+    jobCostPtr->nsPerCase = nsPerCase;
+    return jobCostPtr;
+
+}
+
+void jobCosts_load( const char *path )
+{
+    FILE *file;
+    char name[maxNameLength + 1];
+    double nsPerCase;
+
+    file = fopen( path, "r" );
+    if ( ! file ) return;
+    while ( fscanf( file, "%47s %lf", name, &nsPerCase ) == 2 ) {
+        if ( ! findJobCost( name ) ) addJobCost( name, nsPerCase );
+    }
+    fclose( file );
+
+}
+
+void jobCosts_save( const char *path )
+{
+    FILE *file;
+    int i;
+
+    file = fopen( path, "w" );
+    if ( ! file ) fail( "Cannot write `%s'", path );
+    for ( i = 0; i < numJobCosts; ++i ) {
+        fprintf( file, "%s %.6g\n", jobCosts[i].name, jobCosts[i].nsPerCase );
+    }
+    fclose( file );
+
+}
+
+void
+ jobCosts_record(
+     const char *namePtr, uint_fast64_t numCases, double seconds )
+{
+    double nsPerCase;
+    struct jobCost *jobCostPtr;
+
+    if ( ! numCases ) return;
+    nsPerCase = seconds * 1e9 / numCases;
+    jobCostPtr = findJobCost( namePtr );
+    /*------------------------------------------------------------------------
+    | Old and new measurements are averaged, so that one run disturbed by
+    | other load does not replace the history.
+    *------------------------------------------------------------------------*/
+    if ( jobCostPtr ) {
+        jobCostPtr->nsPerCase = (jobCostPtr->nsPerCase + nsPerCase) / 2;
+    } else {
+        addJobCost( namePtr, nsPerCase );
+    }
+
+}
+
+double jobCosts_nsPerCase( const char *namePtr )
+{
+    struct jobCost *jobCostPtr;
+    double sum;
+    int i;
+
+    jobCostPtr = findJobCost( namePtr );
+    if ( jobCostPtr ) return jobCostPtr->nsPerCase;
+    if ( ! numJobCosts ) return 1;
+    sum = 0;
+    for ( i = 0; i < numJobCosts; ++i ) sum += jobCosts[i].nsPerCase;
+    return sum / numJobCosts;
+
+}
+
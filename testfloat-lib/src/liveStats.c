@@ -0,0 +1,332 @@
+
+/*============================================================================
+
+This C source file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "platform.h"
+#include "fail.h"
+#include "thread.h"
+#include "verCases.h"
+#include "liveStats.h"
+
+const char * const liveStats_stateNames[liveStats_numStates] = {
+    "idle", "testing", "generating", "waiting", "replaying"
+};
+
+bool liveStats_active = false;
+THREAD_LOCAL uint_fast64_t liveStats_numCases;
+
+static struct liveStats_segment *segmentPtr;
+static THREAD_LOCAL struct liveStats_thread *slotPtr;
+static THREAD_LOCAL uint_fast64_t rateNumCases;
+static THREAD_LOCAL double rateTime;
+
+#ifdef _WIN32
+
+#include <windows.h>
+
+/*----------------------------------------------------------------------------
+| Windows keeps a named mapping only while a handle to it is open, so the
+| segment lasts as long as the run.  `mapSegment' with `create' true also
+| opens an existing segment, for writing.
+*----------------------------------------------------------------------------*/
+static void *mapSegment( const char *name, bool create )
+{
+    char mappingName[256];
+    HANDLE handle;
+
+    snprintf( mappingName, sizeof mappingName, "Local\\%s", name );
+    handle =
+        create
+            ? CreateFileMappingA(
+                  INVALID_HANDLE_VALUE,
+                  0,
+                  PAGE_READWRITE,
+                  0,
+                  sizeof (struct liveStats_segment),
+                  mappingName
+              )
+            : OpenFileMappingA( FILE_MAP_READ, FALSE, mappingName );
+    if ( ! handle ) return 0;
+    return
+        MapViewOfFile(
+            handle,
+            create ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ,
+            0,
+            0,
+            sizeof (struct liveStats_segment)
+        );
+
+}
+
+static bool claimFlag( volatile uint32_t *flagPtr )
+{
+
+    return ! InterlockedCompareExchange( (volatile LONG *) flagPtr, 1, 0 );
+
+}
+
+static uint32_t processId( void )
+{
+
+    return GetCurrentProcessId();
+
+}
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/*----------------------------------------------------------------------------
+| The segment is left in place when the run ends, so that its final counts
+| can still be read.
+*----------------------------------------------------------------------------*/
+static void *mapSegment( const char *name, bool create )
+{
+    char segmentName[256];
+    int fd;
+    void *ptr;
+
+    snprintf( segmentName, sizeof segmentName, "/%s", name );
+    fd =
+        create ? shm_open( segmentName, O_RDWR | O_CREAT, 0644 )
+            : shm_open( segmentName, O_RDONLY, 0 );
+    if ( fd < 0 ) return 0;
+    if (
+        create && ftruncate( fd, sizeof (struct liveStats_segment) )
+    ) {
+        close( fd );
+        return 0;
+    }
+    ptr =
+        mmap(
+            0,
+            sizeof (struct liveStats_segment),
+            create ? PROT_READ | PROT_WRITE : PROT_READ,
+            MAP_SHARED,
+            fd,
+            0
+        );
+    close( fd );
+    return (ptr == MAP_FAILED) ? 0 : ptr;
+
+}
+
+static bool claimFlag( volatile uint32_t *flagPtr )
+{
+
+    return __sync_bool_compare_and_swap( flagPtr, 0, 1 );
+
+}
+
+static uint32_t processId( void )
+{
+
+    return getpid();
+
+}
+
+#endif
+
+static void releaseOwnSlots( void )
+{
+    int slotNum;
+
+    for ( slotNum = 0; slotNum < liveStats_maxThreads; ++slotNum ) {
+        if (
+            segmentPtr->threads[slotNum].inUse
+                && (segmentPtr->threads[slotNum].processId == processId())
+        ) {
+            liveStats_releaseSlot( slotNum );
+        }
+    }
+
+}
+
+static void markEnded( void )
+{
+
+    segmentPtr->ended = true;
+
+}
+
+void liveStats_create( const char *name )
+{
+
+    segmentPtr = mapSegment( name, true );
+    if ( ! segmentPtr ) fail( "Cannot create shared memory `%s'", name );
+    memset( segmentPtr, 0, sizeof *segmentPtr );
+    segmentPtr->size = sizeof *segmentPtr;
+    segmentPtr->magic = liveStats_magic;
+    liveStats_active = true;
+    atexit( markEnded );
+    liveStats_useSlot( liveStats_claimSlot() );
+
+}
+
+void liveStats_join( const char *name )
+{
+
+    segmentPtr = mapSegment( name, true );
+    if ( ! segmentPtr ) fail( "Cannot open shared memory `%s'", name );
+    if (
+           (segmentPtr->magic != liveStats_magic)
+        || (segmentPtr->size != sizeof *segmentPtr)
+    ) {
+        fail( "`%s' is not from this version of testfloat-pe", name );
+    }
+    liveStats_active = true;
+    atexit( releaseOwnSlots );
+    liveStats_useSlot( liveStats_claimSlot() );
+
+}
+
+const struct liveStats_segment *liveStats_attach( const char *name )
+{
+    const struct liveStats_segment *ptr;
+
+    ptr = mapSegment( name, false );
+    if (
+        ptr
+            && ((ptr->magic != liveStats_magic) || (ptr->size != sizeof *ptr))
+    ) {
+        fail( "`%s' is not from this version of testfloat-pe", name );
+    }
+    return ptr;
+
+}
+
+int liveStats_claimSlot( void )
+{
+    int slotNum;
+    struct liveStats_thread *threadPtr;
+
+    if ( ! liveStats_active ) return -1;
+    for ( slotNum = 0; slotNum < liveStats_maxThreads; ++slotNum ) {
+        threadPtr = &segmentPtr->threads[slotNum];
+        if ( ! threadPtr->inUse && claimFlag( &threadPtr->inUse ) ) {
+            threadPtr->processId = processId();
+            threadPtr->caseNum = 0;
+            threadPtr->instanceNumCases = 0;
+            threadPtr->casesPerSecond = 0;
+            threadPtr->state = liveStats_idle;
+            threadPtr->testName[0] = 0;
+            if ( verCases_functionNamePtr ) {
+                verCases_formatFunctionName(
+                    threadPtr->testName, sizeof threadPtr->testName );
+            }
+            return slotNum;
+        }
+    }
+    return -1;
+
+}
+
+void liveStats_releaseSlot( int slotNum )
+{
+
+    if ( slotNum < 0 ) return;
+    segmentPtr->threads[slotNum].state = liveStats_idle;
+    segmentPtr->threads[slotNum].casesPerSecond = 0;
+    segmentPtr->threads[slotNum].inUse = false;
+
+}
+
+void liveStats_useSlot( int slotNum )
+{
+
+    slotPtr = (slotNum < 0) ? 0 : &segmentPtr->threads[slotNum];
+    liveStats_numCases = slotPtr ? slotPtr->numCases : 0;
+    rateNumCases = liveStats_numCases;
+    rateTime = thread_seconds();
+
+}
+
+void liveStats_setState( int state )
+{
+
+    if ( slotPtr ) slotPtr->state = state;
+
+}
+
+void liveStats_batch( uint_fast64_t caseNum, uint_fast64_t instanceNumCases )
+{
+    double now;
+
+    if ( ! slotPtr ) return;
+    slotPtr->numCases = liveStats_numCases;
+    slotPtr->caseNum = caseNum;
+    slotPtr->instanceNumCases = instanceNumCases;
+    now = thread_seconds();
+    if ( rateTime + 1 <= now ) {
+        slotPtr->casesPerSecond =
+            (liveStats_numCases - rateNumCases) / (now - rateTime);
+        rateNumCases = liveStats_numCases;
+        rateTime = now;
+    }
+
+}
+
+void liveStats_endInstance( void )
+{
+
+    if ( ! slotPtr ) return;
+    slotPtr->numCases = liveStats_numCases;
+
+}
+
+void liveStats_errorFound( void )
+{
+
+    if ( slotPtr ) ++slotPtr->numErrors;
+
+}
+
+void liveStats_startInstance( void )
+{
+
+    if ( ! slotPtr ) return;
+    verCases_formatFunctionName(
+        slotPtr->testName, sizeof slotPtr->testName );
+
+}
+
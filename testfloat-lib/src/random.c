@@ -35,33 +35,145 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 =============================================================================*/
 
+#include <stdbool.h>
 #include <stdint.h>
-#include <stdlib.h>
 #include "platform.h"
 #include "random.h"
 
+/*----------------------------------------------------------------------------
+| Random numbers come from the Philox4x32-10 counter-based generator:  the
+| byte numbered `count' in stream `stream' is a fixed function of the seed,
+| the stream and the count alone.  Only exact-width integer arithmetic is
+| used, so a seed gives the same sequence on every compiler and platform, and
+| a thread can be moved to any point of any stream at no cost.
+|   Each block from the generator is 16 bytes, held as four 32-bit words.
+| A draw takes only the bytes it needs, aligned to its own size, so that a
+| random operand, made mostly from `randomN_ui8' draws, seldom needs more
+| than part of one block.  (Making a block costs far more than using it.)
+*----------------------------------------------------------------------------*/
+enum {
+    philoxM0 = 0xD2511F53,
+    philoxM1 = 0xCD9E8D57,
+    philoxW0 = 0x9E3779B9,
+    philoxW1 = 0xBB67AE85
+};
+
+static uint_fast64_t seed = 1;
+static THREAD_LOCAL struct random_state state = { 0, 0 };
+static THREAD_LOCAL uint32_t block[4];
+static THREAD_LOCAL uint_fast64_t blockNum;
+static THREAD_LOCAL bool blockValid = false;
+
+static void makeBlock( void )
+{
+    uint32_t key0, key1, x0, x1, x2, x3;
+    uint64_t product0, product1;
+    int round;
+
+    key0 = (uint32_t) seed;
+    key1 = (uint32_t) (seed>>32);
+    x0 = (uint32_t) blockNum;
+    x1 = (uint32_t) (blockNum>>32);
+    x2 = (uint32_t) state.stream;
+    x3 = (uint32_t) (state.stream>>32);
+    for ( round = 0; round < 10; ++round ) {
+        product0 = (uint64_t) philoxM0 * x0;
+        product1 = (uint64_t) philoxM1 * x2;
+        x0 = (uint32_t) (product1>>32) ^ x1 ^ key0;
+        x2 = (uint32_t) (product0>>32) ^ x3 ^ key1;
+        x1 = (uint32_t) product1;
+        x3 = (uint32_t) product0;
+        key0 += philoxW0;
+        key1 += philoxW1;
+    }
+    block[0] = x0;
+    block[1] = x1;
+    block[2] = x2;
+    block[3] = x3;
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns the word of the current block holding byte `count', making the
+| block first if it is not the one last made.
+*----------------------------------------------------------------------------*/
+static uint32_t wordAt( uint_fast64_t count )
+{
+
+    if ( ! blockValid || (blockNum != count>>4) ) {
+        blockNum = count>>4;
+        makeBlock();
+        blockValid = true;
+    }
+    return block[count>>2 & 3];
+
+}
+
+uint_fast64_t random_getSeed( void )
+{
+
+    return seed;
+
+}
+
+void random_setSeed( uint_fast64_t newSeed )
+{
+
+    seed = newSeed;
+    blockValid = false;
+
+}
+
+struct random_state random_getState( void )
+{
+
+    return state;
+
+}
+
+void random_setState( struct random_state newState )
+{
+
+    state = newState;
+    blockValid = false;
+
+}
+
+void random_setStream( uint_fast64_t stream )
+{
+
+    state.stream = stream;
+    state.count = 0;
+    blockValid = false;
+
+}
+
 uint_fast8_t random_ui8( void )
 {
+    uint_fast64_t count;
 
-    return rand()>>4 & 0xFF;
+    count = state.count++;
+    return wordAt( count )>>(24 - (count & 3) * 8) & 0xFF;
 
 }
 
 uint_fast16_t random_ui16( void )
 {
+    uint_fast64_t count;
 
-    return (rand() & 0x0FF0)<<4 | (rand()>>4 & 0xFF);
+    count = (state.count + 1) & ~(uint_fast64_t) 1;
+    state.count = count + 2;
+    return wordAt( count )>>(16 - (count & 2) * 8) & 0xFFFF;
 
 }
 
 uint_fast32_t random_ui32( void )
 {
+    uint_fast64_t count;
 
-    return
-          (uint_fast32_t) (rand() & 0x0FF0)<<20
-        | (uint_fast32_t) (rand() & 0x0FF0)<<12
-        | (rand() & 0x0FF0)<<4
-        | (rand()>>4 & 0xFF);
+    count = (state.count + 3) & ~(uint_fast64_t) 3;
+    state.count = count + 4;
+    return wordAt( count );
 
 }
 
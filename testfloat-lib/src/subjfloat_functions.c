@@ -47,1764 +47,1466 @@ typedef void genericFuncType();
 | WARNING:
 | This file should not normally be modified.  See "subjfloat_config.h"
 | instead.
-|   The order of these array entries must match the order in the array
-| `standardFunctionInfos'.  Be careful about making changes.
+|   Each entry names the standard function its subject function is tested
+| against.  The order of the entries does not matter.
 *----------------------------------------------------------------------------*/
 
-genericFuncType *const subjfloat_functions[] = {
+const struct subjFunctionInfo subjfloat_functions[] = {
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
 #ifdef FLOAT16
 #ifdef SUBJ_UI32_TO_F16
-    (genericFuncType *) subj_ui32_to_f16,
-#else
-    0,
+    { "ui32_to_f16", (genericFuncType *) subj_ui32_to_f16 },
 #endif
 #endif
 #ifdef SUBJ_UI32_TO_F32
-    (genericFuncType *) subj_ui32_to_f32,
-#else
-    0,
+    { "ui32_to_f32", (genericFuncType *) subj_ui32_to_f32 },
 #endif
 #ifdef FLOAT64
 #ifdef SUBJ_UI32_TO_F64
-    (genericFuncType *) subj_ui32_to_f64,
-#else
-    0,
+    { "ui32_to_f64", (genericFuncType *) subj_ui32_to_f64 },
 #endif
 #endif
 #ifdef EXTFLOAT80
 #ifdef SUBJ_UI32_TO_EXTF80
-    (genericFuncType *) subj_ui32_to_extF80M,
-#else
-    0,
+    { "ui32_to_extF80", (genericFuncType *) subj_ui32_to_extF80M },
 #endif
 #endif
 #ifdef FLOAT128
 #ifdef SUBJ_UI32_TO_F128
-    (genericFuncType *) subj_ui32_to_f128M,
-#else
-    0,
+    { "ui32_to_f128", (genericFuncType *) subj_ui32_to_f128M },
 #endif
 #endif
 #ifdef FLOAT16
 #ifdef SUBJ_UI64_TO_F16
-    (genericFuncType *) subj_ui64_to_f16,
-#else
-    0,
+    { "ui64_to_f16", (genericFuncType *) subj_ui64_to_f16 },
 #endif
 #endif
 #ifdef SUBJ_UI64_TO_F32
-    (genericFuncType *) subj_ui64_to_f32,
-#else
-    0,
+    { "ui64_to_f32", (genericFuncType *) subj_ui64_to_f32 },
 #endif
 #ifdef FLOAT64
 #ifdef SUBJ_UI64_TO_F64
-    (genericFuncType *) subj_ui64_to_f64,
-#else
-    0,
+    { "ui64_to_f64", (genericFuncType *) subj_ui64_to_f64 },
 #endif
 #endif
 #ifdef EXTFLOAT80
 #ifdef SUBJ_UI64_TO_EXTF80
-    (genericFuncType *) subj_ui64_to_extF80M,
-#else
-    0,
+    { "ui64_to_extF80", (genericFuncType *) subj_ui64_to_extF80M },
 #endif
 #endif
 #ifdef FLOAT128
 #ifdef SUBJ_UI64_TO_F128
-    (genericFuncType *) subj_ui64_to_f128M,
-#else
-    0,
+    { "ui64_to_f128", (genericFuncType *) subj_ui64_to_f128M },
 #endif
 #endif
 #ifdef FLOAT16
 #ifdef SUBJ_I32_TO_F16
-    (genericFuncType *) subj_i32_to_f16,
-#else
-    0,
+    { "i32_to_f16", (genericFuncType *) subj_i32_to_f16 },
 #endif
 #endif
 #ifdef SUBJ_I32_TO_F32
-    (genericFuncType *) subj_i32_to_f32,
-#else
-    0,
+    { "i32_to_f32", (genericFuncType *) subj_i32_to_f32 },
 #endif
 #ifdef FLOAT64
 #ifdef SUBJ_I32_TO_F64
-    (genericFuncType *) subj_i32_to_f64,
-#else
-    0,
+    { "i32_to_f64", (genericFuncType *) subj_i32_to_f64 },
 #endif
 #endif
 #ifdef EXTFLOAT80
 #ifdef SUBJ_I32_TO_EXTF80
-    (genericFuncType *) subj_i32_to_extF80M,
-#else
-    0,
+    { "i32_to_extF80", (genericFuncType *) subj_i32_to_extF80M },
 #endif
 #endif
 #ifdef FLOAT128
 #ifdef SUBJ_I32_TO_F128
-    (genericFuncType *) subj_i32_to_f128M,
-#else
-    0,
+    { "i32_to_f128", (genericFuncType *) subj_i32_to_f128M },
 #endif
 #endif
 #ifdef FLOAT16
 #ifdef SUBJ_I64_TO_F16
-    (genericFuncType *) subj_i64_to_f16,
-#else
-    0,
+    { "i64_to_f16", (genericFuncType *) subj_i64_to_f16 },
 #endif
 #endif
 #ifdef SUBJ_I64_TO_F32
-    (genericFuncType *) subj_i64_to_f32,
-#else
-    0,
+    { "i64_to_f32", (genericFuncType *) subj_i64_to_f32 },
 #endif
 #ifdef FLOAT64
 #ifdef SUBJ_I64_TO_F64
-    (genericFuncType *) subj_i64_to_f64,
-#else
-    0,
+    { "i64_to_f64", (genericFuncType *) subj_i64_to_f64 },
 #endif
 #endif
 #ifdef EXTFLOAT80
 #ifdef SUBJ_I64_TO_EXTF80
-    (genericFuncType *) subj_i64_to_extF80M,
-#else
-    0,
+    { "i64_to_extF80", (genericFuncType *) subj_i64_to_extF80M },
 #endif
 #endif
 #ifdef FLOAT128
 #ifdef SUBJ_I64_TO_F128
-    (genericFuncType *) subj_i64_to_f128M,
-#else
-    0,
+    { "i64_to_f128", (genericFuncType *) subj_i64_to_f128M },
 #endif
 #endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
 #ifdef FLOAT16
 #ifdef SUBJ_F16_TO_UI32_R_NEAR_EVEN
-    (genericFuncType *) subj_f16_to_ui32_r_near_even,
-#else
-    0,
+    {
+        "f16_to_ui32_r_near_even",
+        (genericFuncType *) subj_f16_to_ui32_r_near_even
+    },
 #endif
 #ifdef SUBJ_F16_TO_UI32_R_MINMAG
-    (genericFuncType *) subj_f16_to_ui32_r_minMag,
-#else
-    0,
+    { "f16_to_ui32_r_minMag", (genericFuncType *) subj_f16_to_ui32_r_minMag },
 #endif
 #ifdef SUBJ_F16_TO_UI32_R_MIN
-    (genericFuncType *) subj_f16_to_ui32_r_min,
-#else
-    0,
+    { "f16_to_ui32_r_min", (genericFuncType *) subj_f16_to_ui32_r_min },
 #endif
 #ifdef SUBJ_F16_TO_UI32_R_MAX
-    (genericFuncType *) subj_f16_to_ui32_r_max,
-#else
-    0,
+    { "f16_to_ui32_r_max", (genericFuncType *) subj_f16_to_ui32_r_max },
 #endif
 #ifdef SUBJ_F16_TO_UI32_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f16_to_ui32_r_near_maxMag,
-#else
-    0,
+    {
+        "f16_to_ui32_r_near_maxMag",
+        (genericFuncType *) subj_f16_to_ui32_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F16_TO_UI64_R_NEAR_EVEN
-    (genericFuncType *) subj_f16_to_ui64_r_near_even,
-#else
-    0,
+    {
+        "f16_to_ui64_r_near_even",
+        (genericFuncType *) subj_f16_to_ui64_r_near_even
+    },
 #endif
 #ifdef SUBJ_F16_TO_UI64_R_MINMAG
-    (genericFuncType *) subj_f16_to_ui64_r_minMag,
-#else
-    0,
+    { "f16_to_ui64_r_minMag", (genericFuncType *) subj_f16_to_ui64_r_minMag },
 #endif
 #ifdef SUBJ_F16_TO_UI64_R_MIN
-    (genericFuncType *) subj_f16_to_ui64_r_min,
-#else
-    0,
+    { "f16_to_ui64_r_min", (genericFuncType *) subj_f16_to_ui64_r_min },
 #endif
 #ifdef SUBJ_F16_TO_UI64_R_MAX
-    (genericFuncType *) subj_f16_to_ui64_r_max,
-#else
-    0,
+    { "f16_to_ui64_r_max", (genericFuncType *) subj_f16_to_ui64_r_max },
 #endif
 #ifdef SUBJ_F16_TO_UI64_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f16_to_ui64_r_near_maxMag,
-#else
-    0,
+    {
+        "f16_to_ui64_r_near_maxMag",
+        (genericFuncType *) subj_f16_to_ui64_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F16_TO_I32_R_NEAR_EVEN
-    (genericFuncType *) subj_f16_to_i32_r_near_even,
-#else
-    0,
+    {
+        "f16_to_i32_r_near_even",
+        (genericFuncType *) subj_f16_to_i32_r_near_even
+    },
 #endif
 #ifdef SUBJ_F16_TO_I32_R_MINMAG
-    (genericFuncType *) subj_f16_to_i32_r_minMag,
-#else
-    0,
+    { "f16_to_i32_r_minMag", (genericFuncType *) subj_f16_to_i32_r_minMag },
 #endif
 #ifdef SUBJ_F16_TO_I32_R_MIN
-    (genericFuncType *) subj_f16_to_i32_r_min,
-#else
-    0,
+    { "f16_to_i32_r_min", (genericFuncType *) subj_f16_to_i32_r_min },
 #endif
 #ifdef SUBJ_F16_TO_I32_R_MAX
-    (genericFuncType *) subj_f16_to_i32_r_max,
-#else
-    0,
+    { "f16_to_i32_r_max", (genericFuncType *) subj_f16_to_i32_r_max },
 #endif
 #ifdef SUBJ_F16_TO_I32_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f16_to_i32_r_near_maxMag,
-#else
-    0,
+    {
+        "f16_to_i32_r_near_maxMag",
+        (genericFuncType *) subj_f16_to_i32_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F16_TO_I64_R_NEAR_EVEN
-    (genericFuncType *) subj_f16_to_i64_r_near_even,
-#else
-    0,
+    {
+        "f16_to_i64_r_near_even",
+        (genericFuncType *) subj_f16_to_i64_r_near_even
+    },
 #endif
 #ifdef SUBJ_F16_TO_I64_R_MINMAG
-    (genericFuncType *) subj_f16_to_i64_r_minMag,
-#else
-    0,
+    { "f16_to_i64_r_minMag", (genericFuncType *) subj_f16_to_i64_r_minMag },
 #endif
 #ifdef SUBJ_F16_TO_I64_R_MIN
-    (genericFuncType *) subj_f16_to_i64_r_min,
-#else
-    0,
+    { "f16_to_i64_r_min", (genericFuncType *) subj_f16_to_i64_r_min },
 #endif
 #ifdef SUBJ_F16_TO_I64_R_MAX
-    (genericFuncType *) subj_f16_to_i64_r_max,
-#else
-    0,
+    { "f16_to_i64_r_max", (genericFuncType *) subj_f16_to_i64_r_max },
 #endif
 #ifdef SUBJ_F16_TO_I64_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f16_to_i64_r_near_maxMag,
-#else
-    0,
+    {
+        "f16_to_i64_r_near_maxMag",
+        (genericFuncType *) subj_f16_to_i64_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F16_TO_UI32_RX_NEAR_EVEN
-    (genericFuncType *) subj_f16_to_ui32_rx_near_even,
-#else
-    0,
+    {
+        "f16_to_ui32_rx_near_even",
+        (genericFuncType *) subj_f16_to_ui32_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F16_TO_UI32_RX_MINMAG
-    (genericFuncType *) subj_f16_to_ui32_rx_minMag,
-#else
-    0,
+    {
+        "f16_to_ui32_rx_minMag",
+        (genericFuncType *) subj_f16_to_ui32_rx_minMag
+    },
 #endif
 #ifdef SUBJ_F16_TO_UI32_RX_MIN
-    (genericFuncType *) subj_f16_to_ui32_rx_min,
-#else
-    0,
+    { "f16_to_ui32_rx_min", (genericFuncType *) subj_f16_to_ui32_rx_min },
 #endif
 #ifdef SUBJ_F16_TO_UI32_RX_MAX
-    (genericFuncType *) subj_f16_to_ui32_rx_max,
-#else
-    0,
+    { "f16_to_ui32_rx_max", (genericFuncType *) subj_f16_to_ui32_rx_max },
 #endif
 #ifdef SUBJ_F16_TO_UI32_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f16_to_ui32_rx_near_maxMag,
-#else
-    0,
+    {
+        "f16_to_ui32_rx_near_maxMag",
+        (genericFuncType *) subj_f16_to_ui32_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F16_TO_UI64_RX_NEAR_EVEN
-    (genericFuncType *) subj_f16_to_ui64_rx_near_even,
-#else
-    0,
+    {
+        "f16_to_ui64_rx_near_even",
+        (genericFuncType *) subj_f16_to_ui64_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F16_TO_UI64_RX_MINMAG
-    (genericFuncType *) subj_f16_to_ui64_rx_minMag,
-#else
-    0,
+    {
+        "f16_to_ui64_rx_minMag",
+        (genericFuncType *) subj_f16_to_ui64_rx_minMag
+    },
 #endif
 #ifdef SUBJ_F16_TO_UI64_RX_MIN
-    (genericFuncType *) subj_f16_to_ui64_rx_min,
-#else
-    0,
+    { "f16_to_ui64_rx_min", (genericFuncType *) subj_f16_to_ui64_rx_min },
 #endif
 #ifdef SUBJ_F16_TO_UI64_RX_MAX
-    (genericFuncType *) subj_f16_to_ui64_rx_max,
-#else
-    0,
+    { "f16_to_ui64_rx_max", (genericFuncType *) subj_f16_to_ui64_rx_max },
 #endif
 #ifdef SUBJ_F16_TO_UI64_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f16_to_ui64_rx_near_maxMag,
-#else
-    0,
+    {
+        "f16_to_ui64_rx_near_maxMag",
+        (genericFuncType *) subj_f16_to_ui64_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F16_TO_I32_RX_NEAR_EVEN
-    (genericFuncType *) subj_f16_to_i32_rx_near_even,
-#else
-    0,
+    {
+        "f16_to_i32_rx_near_even",
+        (genericFuncType *) subj_f16_to_i32_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F16_TO_I32_RX_MINMAG
-    (genericFuncType *) subj_f16_to_i32_rx_minMag,
-#else
-    0,
+    { "f16_to_i32_rx_minMag", (genericFuncType *) subj_f16_to_i32_rx_minMag },
 #endif
 #ifdef SUBJ_F16_TO_I32_RX_MIN
-    (genericFuncType *) subj_f16_to_i32_rx_min,
-#else
-    0,
+    { "f16_to_i32_rx_min", (genericFuncType *) subj_f16_to_i32_rx_min },
 #endif
 #ifdef SUBJ_F16_TO_I32_RX_MAX
-    (genericFuncType *) subj_f16_to_i32_rx_max,
-#else
-    0,
+    { "f16_to_i32_rx_max", (genericFuncType *) subj_f16_to_i32_rx_max },
 #endif
 #ifdef SUBJ_F16_TO_I32_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f16_to_i32_rx_near_maxMag,
-#else
-    0,
+    {
+        "f16_to_i32_rx_near_maxMag",
+        (genericFuncType *) subj_f16_to_i32_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F16_TO_I64_RX_NEAR_EVEN
-    (genericFuncType *) subj_f16_to_i64_rx_near_even,
-#else
-    0,
+    {
+        "f16_to_i64_rx_near_even",
+        (genericFuncType *) subj_f16_to_i64_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F16_TO_I64_RX_MINMAG
-    (genericFuncType *) subj_f16_to_i64_rx_minMag,
-#else
-    0,
+    { "f16_to_i64_rx_minMag", (genericFuncType *) subj_f16_to_i64_rx_minMag },
 #endif
 #ifdef SUBJ_F16_TO_I64_RX_MIN
-    (genericFuncType *) subj_f16_to_i64_rx_min,
-#else
-    0,
+    { "f16_to_i64_rx_min", (genericFuncType *) subj_f16_to_i64_rx_min },
 #endif
 #ifdef SUBJ_F16_TO_I64_RX_MAX
-    (genericFuncType *) subj_f16_to_i64_rx_max,
-#else
-    0,
+    { "f16_to_i64_rx_max", (genericFuncType *) subj_f16_to_i64_rx_max },
 #endif
 #ifdef SUBJ_F16_TO_I64_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f16_to_i64_rx_near_maxMag,
-#else
-    0,
+    {
+        "f16_to_i64_rx_near_maxMag",
+        (genericFuncType *) subj_f16_to_i64_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F16_TO_F32
-    (genericFuncType *) subj_f16_to_f32,
-#else
-    0,
+    { "f16_to_f32", (genericFuncType *) subj_f16_to_f32 },
 #endif
 #ifdef FLOAT64
 #ifdef SUBJ_F16_TO_F64
-    (genericFuncType *) subj_f16_to_f64,
-#else
-    0,
+    { "f16_to_f64", (genericFuncType *) subj_f16_to_f64 },
 #endif
 #endif
 #ifdef EXTFLOAT80
 #ifdef SUBJ_F16_TO_EXTF80
-    (genericFuncType *) subj_f16_to_extF80M,
-#else
-    0,
+    { "f16_to_extF80", (genericFuncType *) subj_f16_to_extF80M },
 #endif
 #endif
 #ifdef FLOAT128
 #ifdef SUBJ_F16_TO_F128
-    (genericFuncType *) subj_f16_to_f128M,
-#else
-    0,
+    { "f16_to_f128", (genericFuncType *) subj_f16_to_f128M },
 #endif
 #endif
 #ifdef SUBJ_F16_ROUNDTOINT_R_NEAR_EVEN
-    (genericFuncType *) subj_f16_roundToInt_r_near_even,
-#else
-    0,
+    {
+        "f16_roundToInt_r_near_even",
+        (genericFuncType *) subj_f16_roundToInt_r_near_even
+    },
 #endif
 #ifdef SUBJ_F16_ROUNDTOINT_R_MINMAG
-    (genericFuncType *) subj_f16_roundToInt_r_minMag,
-#else
-    0,
+    {
+        "f16_roundToInt_r_minMag",
+        (genericFuncType *) subj_f16_roundToInt_r_minMag
+    },
 #endif
 #ifdef SUBJ_F16_ROUNDTOINT_R_MIN
-    (genericFuncType *) subj_f16_roundToInt_r_min,
-#else
-    0,
+    { "f16_roundToInt_r_min", (genericFuncType *) subj_f16_roundToInt_r_min },
 #endif
 #ifdef SUBJ_F16_ROUNDTOINT_R_MAX
-    (genericFuncType *) subj_f16_roundToInt_r_max,
-#else
-    0,
+    { "f16_roundToInt_r_max", (genericFuncType *) subj_f16_roundToInt_r_max },
 #endif
 #ifdef SUBJ_F16_ROUNDTOINT_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f16_roundToInt_r_near_maxMag,
-#else
-    0,
+    {
+        "f16_roundToInt_r_near_maxMag",
+        (genericFuncType *) subj_f16_roundToInt_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F16_ROUNDTOINT_X
-    (genericFuncType *) subj_f16_roundToInt_x,
-#else
-    0,
+    { "f16_roundToInt_x", (genericFuncType *) subj_f16_roundToInt_x },
 #endif
 #ifdef SUBJ_F16_ADD
-    (genericFuncType *) subj_f16_add,
-#else
-    0,
+    { "f16_add", (genericFuncType *) subj_f16_add },
 #endif
 #ifdef SUBJ_F16_SUB
-    (genericFuncType *) subj_f16_sub,
-#else
-    0,
+    { "f16_sub", (genericFuncType *) subj_f16_sub },
 #endif
 #ifdef SUBJ_F16_MUL
-    (genericFuncType *) subj_f16_mul,
-#else
-    0,
+    { "f16_mul", (genericFuncType *) subj_f16_mul },
 #endif
 #ifdef SUBJ_F16_MULADD
-    (genericFuncType *) subj_f16_mulAdd,
-#else
-    0,
+    { "f16_mulAdd", (genericFuncType *) subj_f16_mulAdd },
 #endif
 #ifdef SUBJ_F16_DIV
-    (genericFuncType *) subj_f16_div,
-#else
-    0,
+    { "f16_div", (genericFuncType *) subj_f16_div },
 #endif
 #ifdef SUBJ_F16_REM
-    (genericFuncType *) subj_f16_rem,
-#else
-    0,
+    { "f16_rem", (genericFuncType *) subj_f16_rem },
 #endif
 #ifdef SUBJ_F16_SQRT
-    (genericFuncType *) subj_f16_sqrt,
-#else
-    0,
+    { "f16_sqrt", (genericFuncType *) subj_f16_sqrt },
 #endif
 #ifdef SUBJ_F16_EQ
-    (genericFuncType *) subj_f16_eq,
-#else
-    0,
+    { "f16_eq", (genericFuncType *) subj_f16_eq },
 #endif
 #ifdef SUBJ_F16_LE
-    (genericFuncType *) subj_f16_le,
-#else
-    0,
+    { "f16_le", (genericFuncType *) subj_f16_le },
 #endif
 #ifdef SUBJ_F16_LT
-    (genericFuncType *) subj_f16_lt,
-#else
-    0,
+    { "f16_lt", (genericFuncType *) subj_f16_lt },
 #endif
 #ifdef SUBJ_F16_EQ_SIGNALING
-    (genericFuncType *) subj_f16_eq_signaling,
-#else
-    0,
+    { "f16_eq_signaling", (genericFuncType *) subj_f16_eq_signaling },
 #endif
 #ifdef SUBJ_F16_LE_QUIET
-    (genericFuncType *) subj_f16_le_quiet,
-#else
-    0,
+    { "f16_le_quiet", (genericFuncType *) subj_f16_le_quiet },
 #endif
 #ifdef SUBJ_F16_LT_QUIET
-    (genericFuncType *) subj_f16_lt_quiet,
-#else
-    0,
+    { "f16_lt_quiet", (genericFuncType *) subj_f16_lt_quiet },
 #endif
 #endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
 #ifdef SUBJ_F32_TO_UI32_R_NEAR_EVEN
-    (genericFuncType *) subj_f32_to_ui32_r_near_even,
-#else
-    0,
+    {
+        "f32_to_ui32_r_near_even",
+        (genericFuncType *) subj_f32_to_ui32_r_near_even
+    },
 #endif
 #ifdef SUBJ_F32_TO_UI32_R_MINMAG
-    (genericFuncType *) subj_f32_to_ui32_r_minMag,
-#else
-    0,
+    { "f32_to_ui32_r_minMag", (genericFuncType *) subj_f32_to_ui32_r_minMag },
 #endif
 #ifdef SUBJ_F32_TO_UI32_R_MIN
-    (genericFuncType *) subj_f32_to_ui32_r_min,
-#else
-    0,
+    { "f32_to_ui32_r_min", (genericFuncType *) subj_f32_to_ui32_r_min },
 #endif
 #ifdef SUBJ_F32_TO_UI32_R_MAX
-    (genericFuncType *) subj_f32_to_ui32_r_max,
-#else
-    0,
+    { "f32_to_ui32_r_max", (genericFuncType *) subj_f32_to_ui32_r_max },
 #endif
 #ifdef SUBJ_F32_TO_UI32_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f32_to_ui32_r_near_maxMag,
-#else
-    0,
+    {
+        "f32_to_ui32_r_near_maxMag",
+        (genericFuncType *) subj_f32_to_ui32_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F32_TO_UI64_R_NEAR_EVEN
-    (genericFuncType *) subj_f32_to_ui64_r_near_even,
-#else
-    0,
+    {
+        "f32_to_ui64_r_near_even",
+        (genericFuncType *) subj_f32_to_ui64_r_near_even
+    },
 #endif
 #ifdef SUBJ_F32_TO_UI64_R_MINMAG
-    (genericFuncType *) subj_f32_to_ui64_r_minMag,
-#else
-    0,
+    { "f32_to_ui64_r_minMag", (genericFuncType *) subj_f32_to_ui64_r_minMag },
 #endif
 #ifdef SUBJ_F32_TO_UI64_R_MIN
-    (genericFuncType *) subj_f32_to_ui64_r_min,
-#else
-    0,
+    { "f32_to_ui64_r_min", (genericFuncType *) subj_f32_to_ui64_r_min },
 #endif
 #ifdef SUBJ_F32_TO_UI64_R_MAX
-    (genericFuncType *) subj_f32_to_ui64_r_max,
-#else
-    0,
+    { "f32_to_ui64_r_max", (genericFuncType *) subj_f32_to_ui64_r_max },
 #endif
 #ifdef SUBJ_F32_TO_UI64_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f32_to_ui64_r_near_maxMag,
-#else
-    0,
+    {
+        "f32_to_ui64_r_near_maxMag",
+        (genericFuncType *) subj_f32_to_ui64_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F32_TO_I32_R_NEAR_EVEN
-    (genericFuncType *) subj_f32_to_i32_r_near_even,
-#else
-    0,
+    {
+        "f32_to_i32_r_near_even",
+        (genericFuncType *) subj_f32_to_i32_r_near_even
+    },
 #endif
 #ifdef SUBJ_F32_TO_I32_R_MINMAG
-    (genericFuncType *) subj_f32_to_i32_r_minMag,
-#else
-    0,
+    { "f32_to_i32_r_minMag", (genericFuncType *) subj_f32_to_i32_r_minMag },
 #endif
 #ifdef SUBJ_F32_TO_I32_R_MIN
-    (genericFuncType *) subj_f32_to_i32_r_min,
-#else
-    0,
+    { "f32_to_i32_r_min", (genericFuncType *) subj_f32_to_i32_r_min },
 #endif
 #ifdef SUBJ_F32_TO_I32_R_MAX
-    (genericFuncType *) subj_f32_to_i32_r_max,
-#else
-    0,
+    { "f32_to_i32_r_max", (genericFuncType *) subj_f32_to_i32_r_max },
 #endif
 #ifdef SUBJ_F32_TO_I32_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f32_to_i32_r_near_maxMag,
-#else
-    0,
+    {
+        "f32_to_i32_r_near_maxMag",
+        (genericFuncType *) subj_f32_to_i32_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F32_TO_I64_R_NEAR_EVEN
-    (genericFuncType *) subj_f32_to_i64_r_near_even,
-#else
-    0,
+    {
+        "f32_to_i64_r_near_even",
+        (genericFuncType *) subj_f32_to_i64_r_near_even
+    },
 #endif
 #ifdef SUBJ_F32_TO_I64_R_MINMAG
-    (genericFuncType *) subj_f32_to_i64_r_minMag,
-#else
-    0,
+    { "f32_to_i64_r_minMag", (genericFuncType *) subj_f32_to_i64_r_minMag },
 #endif
 #ifdef SUBJ_F32_TO_I64_R_MIN
-    (genericFuncType *) subj_f32_to_i64_r_min,
-#else
-    0,
+    { "f32_to_i64_r_min", (genericFuncType *) subj_f32_to_i64_r_min },
 #endif
 #ifdef SUBJ_F32_TO_I64_R_MAX
-    (genericFuncType *) subj_f32_to_i64_r_max,
-#else
-    0,
+    { "f32_to_i64_r_max", (genericFuncType *) subj_f32_to_i64_r_max },
 #endif
 #ifdef SUBJ_F32_TO_I64_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f32_to_i64_r_near_maxMag,
-#else
-    0,
+    {
+        "f32_to_i64_r_near_maxMag",
+        (genericFuncType *) subj_f32_to_i64_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F32_TO_UI32_RX_NEAR_EVEN
-    (genericFuncType *) subj_f32_to_ui32_rx_near_even,
-#else
-    0,
+    {
+        "f32_to_ui32_rx_near_even",
+        (genericFuncType *) subj_f32_to_ui32_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F32_TO_UI32_RX_MINMAG
-    (genericFuncType *) subj_f32_to_ui32_rx_minMag,
-#else
-    0,
+    {
+        "f32_to_ui32_rx_minMag",
+        (genericFuncType *) subj_f32_to_ui32_rx_minMag
+    },
 #endif
 #ifdef SUBJ_F32_TO_UI32_RX_MIN
-    (genericFuncType *) subj_f32_to_ui32_rx_min,
-#else
-    0,
+    { "f32_to_ui32_rx_min", (genericFuncType *) subj_f32_to_ui32_rx_min },
 #endif
 #ifdef SUBJ_F32_TO_UI32_RX_MAX
-    (genericFuncType *) subj_f32_to_ui32_rx_max,
-#else
-    0,
+    { "f32_to_ui32_rx_max", (genericFuncType *) subj_f32_to_ui32_rx_max },
 #endif
 #ifdef SUBJ_F32_TO_UI32_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f32_to_ui32_rx_near_maxMag,
-#else
-    0,
+    {
+        "f32_to_ui32_rx_near_maxMag",
+        (genericFuncType *) subj_f32_to_ui32_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F32_TO_UI64_RX_NEAR_EVEN
-    (genericFuncType *) subj_f32_to_ui64_rx_near_even,
-#else
-    0,
+    {
+        "f32_to_ui64_rx_near_even",
+        (genericFuncType *) subj_f32_to_ui64_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F32_TO_UI64_RX_MINMAG
-    (genericFuncType *) subj_f32_to_ui64_rx_minMag,
-#else
-    0,
+    {
+        "f32_to_ui64_rx_minMag",
+        (genericFuncType *) subj_f32_to_ui64_rx_minMag
+    },
 #endif
 #ifdef SUBJ_F32_TO_UI64_RX_MIN
-    (genericFuncType *) subj_f32_to_ui64_rx_min,
-#else
-    0,
+    { "f32_to_ui64_rx_min", (genericFuncType *) subj_f32_to_ui64_rx_min },
 #endif
 #ifdef SUBJ_F32_TO_UI64_RX_MAX
-    (genericFuncType *) subj_f32_to_ui64_rx_max,
-#else
-    0,
+    { "f32_to_ui64_rx_max", (genericFuncType *) subj_f32_to_ui64_rx_max },
 #endif
 #ifdef SUBJ_F32_TO_UI64_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f32_to_ui64_rx_near_maxMag,
-#else
-    0,
+    {
+        "f32_to_ui64_rx_near_maxMag",
+        (genericFuncType *) subj_f32_to_ui64_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F32_TO_I32_RX_NEAR_EVEN
-    (genericFuncType *) subj_f32_to_i32_rx_near_even,
-#else
-    0,
+    {
+        "f32_to_i32_rx_near_even",
+        (genericFuncType *) subj_f32_to_i32_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F32_TO_I32_RX_MINMAG
-    (genericFuncType *) subj_f32_to_i32_rx_minMag,
-#else
-    0,
+    { "f32_to_i32_rx_minMag", (genericFuncType *) subj_f32_to_i32_rx_minMag },
 #endif
 #ifdef SUBJ_F32_TO_I32_RX_MIN
-    (genericFuncType *) subj_f32_to_i32_rx_min,
-#else
-    0,
+    { "f32_to_i32_rx_min", (genericFuncType *) subj_f32_to_i32_rx_min },
 #endif
 #ifdef SUBJ_F32_TO_I32_RX_MAX
-    (genericFuncType *) subj_f32_to_i32_rx_max,
-#else
-    0,
+    { "f32_to_i32_rx_max", (genericFuncType *) subj_f32_to_i32_rx_max },
 #endif
 #ifdef SUBJ_F32_TO_I32_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f32_to_i32_rx_near_maxMag,
-#else
-    0,
+    {
+        "f32_to_i32_rx_near_maxMag",
+        (genericFuncType *) subj_f32_to_i32_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F32_TO_I64_RX_NEAR_EVEN
-    (genericFuncType *) subj_f32_to_i64_rx_near_even,
-#else
-    0,
+    {
+        "f32_to_i64_rx_near_even",
+        (genericFuncType *) subj_f32_to_i64_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F32_TO_I64_RX_MINMAG
-    (genericFuncType *) subj_f32_to_i64_rx_minMag,
-#else
-    0,
+    { "f32_to_i64_rx_minMag", (genericFuncType *) subj_f32_to_i64_rx_minMag },
 #endif
 #ifdef SUBJ_F32_TO_I64_RX_MIN
-    (genericFuncType *) subj_f32_to_i64_rx_min,
-#else
-    0,
+    { "f32_to_i64_rx_min", (genericFuncType *) subj_f32_to_i64_rx_min },
 #endif
 #ifdef SUBJ_F32_TO_I64_RX_MAX
-    (genericFuncType *) subj_f32_to_i64_rx_max,
-#else
-    0,
+    { "f32_to_i64_rx_max", (genericFuncType *) subj_f32_to_i64_rx_max },
 #endif
 #ifdef SUBJ_F32_TO_I64_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f32_to_i64_rx_near_maxMag,
-#else
-    0,
+    {
+        "f32_to_i64_rx_near_maxMag",
+        (genericFuncType *) subj_f32_to_i64_rx_near_maxMag
+    },
 #endif
 #ifdef FLOAT16
 #ifdef SUBJ_F32_TO_F16
-    (genericFuncType *) subj_f32_to_f16,
-#else
-    0,
+    { "f32_to_f16", (genericFuncType *) subj_f32_to_f16 },
 #endif
 #endif
 #ifdef FLOAT64
 #ifdef SUBJ_F32_TO_F64
-    (genericFuncType *) subj_f32_to_f64,
-#else
-    0,
+    { "f32_to_f64", (genericFuncType *) subj_f32_to_f64 },
 #endif
 #endif
 #ifdef EXTFLOAT80
 #ifdef SUBJ_F32_TO_EXTF80
-    (genericFuncType *) subj_f32_to_extF80M,
-#else
-    0,
+    { "f32_to_extF80", (genericFuncType *) subj_f32_to_extF80M },
 #endif
 #endif
 #ifdef FLOAT128
 #ifdef SUBJ_F32_TO_F128
-    (genericFuncType *) subj_f32_to_f128M,
-#else
-    0,
+    { "f32_to_f128", (genericFuncType *) subj_f32_to_f128M },
 #endif
 #endif
 #ifdef SUBJ_F32_ROUNDTOINT_R_NEAR_EVEN
-    (genericFuncType *) subj_f32_roundToInt_r_near_even,
-#else
-    0,
+    {
+        "f32_roundToInt_r_near_even",
+        (genericFuncType *) subj_f32_roundToInt_r_near_even
+    },
 #endif
 #ifdef SUBJ_F32_ROUNDTOINT_R_MINMAG
-    (genericFuncType *) subj_f32_roundToInt_r_minMag,
-#else
-    0,
+    {
+        "f32_roundToInt_r_minMag",
+        (genericFuncType *) subj_f32_roundToInt_r_minMag
+    },
 #endif
 #ifdef SUBJ_F32_ROUNDTOINT_R_MIN
-    (genericFuncType *) subj_f32_roundToInt_r_min,
-#else
-    0,
+    { "f32_roundToInt_r_min", (genericFuncType *) subj_f32_roundToInt_r_min },
 #endif
 #ifdef SUBJ_F32_ROUNDTOINT_R_MAX
-    (genericFuncType *) subj_f32_roundToInt_r_max,
-#else
-    0,
+    { "f32_roundToInt_r_max", (genericFuncType *) subj_f32_roundToInt_r_max },
 #endif
 #ifdef SUBJ_F32_ROUNDTOINT_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f32_roundToInt_r_near_maxMag,
-#else
-    0,
+    {
+        "f32_roundToInt_r_near_maxMag",
+        (genericFuncType *) subj_f32_roundToInt_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F32_ROUNDTOINT_X
-    (genericFuncType *) subj_f32_roundToInt_x,
-#else
-    0,
+    { "f32_roundToInt_x", (genericFuncType *) subj_f32_roundToInt_x },
 #endif
 #ifdef SUBJ_F32_ADD
-    (genericFuncType *) subj_f32_add,
-#else
-    0,
+    { "f32_add", (genericFuncType *) subj_f32_add },
 #endif
 #ifdef SUBJ_F32_SUB
-    (genericFuncType *) subj_f32_sub,
-#else
-    0,
+    { "f32_sub", (genericFuncType *) subj_f32_sub },
 #endif
 #ifdef SUBJ_F32_MUL
-    (genericFuncType *) subj_f32_mul,
-#else
-    0,
+    { "f32_mul", (genericFuncType *) subj_f32_mul },
 #endif
 #ifdef SUBJ_F32_MULADD
-    (genericFuncType *) subj_f32_mulAdd,
-#else
-    0,
+    { "f32_mulAdd", (genericFuncType *) subj_f32_mulAdd },
 #endif
 #ifdef SUBJ_F32_DIV
-    (genericFuncType *) subj_f32_div,
-#else
-    0,
+    { "f32_div", (genericFuncType *) subj_f32_div },
 #endif
 #ifdef SUBJ_F32_REM
-    (genericFuncType *) subj_f32_rem,
-#else
-    0,
+    { "f32_rem", (genericFuncType *) subj_f32_rem },
 #endif
 #ifdef SUBJ_F32_SQRT
-    (genericFuncType *) subj_f32_sqrt,
-#else
-    0,
+    { "f32_sqrt", (genericFuncType *) subj_f32_sqrt },
 #endif
 #ifdef SUBJ_F32_EQ
-    (genericFuncType *) subj_f32_eq,
-#else
-    0,
+    { "f32_eq", (genericFuncType *) subj_f32_eq },
 #endif
 #ifdef SUBJ_F32_LE
-    (genericFuncType *) subj_f32_le,
-#else
-    0,
+    { "f32_le", (genericFuncType *) subj_f32_le },
 #endif
 #ifdef SUBJ_F32_LT
-    (genericFuncType *) subj_f32_lt,
-#else
-    0,
+    { "f32_lt", (genericFuncType *) subj_f32_lt },
 #endif
 #ifdef SUBJ_F32_EQ_SIGNALING
-    (genericFuncType *) subj_f32_eq_signaling,
-#else
-    0,
+    { "f32_eq_signaling", (genericFuncType *) subj_f32_eq_signaling },
 #endif
 #ifdef SUBJ_F32_LE_QUIET
-    (genericFuncType *) subj_f32_le_quiet,
-#else
-    0,
+    { "f32_le_quiet", (genericFuncType *) subj_f32_le_quiet },
 #endif
 #ifdef SUBJ_F32_LT_QUIET
-    (genericFuncType *) subj_f32_lt_quiet,
-#else
-    0,
+    { "f32_lt_quiet", (genericFuncType *) subj_f32_lt_quiet },
 #endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
 #ifdef FLOAT64
 #ifdef SUBJ_F64_TO_UI32_R_NEAR_EVEN
-    (genericFuncType *) subj_f64_to_ui32_r_near_even,
-#else
-    0,
+    {
+        "f64_to_ui32_r_near_even",
+        (genericFuncType *) subj_f64_to_ui32_r_near_even
+    },
 #endif
 #ifdef SUBJ_F64_TO_UI32_R_MINMAG
-    (genericFuncType *) subj_f64_to_ui32_r_minMag,
-#else
-    0,
+    { "f64_to_ui32_r_minMag", (genericFuncType *) subj_f64_to_ui32_r_minMag },
 #endif
 #ifdef SUBJ_F64_TO_UI32_R_MIN
-    (genericFuncType *) subj_f64_to_ui32_r_min,
-#else
-    0,
+    { "f64_to_ui32_r_min", (genericFuncType *) subj_f64_to_ui32_r_min },
 #endif
 #ifdef SUBJ_F64_TO_UI32_R_MAX
-    (genericFuncType *) subj_f64_to_ui32_r_max,
-#else
-    0,
+    { "f64_to_ui32_r_max", (genericFuncType *) subj_f64_to_ui32_r_max },
 #endif
 #ifdef SUBJ_F64_TO_UI32_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f64_to_ui32_r_near_maxMag,
-#else
-    0,
+    {
+        "f64_to_ui32_r_near_maxMag",
+        (genericFuncType *) subj_f64_to_ui32_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F64_TO_UI64_R_NEAR_EVEN
-    (genericFuncType *) subj_f64_to_ui64_r_near_even,
-#else
-    0,
+    {
+        "f64_to_ui64_r_near_even",
+        (genericFuncType *) subj_f64_to_ui64_r_near_even
+    },
 #endif
 #ifdef SUBJ_F64_TO_UI64_R_MINMAG
-    (genericFuncType *) subj_f64_to_ui64_r_minMag,
-#else
-    0,
+    { "f64_to_ui64_r_minMag", (genericFuncType *) subj_f64_to_ui64_r_minMag },
 #endif
 #ifdef SUBJ_F64_TO_UI64_R_MIN
-    (genericFuncType *) subj_f64_to_ui64_r_min,
-#else
-    0,
+    { "f64_to_ui64_r_min", (genericFuncType *) subj_f64_to_ui64_r_min },
 #endif
 #ifdef SUBJ_F64_TO_UI64_R_MAX
-    (genericFuncType *) subj_f64_to_ui64_r_max,
-#else
-    0,
+    { "f64_to_ui64_r_max", (genericFuncType *) subj_f64_to_ui64_r_max },
 #endif
 #ifdef SUBJ_F64_TO_UI64_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f64_to_ui64_r_near_maxMag,
-#else
-    0,
+    {
+        "f64_to_ui64_r_near_maxMag",
+        (genericFuncType *) subj_f64_to_ui64_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F64_TO_I32_R_NEAR_EVEN
-    (genericFuncType *) subj_f64_to_i32_r_near_even,
-#else
-    0,
+    {
+        "f64_to_i32_r_near_even",
+        (genericFuncType *) subj_f64_to_i32_r_near_even
+    },
 #endif
 #ifdef SUBJ_F64_TO_I32_R_MINMAG
-    (genericFuncType *) subj_f64_to_i32_r_minMag,
-#else
-    0,
+    { "f64_to_i32_r_minMag", (genericFuncType *) subj_f64_to_i32_r_minMag },
 #endif
 #ifdef SUBJ_F64_TO_I32_R_MIN
-    (genericFuncType *) subj_f64_to_i32_r_min,
-#else
-    0,
+    { "f64_to_i32_r_min", (genericFuncType *) subj_f64_to_i32_r_min },
 #endif
 #ifdef SUBJ_F64_TO_I32_R_MAX
-    (genericFuncType *) subj_f64_to_i32_r_max,
-#else
-    0,
+    { "f64_to_i32_r_max", (genericFuncType *) subj_f64_to_i32_r_max },
 #endif
 #ifdef SUBJ_F64_TO_I32_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f64_to_i32_r_near_maxMag,
-#else
-    0,
+    {
+        "f64_to_i32_r_near_maxMag",
+        (genericFuncType *) subj_f64_to_i32_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F64_TO_I64_R_NEAR_EVEN
-    (genericFuncType *) subj_f64_to_i64_r_near_even,
-#else
-    0,
+    {
+        "f64_to_i64_r_near_even",
+        (genericFuncType *) subj_f64_to_i64_r_near_even
+    },
 #endif
 #ifdef SUBJ_F64_TO_I64_R_MINMAG
-    (genericFuncType *) subj_f64_to_i64_r_minMag,
-#else
-    0,
+    { "f64_to_i64_r_minMag", (genericFuncType *) subj_f64_to_i64_r_minMag },
 #endif
 #ifdef SUBJ_F64_TO_I64_R_MIN
-    (genericFuncType *) subj_f64_to_i64_r_min,
-#else
-    0,
+    { "f64_to_i64_r_min", (genericFuncType *) subj_f64_to_i64_r_min },
 #endif
 #ifdef SUBJ_F64_TO_I64_R_MAX
-    (genericFuncType *) subj_f64_to_i64_r_max,
-#else
-    0,
+    { "f64_to_i64_r_max", (genericFuncType *) subj_f64_to_i64_r_max },
 #endif
 #ifdef SUBJ_F64_TO_I64_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f64_to_i64_r_near_maxMag,
-#else
-    0,
+    {
+        "f64_to_i64_r_near_maxMag",
+        (genericFuncType *) subj_f64_to_i64_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F64_TO_UI32_RX_NEAR_EVEN
-    (genericFuncType *) subj_f64_to_ui32_rx_near_even,
-#else
-    0,
+    {
+        "f64_to_ui32_rx_near_even",
+        (genericFuncType *) subj_f64_to_ui32_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F64_TO_UI32_RX_MINMAG
-    (genericFuncType *) subj_f64_to_ui32_rx_minMag,
-#else
-    0,
+    {
+        "f64_to_ui32_rx_minMag",
+        (genericFuncType *) subj_f64_to_ui32_rx_minMag
+    },
 #endif
 #ifdef SUBJ_F64_TO_UI32_RX_MIN
-    (genericFuncType *) subj_f64_to_ui32_rx_min,
-#else
-    0,
+    { "f64_to_ui32_rx_min", (genericFuncType *) subj_f64_to_ui32_rx_min },
 #endif
 #ifdef SUBJ_F64_TO_UI32_RX_MAX
-    (genericFuncType *) subj_f64_to_ui32_rx_max,
-#else
-    0,
+    { "f64_to_ui32_rx_max", (genericFuncType *) subj_f64_to_ui32_rx_max },
 #endif
 #ifdef SUBJ_F64_TO_UI32_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f64_to_ui32_rx_near_maxMag,
-#else
-    0,
+    {
+        "f64_to_ui32_rx_near_maxMag",
+        (genericFuncType *) subj_f64_to_ui32_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F64_TO_UI64_RX_NEAR_EVEN
-    (genericFuncType *) subj_f64_to_ui64_rx_near_even,
-#else
-    0,
+    {
+        "f64_to_ui64_rx_near_even",
+        (genericFuncType *) subj_f64_to_ui64_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F64_TO_UI64_RX_MINMAG
-    (genericFuncType *) subj_f64_to_ui64_rx_minMag,
-#else
-    0,
+    {
+        "f64_to_ui64_rx_minMag",
+        (genericFuncType *) subj_f64_to_ui64_rx_minMag
+    },
 #endif
 #ifdef SUBJ_F64_TO_UI64_RX_MIN
-    (genericFuncType *) subj_f64_to_ui64_rx_min,
-#else
-    0,
+    { "f64_to_ui64_rx_min", (genericFuncType *) subj_f64_to_ui64_rx_min },
 #endif
 #ifdef SUBJ_F64_TO_UI64_RX_MAX
-    (genericFuncType *) subj_f64_to_ui64_rx_max,
-#else
-    0,
+    { "f64_to_ui64_rx_max", (genericFuncType *) subj_f64_to_ui64_rx_max },
 #endif
 #ifdef SUBJ_F64_TO_UI64_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f64_to_ui64_rx_near_maxMag,
-#else
-    0,
+    {
+        "f64_to_ui64_rx_near_maxMag",
+        (genericFuncType *) subj_f64_to_ui64_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F64_TO_I32_RX_NEAR_EVEN
-    (genericFuncType *) subj_f64_to_i32_rx_near_even,
-#else
-    0,
+    {
+        "f64_to_i32_rx_near_even",
+        (genericFuncType *) subj_f64_to_i32_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F64_TO_I32_RX_MINMAG
-    (genericFuncType *) subj_f64_to_i32_rx_minMag,
-#else
-    0,
+    { "f64_to_i32_rx_minMag", (genericFuncType *) subj_f64_to_i32_rx_minMag },
 #endif
 #ifdef SUBJ_F64_TO_I32_RX_MIN
-    (genericFuncType *) subj_f64_to_i32_rx_min,
-#else
-    0,
+    { "f64_to_i32_rx_min", (genericFuncType *) subj_f64_to_i32_rx_min },
 #endif
 #ifdef SUBJ_F64_TO_I32_RX_MAX
-    (genericFuncType *) subj_f64_to_i32_rx_max,
-#else
-    0,
+    { "f64_to_i32_rx_max", (genericFuncType *) subj_f64_to_i32_rx_max },
 #endif
 #ifdef SUBJ_F64_TO_I32_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f64_to_i32_rx_near_maxMag,
-#else
-    0,
+    {
+        "f64_to_i32_rx_near_maxMag",
+        (genericFuncType *) subj_f64_to_i32_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F64_TO_I64_RX_NEAR_EVEN
-    (genericFuncType *) subj_f64_to_i64_rx_near_even,
-#else
-    0,
+    {
+        "f64_to_i64_rx_near_even",
+        (genericFuncType *) subj_f64_to_i64_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F64_TO_I64_RX_MINMAG
-    (genericFuncType *) subj_f64_to_i64_rx_minMag,
-#else
-    0,
+    { "f64_to_i64_rx_minMag", (genericFuncType *) subj_f64_to_i64_rx_minMag },
 #endif
 #ifdef SUBJ_F64_TO_I64_RX_MIN
-    (genericFuncType *) subj_f64_to_i64_rx_min,
-#else
-    0,
+    { "f64_to_i64_rx_min", (genericFuncType *) subj_f64_to_i64_rx_min },
 #endif
 #ifdef SUBJ_F64_TO_I64_RX_MAX
-    (genericFuncType *) subj_f64_to_i64_rx_max,
-#else
-    0,
+    { "f64_to_i64_rx_max", (genericFuncType *) subj_f64_to_i64_rx_max },
 #endif
 #ifdef SUBJ_F64_TO_I64_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f64_to_i64_rx_near_maxMag,
-#else
-    0,
+    {
+        "f64_to_i64_rx_near_maxMag",
+        (genericFuncType *) subj_f64_to_i64_rx_near_maxMag
+    },
 #endif
 #ifdef FLOAT16
 #ifdef SUBJ_F64_TO_F16
-    (genericFuncType *) subj_f64_to_f16,
-#else
-    0,
+    { "f64_to_f16", (genericFuncType *) subj_f64_to_f16 },
 #endif
 #endif
 #ifdef SUBJ_F64_TO_F32
-    (genericFuncType *) subj_f64_to_f32,
-#else
-    0,
+    { "f64_to_f32", (genericFuncType *) subj_f64_to_f32 },
 #endif
 #ifdef EXTFLOAT80
 #ifdef SUBJ_F64_TO_EXTF80
-    (genericFuncType *) subj_f64_to_extF80M,
-#else
-    0,
+    { "f64_to_extF80", (genericFuncType *) subj_f64_to_extF80M },
 #endif
 #endif
 #ifdef FLOAT128
 #ifdef SUBJ_F64_TO_F128
-    (genericFuncType *) subj_f64_to_f128M,
-#else
-    0,
+    { "f64_to_f128", (genericFuncType *) subj_f64_to_f128M },
 #endif
 #endif
 #ifdef SUBJ_F64_ROUNDTOINT_R_NEAR_EVEN
-    (genericFuncType *) subj_f64_roundToInt_r_near_even,
-#else
-    0,
+    {
+        "f64_roundToInt_r_near_even",
+        (genericFuncType *) subj_f64_roundToInt_r_near_even
+    },
 #endif
 #ifdef SUBJ_F64_ROUNDTOINT_R_MINMAG
-    (genericFuncType *) subj_f64_roundToInt_r_minMag,
-#else
-    0,
+    {
+        "f64_roundToInt_r_minMag",
+        (genericFuncType *) subj_f64_roundToInt_r_minMag
+    },
 #endif
 #ifdef SUBJ_F64_ROUNDTOINT_R_MIN
-    (genericFuncType *) subj_f64_roundToInt_r_min,
-#else
-    0,
+    { "f64_roundToInt_r_min", (genericFuncType *) subj_f64_roundToInt_r_min },
 #endif
 #ifdef SUBJ_F64_ROUNDTOINT_R_MAX
-    (genericFuncType *) subj_f64_roundToInt_r_max,
-#else
-    0,
+    { "f64_roundToInt_r_max", (genericFuncType *) subj_f64_roundToInt_r_max },
 #endif
 #ifdef SUBJ_F64_ROUNDTOINT_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f64_roundToInt_r_near_maxMag,
-#else
-    0,
+    {
+        "f64_roundToInt_r_near_maxMag",
+        (genericFuncType *) subj_f64_roundToInt_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F64_ROUNDTOINT_X
-    (genericFuncType *) subj_f64_roundToInt_x,
-#else
-    0,
+    { "f64_roundToInt_x", (genericFuncType *) subj_f64_roundToInt_x },
 #endif
 #ifdef SUBJ_F64_ADD
-    (genericFuncType *) subj_f64_add,
-#else
-    0,
+    { "f64_add", (genericFuncType *) subj_f64_add },
 #endif
 #ifdef SUBJ_F64_SUB
-    (genericFuncType *) subj_f64_sub,
-#else
-    0,
+    { "f64_sub", (genericFuncType *) subj_f64_sub },
 #endif
 #ifdef SUBJ_F64_MUL
-    (genericFuncType *) subj_f64_mul,
-#else
-    0,
+    { "f64_mul", (genericFuncType *) subj_f64_mul },
 #endif
 #ifdef SUBJ_F64_MULADD
-    (genericFuncType *) subj_f64_mulAdd,
-#else
-    0,
+    { "f64_mulAdd", (genericFuncType *) subj_f64_mulAdd },
 #endif
 #ifdef SUBJ_F64_DIV
-    (genericFuncType *) subj_f64_div,
-#else
-    0,
+    { "f64_div", (genericFuncType *) subj_f64_div },
 #endif
 #ifdef SUBJ_F64_REM
-    (genericFuncType *) subj_f64_rem,
-#else
-    0,
+    { "f64_rem", (genericFuncType *) subj_f64_rem },
 #endif
 #ifdef SUBJ_F64_SQRT
-    (genericFuncType *) subj_f64_sqrt,
-#else
-    0,
+    { "f64_sqrt", (genericFuncType *) subj_f64_sqrt },
 #endif
 #ifdef SUBJ_F64_EQ
-    (genericFuncType *) subj_f64_eq,
-#else
-    0,
+    { "f64_eq", (genericFuncType *) subj_f64_eq },
 #endif
 #ifdef SUBJ_F64_LE
-    (genericFuncType *) subj_f64_le,
-#else
-    0,
+    { "f64_le", (genericFuncType *) subj_f64_le },
 #endif
 #ifdef SUBJ_F64_LT
-    (genericFuncType *) subj_f64_lt,
-#else
-    0,
+    { "f64_lt", (genericFuncType *) subj_f64_lt },
 #endif
 #ifdef SUBJ_F64_EQ_SIGNALING
-    (genericFuncType *) subj_f64_eq_signaling,
-#else
-    0,
+    { "f64_eq_signaling", (genericFuncType *) subj_f64_eq_signaling },
 #endif
 #ifdef SUBJ_F64_LE_QUIET
-    (genericFuncType *) subj_f64_le_quiet,
-#else
-    0,
+    { "f64_le_quiet", (genericFuncType *) subj_f64_le_quiet },
 #endif
 #ifdef SUBJ_F64_LT_QUIET
-    (genericFuncType *) subj_f64_lt_quiet,
-#else
-    0,
+    { "f64_lt_quiet", (genericFuncType *) subj_f64_lt_quiet },
 #endif
 #endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
 #ifdef EXTFLOAT80
 #ifdef SUBJ_EXTF80_TO_UI32_R_NEAR_EVEN
-    (genericFuncType *) subj_extF80M_to_ui32_r_near_even,
-#else
-    0,
+    {
+        "extF80_to_ui32_r_near_even",
+        (genericFuncType *) subj_extF80M_to_ui32_r_near_even
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI32_R_MINMAG
-    (genericFuncType *) subj_extF80M_to_ui32_r_minMag,
-#else
-    0,
+    {
+        "extF80_to_ui32_r_minMag",
+        (genericFuncType *) subj_extF80M_to_ui32_r_minMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI32_R_MIN
-    (genericFuncType *) subj_extF80M_to_ui32_r_min,
-#else
-    0,
+    { "extF80_to_ui32_r_min", (genericFuncType *) subj_extF80M_to_ui32_r_min },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI32_R_MAX
-    (genericFuncType *) subj_extF80M_to_ui32_r_max,
-#else
-    0,
+    { "extF80_to_ui32_r_max", (genericFuncType *) subj_extF80M_to_ui32_r_max },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI32_R_NEAR_MAXMAG
-    (genericFuncType *) subj_extF80M_to_ui32_r_near_maxMag,
-#else
-    0,
+    {
+        "extF80_to_ui32_r_near_maxMag",
+        (genericFuncType *) subj_extF80M_to_ui32_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI64_R_NEAR_EVEN
-    (genericFuncType *) subj_extF80M_to_ui64_r_near_even,
-#else
-    0,
+    {
+        "extF80_to_ui64_r_near_even",
+        (genericFuncType *) subj_extF80M_to_ui64_r_near_even
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI64_R_MINMAG
-    (genericFuncType *) subj_extF80M_to_ui64_r_minMag,
-#else
-    0,
+    {
+        "extF80_to_ui64_r_minMag",
+        (genericFuncType *) subj_extF80M_to_ui64_r_minMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI64_R_MIN
-    (genericFuncType *) subj_extF80M_to_ui64_r_min,
-#else
-    0,
+    { "extF80_to_ui64_r_min", (genericFuncType *) subj_extF80M_to_ui64_r_min },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI64_R_MAX
-    (genericFuncType *) subj_extF80M_to_ui64_r_max,
-#else
-    0,
+    { "extF80_to_ui64_r_max", (genericFuncType *) subj_extF80M_to_ui64_r_max },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI64_R_NEAR_MAXMAG
-    (genericFuncType *) subj_extF80M_to_ui64_r_near_maxMag,
-#else
-    0,
+    {
+        "extF80_to_ui64_r_near_maxMag",
+        (genericFuncType *) subj_extF80M_to_ui64_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_I32_R_NEAR_EVEN
-    (genericFuncType *) subj_extF80M_to_i32_r_near_even,
-#else
-    0,
+    {
+        "extF80_to_i32_r_near_even",
+        (genericFuncType *) subj_extF80M_to_i32_r_near_even
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_I32_R_MINMAG
-    (genericFuncType *) subj_extF80M_to_i32_r_minMag,
-#else
-    0,
+    {
+        "extF80_to_i32_r_minMag",
+        (genericFuncType *) subj_extF80M_to_i32_r_minMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_I32_R_MIN
-    (genericFuncType *) subj_extF80M_to_i32_r_min,
-#else
-    0,
+    { "extF80_to_i32_r_min", (genericFuncType *) subj_extF80M_to_i32_r_min },
 #endif
 #ifdef SUBJ_EXTF80_TO_I32_R_MAX
-    (genericFuncType *) subj_extF80M_to_i32_r_max,
-#else
-    0,
+    { "extF80_to_i32_r_max", (genericFuncType *) subj_extF80M_to_i32_r_max },
 #endif
 #ifdef SUBJ_EXTF80_TO_I32_R_NEAR_MAXMAG
-    (genericFuncType *) subj_extF80M_to_i32_r_near_maxMag,
-#else
-    0,
+    {
+        "extF80_to_i32_r_near_maxMag",
+        (genericFuncType *) subj_extF80M_to_i32_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_I64_R_NEAR_EVEN
-    (genericFuncType *) subj_extF80M_to_i64_r_near_even,
-#else
-    0,
+    {
+        "extF80_to_i64_r_near_even",
+        (genericFuncType *) subj_extF80M_to_i64_r_near_even
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_I64_R_MINMAG
-    (genericFuncType *) subj_extF80M_to_i64_r_minMag,
-#else
-    0,
+    {
+        "extF80_to_i64_r_minMag",
+        (genericFuncType *) subj_extF80M_to_i64_r_minMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_I64_R_MIN
-    (genericFuncType *) subj_extF80M_to_i64_r_min,
-#else
-    0,
+    { "extF80_to_i64_r_min", (genericFuncType *) subj_extF80M_to_i64_r_min },
 #endif
 #ifdef SUBJ_EXTF80_TO_I64_R_MAX
-    (genericFuncType *) subj_extF80M_to_i64_r_max,
-#else
-    0,
+    { "extF80_to_i64_r_max", (genericFuncType *) subj_extF80M_to_i64_r_max },
 #endif
 #ifdef SUBJ_EXTF80_TO_I64_R_NEAR_MAXMAG
-    (genericFuncType *) subj_extF80M_to_i64_r_near_maxMag,
-#else
-    0,
+    {
+        "extF80_to_i64_r_near_maxMag",
+        (genericFuncType *) subj_extF80M_to_i64_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI32_RX_NEAR_EVEN
-    (genericFuncType *) subj_extF80M_to_ui32_rx_near_even,
-#else
-    0,
+    {
+        "extF80_to_ui32_rx_near_even",
+        (genericFuncType *) subj_extF80M_to_ui32_rx_near_even
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI32_RX_MINMAG
-    (genericFuncType *) subj_extF80M_to_ui32_rx_minMag,
-#else
-    0,
+    {
+        "extF80_to_ui32_rx_minMag",
+        (genericFuncType *) subj_extF80M_to_ui32_rx_minMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI32_RX_MIN
-    (genericFuncType *) subj_extF80M_to_ui32_rx_min,
-#else
-    0,
+    {
+        "extF80_to_ui32_rx_min",
+        (genericFuncType *) subj_extF80M_to_ui32_rx_min
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI32_RX_MAX
-    (genericFuncType *) subj_extF80M_to_ui32_rx_max,
-#else
-    0,
+    {
+        "extF80_to_ui32_rx_max",
+        (genericFuncType *) subj_extF80M_to_ui32_rx_max
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI32_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_extF80M_to_ui32_rx_near_maxMag,
-#else
-    0,
+    {
+        "extF80_to_ui32_rx_near_maxMag",
+        (genericFuncType *) subj_extF80M_to_ui32_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI64_RX_NEAR_EVEN
-    (genericFuncType *) subj_extF80M_to_ui64_rx_near_even,
-#else
-    0,
+    {
+        "extF80_to_ui64_rx_near_even",
+        (genericFuncType *) subj_extF80M_to_ui64_rx_near_even
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI64_RX_MINMAG
-    (genericFuncType *) subj_extF80M_to_ui64_rx_minMag,
-#else
-    0,
+    {
+        "extF80_to_ui64_rx_minMag",
+        (genericFuncType *) subj_extF80M_to_ui64_rx_minMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI64_RX_MIN
-    (genericFuncType *) subj_extF80M_to_ui64_rx_min,
-#else
-    0,
+    {
+        "extF80_to_ui64_rx_min",
+        (genericFuncType *) subj_extF80M_to_ui64_rx_min
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI64_RX_MAX
-    (genericFuncType *) subj_extF80M_to_ui64_rx_max,
-#else
-    0,
+    {
+        "extF80_to_ui64_rx_max",
+        (genericFuncType *) subj_extF80M_to_ui64_rx_max
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_UI64_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_extF80M_to_ui64_rx_near_maxMag,
-#else
-    0,
+    {
+        "extF80_to_ui64_rx_near_maxMag",
+        (genericFuncType *) subj_extF80M_to_ui64_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_I32_RX_NEAR_EVEN
-    (genericFuncType *) subj_extF80M_to_i32_rx_near_even,
-#else
-    0,
+    {
+        "extF80_to_i32_rx_near_even",
+        (genericFuncType *) subj_extF80M_to_i32_rx_near_even
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_I32_RX_MINMAG
-    (genericFuncType *) subj_extF80M_to_i32_rx_minMag,
-#else
-    0,
+    {
+        "extF80_to_i32_rx_minMag",
+        (genericFuncType *) subj_extF80M_to_i32_rx_minMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_I32_RX_MIN
-    (genericFuncType *) subj_extF80M_to_i32_rx_min,
-#else
-    0,
+    { "extF80_to_i32_rx_min", (genericFuncType *) subj_extF80M_to_i32_rx_min },
 #endif
 #ifdef SUBJ_EXTF80_TO_I32_RX_MAX
-    (genericFuncType *) subj_extF80M_to_i32_rx_max,
-#else
-    0,
+    { "extF80_to_i32_rx_max", (genericFuncType *) subj_extF80M_to_i32_rx_max },
 #endif
 #ifdef SUBJ_EXTF80_TO_I32_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_extF80M_to_i32_rx_near_maxMag,
-#else
-    0,
+    {
+        "extF80_to_i32_rx_near_maxMag",
+        (genericFuncType *) subj_extF80M_to_i32_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_I64_RX_NEAR_EVEN
-    (genericFuncType *) subj_extF80M_to_i64_rx_near_even,
-#else
-    0,
+    {
+        "extF80_to_i64_rx_near_even",
+        (genericFuncType *) subj_extF80M_to_i64_rx_near_even
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_I64_RX_MINMAG
-    (genericFuncType *) subj_extF80M_to_i64_rx_minMag,
-#else
-    0,
+    {
+        "extF80_to_i64_rx_minMag",
+        (genericFuncType *) subj_extF80M_to_i64_rx_minMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_TO_I64_RX_MIN
-    (genericFuncType *) subj_extF80M_to_i64_rx_min,
-#else
-    0,
+    { "extF80_to_i64_rx_min", (genericFuncType *) subj_extF80M_to_i64_rx_min },
 #endif
 #ifdef SUBJ_EXTF80_TO_I64_RX_MAX
-    (genericFuncType *) subj_extF80M_to_i64_rx_max,
-#else
-    0,
+    { "extF80_to_i64_rx_max", (genericFuncType *) subj_extF80M_to_i64_rx_max },
 #endif
 #ifdef SUBJ_EXTF80_TO_I64_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_extF80M_to_i64_rx_near_maxMag,
-#else
-    0,
+    {
+        "extF80_to_i64_rx_near_maxMag",
+        (genericFuncType *) subj_extF80M_to_i64_rx_near_maxMag
+    },
 #endif
 #ifdef FLOAT16
 #ifdef SUBJ_EXTF80_TO_F16
-    (genericFuncType *) subj_extF80M_to_f16,
-#else
-    0,
+    { "extF80_to_f16", (genericFuncType *) subj_extF80M_to_f16 },
 #endif
 #endif
 #ifdef SUBJ_EXTF80_TO_F32
-    (genericFuncType *) subj_extF80M_to_f32,
-#else
-    0,
+    { "extF80_to_f32", (genericFuncType *) subj_extF80M_to_f32 },
 #endif
 #ifdef FLOAT64
 #ifdef SUBJ_EXTF80_TO_F64
-    (genericFuncType *) subj_extF80M_to_f64,
-#else
-    0,
+    { "extF80_to_f64", (genericFuncType *) subj_extF80M_to_f64 },
 #endif
 #endif
 #ifdef FLOAT128
 #ifdef SUBJ_EXTF80_TO_F128
-    (genericFuncType *) subj_extF80M_to_f128M,
-#else
-    0,
+    { "extF80_to_f128", (genericFuncType *) subj_extF80M_to_f128M },
 #endif
 #endif
 #ifdef SUBJ_EXTF80_ROUNDTOINT_R_NEAR_EVEN
-    (genericFuncType *) subj_extF80M_roundToInt_r_near_even,
-#else
-    0,
+    {
+        "extF80_roundToInt_r_near_even",
+        (genericFuncType *) subj_extF80M_roundToInt_r_near_even
+    },
 #endif
 #ifdef SUBJ_EXTF80_ROUNDTOINT_R_MINMAG
-    (genericFuncType *) subj_extF80M_roundToInt_r_minMag,
-#else
-    0,
+    {
+        "extF80_roundToInt_r_minMag",
+        (genericFuncType *) subj_extF80M_roundToInt_r_minMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_ROUNDTOINT_R_MIN
-    (genericFuncType *) subj_extF80M_roundToInt_r_min,
-#else
-    0,
+    {
+        "extF80_roundToInt_r_min",
+        (genericFuncType *) subj_extF80M_roundToInt_r_min
+    },
 #endif
 #ifdef SUBJ_EXTF80_ROUNDTOINT_R_MAX
-    (genericFuncType *) subj_extF80M_roundToInt_r_max,
-#else
-    0,
+    {
+        "extF80_roundToInt_r_max",
+        (genericFuncType *) subj_extF80M_roundToInt_r_max
+    },
 #endif
 #ifdef SUBJ_EXTF80_ROUNDTOINT_R_NEAR_MAXMAG
-    (genericFuncType *) subj_extF80M_roundToInt_r_near_maxMag,
-#else
-    0,
+    {
+        "extF80_roundToInt_r_near_maxMag",
+        (genericFuncType *) subj_extF80M_roundToInt_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_EXTF80_ROUNDTOINT_X
-    (genericFuncType *) subj_extF80M_roundToInt_x,
-#else
-    0,
+    { "extF80_roundToInt_x", (genericFuncType *) subj_extF80M_roundToInt_x },
 #endif
 #ifdef SUBJ_EXTF80_ADD
-    (genericFuncType *) subj_extF80M_add,
-#else
-    0,
+    { "extF80_add", (genericFuncType *) subj_extF80M_add },
 #endif
 #ifdef SUBJ_EXTF80_SUB
-    (genericFuncType *) subj_extF80M_sub,
-#else
-    0,
+    { "extF80_sub", (genericFuncType *) subj_extF80M_sub },
 #endif
 #ifdef SUBJ_EXTF80_MUL
-    (genericFuncType *) subj_extF80M_mul,
-#else
-    0,
+    { "extF80_mul", (genericFuncType *) subj_extF80M_mul },
 #endif
 #ifdef SUBJ_EXTF80_DIV
-    (genericFuncType *) subj_extF80M_div,
-#else
-    0,
+    { "extF80_div", (genericFuncType *) subj_extF80M_div },
 #endif
 #ifdef SUBJ_EXTF80_REM
-    (genericFuncType *) subj_extF80M_rem,
-#else
-    0,
+    { "extF80_rem", (genericFuncType *) subj_extF80M_rem },
 #endif
 #ifdef SUBJ_EXTF80_SQRT
-    (genericFuncType *) subj_extF80M_sqrt,
-#else
-    0,
+    { "extF80_sqrt", (genericFuncType *) subj_extF80M_sqrt },
 #endif
 #ifdef SUBJ_EXTF80_EQ
-    (genericFuncType *) subj_extF80M_eq,
-#else
-    0,
+    { "extF80_eq", (genericFuncType *) subj_extF80M_eq },
 #endif
 #ifdef SUBJ_EXTF80_LE
-    (genericFuncType *) subj_extF80M_le,
-#else
-    0,
+    { "extF80_le", (genericFuncType *) subj_extF80M_le },
 #endif
 #ifdef SUBJ_EXTF80_LT
-    (genericFuncType *) subj_extF80M_lt,
-#else
-    0,
+    { "extF80_lt", (genericFuncType *) subj_extF80M_lt },
 #endif
 #ifdef SUBJ_EXTF80_EQ_SIGNALING
-    (genericFuncType *) subj_extF80M_eq_signaling,
-#else
-    0,
+    { "extF80_eq_signaling", (genericFuncType *) subj_extF80M_eq_signaling },
 #endif
 #ifdef SUBJ_EXTF80_LE_QUIET
-    (genericFuncType *) subj_extF80M_le_quiet,
-#else
-    0,
+    { "extF80_le_quiet", (genericFuncType *) subj_extF80M_le_quiet },
 #endif
 #ifdef SUBJ_EXTF80_LT_QUIET
-    (genericFuncType *) subj_extF80M_lt_quiet,
-#else
-    0,
+    { "extF80_lt_quiet", (genericFuncType *) subj_extF80M_lt_quiet },
 #endif
 #endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
 #ifdef FLOAT128
 #ifdef SUBJ_F128_TO_UI32_R_NEAR_EVEN
-    (genericFuncType *) subj_f128M_to_ui32_r_near_even,
-#else
-    0,
+    {
+        "f128_to_ui32_r_near_even",
+        (genericFuncType *) subj_f128M_to_ui32_r_near_even
+    },
 #endif
 #ifdef SUBJ_F128_TO_UI32_R_MINMAG
-    (genericFuncType *) subj_f128M_to_ui32_r_minMag,
-#else
-    0,
+    {
+        "f128_to_ui32_r_minMag",
+        (genericFuncType *) subj_f128M_to_ui32_r_minMag
+    },
 #endif
 #ifdef SUBJ_F128_TO_UI32_R_MIN
-    (genericFuncType *) subj_f128M_to_ui32_r_min,
-#else
-    0,
+    { "f128_to_ui32_r_min", (genericFuncType *) subj_f128M_to_ui32_r_min },
 #endif
 #ifdef SUBJ_F128_TO_UI32_R_MAX
-    (genericFuncType *) subj_f128M_to_ui32_r_max,
-#else
-    0,
+    { "f128_to_ui32_r_max", (genericFuncType *) subj_f128M_to_ui32_r_max },
 #endif
 #ifdef SUBJ_F128_TO_UI32_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f128M_to_ui32_r_near_maxMag,
-#else
-    0,
+    {
+        "f128_to_ui32_r_near_maxMag",
+        (genericFuncType *) subj_f128M_to_ui32_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F128_TO_UI64_R_NEAR_EVEN
-    (genericFuncType *) subj_f128M_to_ui64_r_near_even,
-#else
-    0,
+    {
+        "f128_to_ui64_r_near_even",
+        (genericFuncType *) subj_f128M_to_ui64_r_near_even
+    },
 #endif
 #ifdef SUBJ_F128_TO_UI64_R_MINMAG
-    (genericFuncType *) subj_f128M_to_ui64_r_minMag,
-#else
-    0,
+    {
+        "f128_to_ui64_r_minMag",
+        (genericFuncType *) subj_f128M_to_ui64_r_minMag
+    },
 #endif
 #ifdef SUBJ_F128_TO_UI64_R_MIN
-    (genericFuncType *) subj_f128M_to_ui64_r_min,
-#else
-    0,
+    { "f128_to_ui64_r_min", (genericFuncType *) subj_f128M_to_ui64_r_min },
 #endif
 #ifdef SUBJ_F128_TO_UI64_R_MAX
-    (genericFuncType *) subj_f128M_to_ui64_r_max,
-#else
-    0,
+    { "f128_to_ui64_r_max", (genericFuncType *) subj_f128M_to_ui64_r_max },
 #endif
 #ifdef SUBJ_F128_TO_UI64_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f128M_to_ui64_r_near_maxMag,
-#else
-    0,
+    {
+        "f128_to_ui64_r_near_maxMag",
+        (genericFuncType *) subj_f128M_to_ui64_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F128_TO_I32_R_NEAR_EVEN
-    (genericFuncType *) subj_f128M_to_i32_r_near_even,
-#else
-    0,
+    {
+        "f128_to_i32_r_near_even",
+        (genericFuncType *) subj_f128M_to_i32_r_near_even
+    },
 #endif
 #ifdef SUBJ_F128_TO_I32_R_MINMAG
-    (genericFuncType *) subj_f128M_to_i32_r_minMag,
-#else
-    0,
+    { "f128_to_i32_r_minMag", (genericFuncType *) subj_f128M_to_i32_r_minMag },
 #endif
 #ifdef SUBJ_F128_TO_I32_R_MIN
-    (genericFuncType *) subj_f128M_to_i32_r_min,
-#else
-    0,
+    { "f128_to_i32_r_min", (genericFuncType *) subj_f128M_to_i32_r_min },
 #endif
 #ifdef SUBJ_F128_TO_I32_R_MAX
-    (genericFuncType *) subj_f128M_to_i32_r_max,
-#else
-    0,
+    { "f128_to_i32_r_max", (genericFuncType *) subj_f128M_to_i32_r_max },
 #endif
 #ifdef SUBJ_F128_TO_I32_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f128M_to_i32_r_near_maxMag,
-#else
-    0,
+    {
+        "f128_to_i32_r_near_maxMag",
+        (genericFuncType *) subj_f128M_to_i32_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F128_TO_I64_R_NEAR_EVEN
-    (genericFuncType *) subj_f128M_to_i64_r_near_even,
-#else
-    0,
+    {
+        "f128_to_i64_r_near_even",
+        (genericFuncType *) subj_f128M_to_i64_r_near_even
+    },
 #endif
 #ifdef SUBJ_F128_TO_I64_R_MINMAG
-    (genericFuncType *) subj_f128M_to_i64_r_minMag,
-#else
-    0,
+    { "f128_to_i64_r_minMag", (genericFuncType *) subj_f128M_to_i64_r_minMag },
 #endif
 #ifdef SUBJ_F128_TO_I64_R_MIN
-    (genericFuncType *) subj_f128M_to_i64_r_min,
-#else
-    0,
+    { "f128_to_i64_r_min", (genericFuncType *) subj_f128M_to_i64_r_min },
 #endif
 #ifdef SUBJ_F128_TO_I64_R_MAX
-    (genericFuncType *) subj_f128M_to_i64_r_max,
-#else
-    0,
+    { "f128_to_i64_r_max", (genericFuncType *) subj_f128M_to_i64_r_max },
 #endif
 #ifdef SUBJ_F128_TO_I64_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f128M_to_i64_r_near_maxMag,
-#else
-    0,
+    {
+        "f128_to_i64_r_near_maxMag",
+        (genericFuncType *) subj_f128M_to_i64_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F128_TO_UI32_RX_NEAR_EVEN
-    (genericFuncType *) subj_f128M_to_ui32_rx_near_even,
-#else
-    0,
+    {
+        "f128_to_ui32_rx_near_even",
+        (genericFuncType *) subj_f128M_to_ui32_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F128_TO_UI32_RX_MINMAG
-    (genericFuncType *) subj_f128M_to_ui32_rx_minMag,
-#else
-    0,
+    {
+        "f128_to_ui32_rx_minMag",
+        (genericFuncType *) subj_f128M_to_ui32_rx_minMag
+    },
 #endif
 #ifdef SUBJ_F128_TO_UI32_RX_MIN
-    (genericFuncType *) subj_f128M_to_ui32_rx_min,
-#else
-    0,
+    { "f128_to_ui32_rx_min", (genericFuncType *) subj_f128M_to_ui32_rx_min },
 #endif
 #ifdef SUBJ_F128_TO_UI32_RX_MAX
-    (genericFuncType *) subj_f128M_to_ui32_rx_max,
-#else
-    0,
+    { "f128_to_ui32_rx_max", (genericFuncType *) subj_f128M_to_ui32_rx_max },
 #endif
 #ifdef SUBJ_F128_TO_UI32_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f128M_to_ui32_rx_near_maxMag,
-#else
-    0,
+    {
+        "f128_to_ui32_rx_near_maxMag",
+        (genericFuncType *) subj_f128M_to_ui32_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F128_TO_UI64_RX_NEAR_EVEN
-    (genericFuncType *) subj_f128M_to_ui64_rx_near_even,
-#else
-    0,
+    {
+        "f128_to_ui64_rx_near_even",
+        (genericFuncType *) subj_f128M_to_ui64_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F128_TO_UI64_RX_MINMAG
-    (genericFuncType *) subj_f128M_to_ui64_rx_minMag,
-#else
-    0,
+    {
+        "f128_to_ui64_rx_minMag",
+        (genericFuncType *) subj_f128M_to_ui64_rx_minMag
+    },
 #endif
 #ifdef SUBJ_F128_TO_UI64_RX_MIN
-    (genericFuncType *) subj_f128M_to_ui64_rx_min,
-#else
-    0,
+    { "f128_to_ui64_rx_min", (genericFuncType *) subj_f128M_to_ui64_rx_min },
 #endif
 #ifdef SUBJ_F128_TO_UI64_RX_MAX
-    (genericFuncType *) subj_f128M_to_ui64_rx_max,
-#else
-    0,
+    { "f128_to_ui64_rx_max", (genericFuncType *) subj_f128M_to_ui64_rx_max },
 #endif
 #ifdef SUBJ_F128_TO_UI64_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f128M_to_ui64_rx_near_maxMag,
-#else
-    0,
+    {
+        "f128_to_ui64_rx_near_maxMag",
+        (genericFuncType *) subj_f128M_to_ui64_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F128_TO_I32_RX_NEAR_EVEN
-    (genericFuncType *) subj_f128M_to_i32_rx_near_even,
-#else
-    0,
+    {
+        "f128_to_i32_rx_near_even",
+        (genericFuncType *) subj_f128M_to_i32_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F128_TO_I32_RX_MINMAG
-    (genericFuncType *) subj_f128M_to_i32_rx_minMag,
-#else
-    0,
+    {
+        "f128_to_i32_rx_minMag",
+        (genericFuncType *) subj_f128M_to_i32_rx_minMag
+    },
 #endif
 #ifdef SUBJ_F128_TO_I32_RX_MIN
-    (genericFuncType *) subj_f128M_to_i32_rx_min,
-#else
-    0,
+    { "f128_to_i32_rx_min", (genericFuncType *) subj_f128M_to_i32_rx_min },
 #endif
 #ifdef SUBJ_F128_TO_I32_RX_MAX
-    (genericFuncType *) subj_f128M_to_i32_rx_max,
-#else
-    0,
+    { "f128_to_i32_rx_max", (genericFuncType *) subj_f128M_to_i32_rx_max },
 #endif
 #ifdef SUBJ_F128_TO_I32_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f128M_to_i32_rx_near_maxMag,
-#else
-    0,
+    {
+        "f128_to_i32_rx_near_maxMag",
+        (genericFuncType *) subj_f128M_to_i32_rx_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F128_TO_I64_RX_NEAR_EVEN
-    (genericFuncType *) subj_f128M_to_i64_rx_near_even,
-#else
-    0,
+    {
+        "f128_to_i64_rx_near_even",
+        (genericFuncType *) subj_f128M_to_i64_rx_near_even
+    },
 #endif
 #ifdef SUBJ_F128_TO_I64_RX_MINMAG
-    (genericFuncType *) subj_f128M_to_i64_rx_minMag,
-#else
-    0,
+    {
+        "f128_to_i64_rx_minMag",
+        (genericFuncType *) subj_f128M_to_i64_rx_minMag
+    },
 #endif
 #ifdef SUBJ_F128_TO_I64_RX_MIN
-    (genericFuncType *) subj_f128M_to_i64_rx_min,
-#else
-    0,
+    { "f128_to_i64_rx_min", (genericFuncType *) subj_f128M_to_i64_rx_min },
 #endif
 #ifdef SUBJ_F128_TO_I64_RX_MAX
-    (genericFuncType *) subj_f128M_to_i64_rx_max,
-#else
-    0,
+    { "f128_to_i64_rx_max", (genericFuncType *) subj_f128M_to_i64_rx_max },
 #endif
 #ifdef SUBJ_F128_TO_I64_RX_NEAR_MAXMAG
-    (genericFuncType *) subj_f128M_to_i64_rx_near_maxMag,
-#else
-    0,
+    {
+        "f128_to_i64_rx_near_maxMag",
+        (genericFuncType *) subj_f128M_to_i64_rx_near_maxMag
+    },
 #endif
 #ifdef FLOAT16
 #ifdef SUBJ_F128_TO_F16
-    (genericFuncType *) subj_f128M_to_f16,
-#else
-    0,
+    { "f128_to_f16", (genericFuncType *) subj_f128M_to_f16 },
 #endif
 #endif
 #ifdef SUBJ_F128_TO_F32
-    (genericFuncType *) subj_f128M_to_f32,
-#else
-    0,
+    { "f128_to_f32", (genericFuncType *) subj_f128M_to_f32 },
 #endif
 #ifdef FLOAT64
 #ifdef SUBJ_F128_TO_F64
-    (genericFuncType *) subj_f128M_to_f64,
-#else
-    0,
+    { "f128_to_f64", (genericFuncType *) subj_f128M_to_f64 },
 #endif
 #endif
 #ifdef EXTFLOAT80
 #ifdef SUBJ_F128_TO_EXTF80
-    (genericFuncType *) subj_f128M_to_extF80M,
-#else
-    0,
+    { "f128_to_extF80", (genericFuncType *) subj_f128M_to_extF80M },
 #endif
 #endif
 #ifdef SUBJ_F128_ROUNDTOINT_R_NEAR_EVEN
-    (genericFuncType *) subj_f128M_roundToInt_r_near_even,
-#else
-    0,
+    {
+        "f128_roundToInt_r_near_even",
+        (genericFuncType *) subj_f128M_roundToInt_r_near_even
+    },
 #endif
 #ifdef SUBJ_F128_ROUNDTOINT_R_MINMAG
-    (genericFuncType *) subj_f128M_roundToInt_r_minMag,
-#else
-    0,
+    {
+        "f128_roundToInt_r_minMag",
+        (genericFuncType *) subj_f128M_roundToInt_r_minMag
+    },
 #endif
 #ifdef SUBJ_F128_ROUNDTOINT_R_MIN
-    (genericFuncType *) subj_f128M_roundToInt_r_min,
-#else
-    0,
+    {
+        "f128_roundToInt_r_min",
+        (genericFuncType *) subj_f128M_roundToInt_r_min
+    },
 #endif
 #ifdef SUBJ_F128_ROUNDTOINT_R_MAX
-    (genericFuncType *) subj_f128M_roundToInt_r_max,
-#else
-    0,
+    {
+        "f128_roundToInt_r_max",
+        (genericFuncType *) subj_f128M_roundToInt_r_max
+    },
 #endif
 #ifdef SUBJ_F128_ROUNDTOINT_R_NEAR_MAXMAG
-    (genericFuncType *) subj_f128M_roundToInt_r_near_maxMag,
-#else
-    0,
+    {
+        "f128_roundToInt_r_near_maxMag",
+        (genericFuncType *) subj_f128M_roundToInt_r_near_maxMag
+    },
 #endif
 #ifdef SUBJ_F128_ROUNDTOINT_X
-    (genericFuncType *) subj_f128M_roundToInt_x,
-#else
-    0,
+    { "f128_roundToInt_x", (genericFuncType *) subj_f128M_roundToInt_x },
 #endif
 #ifdef SUBJ_F128_ADD
-    (genericFuncType *) subj_f128M_add,
-#else
-    0,
+    { "f128_add", (genericFuncType *) subj_f128M_add },
 #endif
 #ifdef SUBJ_F128_SUB
-    (genericFuncType *) subj_f128M_sub,
-#else
-    0,
+    { "f128_sub", (genericFuncType *) subj_f128M_sub },
 #endif
 #ifdef SUBJ_F128_MUL
-    (genericFuncType *) subj_f128M_mul,
-#else
-    0,
+    { "f128_mul", (genericFuncType *) subj_f128M_mul },
 #endif
 #ifdef SUBJ_F128_MULADD
-    (genericFuncType *) subj_f128M_mulAdd,
-#else
-    0,
+    { "f128_mulAdd", (genericFuncType *) subj_f128M_mulAdd },
 #endif
 #ifdef SUBJ_F128_DIV
-    (genericFuncType *) subj_f128M_div,
-#else
-    0,
+    { "f128_div", (genericFuncType *) subj_f128M_div },
 #endif
 #ifdef SUBJ_F128_REM
-    (genericFuncType *) subj_f128M_rem,
-#else
-    0,
+    { "f128_rem", (genericFuncType *) subj_f128M_rem },
 #endif
 #ifdef SUBJ_F128_SQRT
-    (genericFuncType *) subj_f128M_sqrt,
-#else
-    0,
+    { "f128_sqrt", (genericFuncType *) subj_f128M_sqrt },
 #endif
 #ifdef SUBJ_F128_EQ
-    (genericFuncType *) subj_f128M_eq,
-#else
-    0,
+    { "f128_eq", (genericFuncType *) subj_f128M_eq },
 #endif
 #ifdef SUBJ_F128_LE
-    (genericFuncType *) subj_f128M_le,
-#else
-    0,
+    { "f128_le", (genericFuncType *) subj_f128M_le },
 #endif
 #ifdef SUBJ_F128_LT
-    (genericFuncType *) subj_f128M_lt,
-#else
-    0,
+    { "f128_lt", (genericFuncType *) subj_f128M_lt },
 #endif
 #ifdef SUBJ_F128_EQ_SIGNALING
-    (genericFuncType *) subj_f128M_eq_signaling,
-#else
-    0,
+    { "f128_eq_signaling", (genericFuncType *) subj_f128M_eq_signaling },
 #endif
 #ifdef SUBJ_F128_LE_QUIET
-    (genericFuncType *) subj_f128M_le_quiet,
-#else
-    0,
+    { "f128_le_quiet", (genericFuncType *) subj_f128M_le_quiet },
 #endif
 #ifdef SUBJ_F128_LT_QUIET
-    (genericFuncType *) subj_f128M_lt_quiet,
-#else
-    0,
+    { "f128_lt_quiet", (genericFuncType *) subj_f128M_lt_quiet },
 #endif
 #endif
+    { 0, 0 }
 };
 
@@ -0,0 +1,290 @@
+
+/*============================================================================
+
+This C source file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include "platform.h"
+#include "fail.h"
+#include "subprocess.h"
+
+#ifdef _WIN32
+
+#include <string.h>
+#include <io.h>
+#include <windows.h>
+
+struct subprocess {
+    HANDLE handle;
+};
+
+/*----------------------------------------------------------------------------
+| Returns a newly allocated command line for `argv', quoted so that the C
+| runtime of the child splits it back into the same arguments.
+*----------------------------------------------------------------------------*/
+static char *commandLine( const char * const argv[] )
+{
+    size_t size;
+    const char * const *argPtrPtr;
+    char *line, *ptr;
+    const char *argPtr;
+    int numBackslashes;
+
+    size = 1;
+    for ( argPtrPtr = argv; *argPtrPtr; ++argPtrPtr ) {
+        size += 2 * strlen( *argPtrPtr ) + 3;
+    }
+    line = malloc( size );
+    if ( ! line ) fail( "Out of memory" );
+    ptr = line;
+    for ( argPtrPtr = argv; *argPtrPtr; ++argPtrPtr ) {
+        if ( argPtrPtr != argv ) *ptr++ = ' ';
+        *ptr++ = '"';
+        numBackslashes = 0;
+        for ( argPtr = *argPtrPtr; *argPtr; ++argPtr ) {
+            if ( *argPtr == '\\' ) {
+                ++numBackslashes;
+            } else {
+                if ( *argPtr == '"' ) {
+                    for ( ; numBackslashes; --numBackslashes ) *ptr++ = '\\';
+                    *ptr++ = '\\';
+                }
+                numBackslashes = 0;
+            }
+            *ptr++ = *argPtr;
+        }
+        for ( ; numBackslashes; --numBackslashes ) *ptr++ = '\\';
+        *ptr++ = '"';
+    }
+    *ptr = '\0';
+    return line;
+
+}
+
+struct subprocess *
+ subprocess_start( const char * const argv[], FILE *outFile, FILE *errFile )
+{
+    HANDLE outHandle, errHandle;
+    STARTUPINFOA startupInfo;
+    PROCESS_INFORMATION processInfo;
+    char *line;
+    BOOL started;
+    struct subprocess *subprocessPtr;
+
+    fflush( outFile );
+    fflush( errFile );
+    outHandle = (HANDLE) _get_osfhandle( _fileno( outFile ) );
+    errHandle = (HANDLE) _get_osfhandle( _fileno( errFile ) );
+    SetHandleInformation(
+        outHandle, HANDLE_FLAG_INHERIT, HANDLE_FLAG_INHERIT );
+    SetHandleInformation(
+        errHandle, HANDLE_FLAG_INHERIT, HANDLE_FLAG_INHERIT );
+    ZeroMemory( &startupInfo, sizeof startupInfo );
+    startupInfo.cb = sizeof startupInfo;
+    startupInfo.dwFlags = STARTF_USESTDHANDLES;
+    startupInfo.hStdInput = GetStdHandle( STD_INPUT_HANDLE );
+    startupInfo.hStdOutput = outHandle;
+    startupInfo.hStdError = errHandle;
+    line = commandLine( argv );
+    started =
+        CreateProcessA(
+            0, line, 0, 0, TRUE, 0, 0, 0, &startupInfo, &processInfo );
+    free( line );
+    SetHandleInformation( outHandle, HANDLE_FLAG_INHERIT, 0 );
+    SetHandleInformation( errHandle, HANDLE_FLAG_INHERIT, 0 );
+    if ( ! started ) fail( "Cannot start process `%s'", argv[0] );
+    CloseHandle( processInfo.hThread );
+    subprocessPtr = malloc( sizeof *subprocessPtr );
+    if ( ! subprocessPtr ) fail( "Out of memory" );
+    subprocessPtr->handle = processInfo.hProcess;
+    return subprocessPtr;
+
+}
+
+int
+ subprocess_wait(
+     struct subprocess * const subprocesses[],
+     int numSubprocesses,
+     int *statusPtr,
+     bool *crashedPtr
+ )
+{
+    HANDLE handles[subprocess_maxWait];
+    int i;
+    DWORD result, exitCode;
+
+    for ( i = 0; i < numSubprocesses; ++i ) {
+        handles[i] = subprocesses[i]->handle;
+    }
+    result =
+        WaitForMultipleObjects( numSubprocesses, handles, FALSE, INFINITE );
+    if ( numSubprocesses <= result - WAIT_OBJECT_0 ) {
+        fail( "Cannot wait for process" );
+    }
+    i = result - WAIT_OBJECT_0;
+    GetExitCodeProcess( handles[i], &exitCode );
+    /*------------------------------------------------------------------------
+    | Unhandled exceptions end a process with the exception code, which is an
+    | NTSTATUS error code (top two bits set).
+    *------------------------------------------------------------------------*/
+    *crashedPtr = ((exitCode & 0xC0000000) == 0xC0000000);
+    *statusPtr = exitCode;
+    CloseHandle( handles[i] );
+    free( subprocesses[i] );
+    return i;
+
+}
+
+int
+ subprocess_forkServer(
+     FILE *requestFile, FILE *statusFile, char *args[], int maxArgs )
+{
+
+    fail( "Fork server is not supported on this platform" );
+    return -1;
+
+}
+
+#else
+
+#include <errno.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+struct subprocess {
+    pid_t pid;
+};
+
+struct subprocess *
+ subprocess_start( const char * const argv[], FILE *outFile, FILE *errFile )
+{
+    pid_t pid;
+    struct subprocess *subprocessPtr;
+
+    fflush( stdout );
+    fflush( stderr );
+    fflush( outFile );
+    fflush( errFile );
+    pid = fork();
+    if ( pid < 0 ) fail( "Cannot start process `%s'", argv[0] );
+    if ( ! pid ) {
+        dup2( fileno( outFile ), STDOUT_FILENO );
+        dup2( fileno( errFile ), STDERR_FILENO );
+        execvp( argv[0], (char * const *) argv );
+        _exit( 127 );
+    }
+    subprocessPtr = malloc( sizeof *subprocessPtr );
+    if ( ! subprocessPtr ) fail( "Out of memory" );
+    subprocessPtr->pid = pid;
+    return subprocessPtr;
+
+}
+
+int
+ subprocess_wait(
+     struct subprocess * const subprocesses[],
+     int numSubprocesses,
+     int *statusPtr,
+     bool *crashedPtr
+ )
+{
+    pid_t pid;
+    int status, i;
+
+    for (;;) {
+        pid = waitpid( -1, &status, 0 );
+        if ( pid < 0 ) {
+            if ( errno == EINTR ) continue;
+            fail( "Cannot wait for process" );
+        }
+        for ( i = 0; i < numSubprocesses; ++i ) {
+            if ( subprocesses[i]->pid == pid ) break;
+        }
+        if ( i < numSubprocesses ) break;
+    }
+    *crashedPtr = WIFSIGNALED( status );
+    *statusPtr = *crashedPtr ? WTERMSIG( status ) : WEXITSTATUS( status );
+    free( subprocesses[i] );
+    return i;
+
+}
+
+int
+ subprocess_forkServer(
+     FILE *requestFile, FILE *statusFile, char *args[], int maxArgs )
+{
+    static char request[4096];
+    pid_t pid;
+    int status, numArgs;
+    char *ptr;
+
+    while ( fgets( request, sizeof request, requestFile ) ) {
+        fflush( stdout );
+        fflush( stderr );
+        fflush( statusFile );
+        pid = fork();
+        if ( pid < 0 ) fail( "Cannot fork" );
+        if ( ! pid ) {
+            numArgs = 0;
+            for (
+                ptr = strtok( request, " \t\r\n" );
+                ptr && (numArgs < maxArgs);
+                ptr = strtok( 0, " \t\r\n" )
+            ) {
+                args[numArgs] = ptr;
+                ++numArgs;
+            }
+            return numArgs;
+        }
+        while ( waitpid( pid, &status, 0 ) < 0 ) {
+            if ( errno != EINTR ) fail( "Cannot wait for process" );
+        }
+        if ( WIFSIGNALED( status ) ) {
+            fprintf( statusFile, "crash %d\n", WTERMSIG( status ) );
+        } else {
+            fprintf( statusFile, "exit %d\n", WEXITSTATUS( status ) );
+        }
+        fflush( statusFile );
+    }
+    return -1;
+
+}
+
+#endif
+
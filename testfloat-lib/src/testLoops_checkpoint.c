@@ -0,0 +1,222 @@
+
+/*============================================================================
+
+This C source file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "platform.h"
+#include "fail.h"
+#include "random.h"
+#include "genCases.h"
+#include "verCases.h"
+#include "testLoops.h"
+#include "liveStats.h"
+#include "thread.h"
+
+const char *testLoops_checkpointPath = 0;
+double testLoops_checkpointSeconds = 60;
+bool testLoops_anyEarlierErrors = false;
+
+static const char checkpointMagic[8] = "TFCKPT4";
+
+static uint_fast64_t numInstancesDone = 0;
+static bool checkpointTimeSet = false;
+static double checkpointTime;
+
+/*----------------------------------------------------------------------------
+| While resuming, `resumeFile' is the open checkpoint, positioned at the
+| case generators' state, and the other `resume...' variables hold what came
+| before it.
+*----------------------------------------------------------------------------*/
+static FILE *resumeFile = 0;
+static uint_fast64_t resumeNumInstancesDone, resumeCaseNum;
+static uint_fast64_t resumeSeed;
+static struct random_state resumeRandomState;
+static uint_fast32_t resumeTenThousandsCount, resumeErrorCount;
+static bool resumeAnyErrors, resumeAnyEarlierErrors;
+
+static void writeCheckpoint( uint_fast64_t caseNum )
+{
+    char *newPath;
+    FILE *file;
+    uint_fast64_t seed;
+    struct random_state randomState;
+    bool anyErrors, anyEarlierErrors;
+
+    newPath = malloc( strlen( testLoops_checkpointPath ) + 5 );
+    if ( ! newPath ) fail( "Out of memory" );
+    strcpy( newPath, testLoops_checkpointPath );
+    strcat( newPath, ".new" );
+    file = fopen( newPath, "wb" );
+    if ( ! file ) fail( "Cannot write `%s'", newPath );
+    seed = random_getSeed();
+    randomState = random_getState();
+    anyErrors = verCases_anyErrors;
+    anyEarlierErrors = testLoops_anyEarlierErrors;
+    fwrite( checkpointMagic, sizeof checkpointMagic, 1, file );
+    fwrite( &numInstancesDone, sizeof numInstancesDone, 1, file );
+    fwrite( &caseNum, sizeof caseNum, 1, file );
+    fwrite( &seed, sizeof seed, 1, file );
+    fwrite( &randomState.stream, sizeof randomState.stream, 1, file );
+    fwrite( &randomState.count, sizeof randomState.count, 1, file );
+    fwrite(
+        &verCases_tenThousandsCount,
+        sizeof verCases_tenThousandsCount,
+        1,
+        file
+    );
+    fwrite( &verCases_errorCount, sizeof verCases_errorCount, 1, file );
+    fwrite( &anyErrors, sizeof anyErrors, 1, file );
+    fwrite( &anyEarlierErrors, sizeof anyEarlierErrors, 1, file );
+    genCases_writeState( file );
+    if ( ferror( file ) | fclose( file ) ) {
+        fail( "Cannot write `%s'", newPath );
+    }
+    /*------------------------------------------------------------------------
+    | The old checkpoint is replaced only by a complete new one.
+    *------------------------------------------------------------------------*/
+    remove( testLoops_checkpointPath );
+    if ( rename( newPath, testLoops_checkpointPath ) ) {
+        fail( "Cannot rename `%s'", newPath );
+    }
+    free( newPath );
+
+}
+
+void testLoops_resume( void )
+{
+    char magic[sizeof checkpointMagic];
+
+    resumeFile = fopen( testLoops_checkpointPath, "rb" );
+    if ( ! resumeFile ) fail( "Cannot read `%s'", testLoops_checkpointPath );
+    if (
+           ! fread( magic, sizeof magic, 1, resumeFile )
+        || memcmp( magic, checkpointMagic, sizeof magic )
+        || ! fread(
+                 &resumeNumInstancesDone,
+                 sizeof resumeNumInstancesDone,
+                 1,
+                 resumeFile
+             )
+        || ! fread( &resumeCaseNum, sizeof resumeCaseNum, 1, resumeFile )
+        || ! fread( &resumeSeed, sizeof resumeSeed, 1, resumeFile )
+        || ! fread(
+                 &resumeRandomState.stream,
+                 sizeof resumeRandomState.stream,
+                 1,
+                 resumeFile
+             )
+        || ! fread(
+                 &resumeRandomState.count,
+                 sizeof resumeRandomState.count,
+                 1,
+                 resumeFile
+             )
+        || ! fread(
+                 &resumeTenThousandsCount,
+                 sizeof resumeTenThousandsCount,
+                 1,
+                 resumeFile
+             )
+        || ! fread(
+                 &resumeErrorCount, sizeof resumeErrorCount, 1, resumeFile )
+        || ! fread( &resumeAnyErrors, sizeof resumeAnyErrors, 1, resumeFile )
+        || ! fread(
+                 &resumeAnyEarlierErrors, sizeof resumeAnyEarlierErrors, 1,
+                 resumeFile
+             )
+    ) {
+        fail( "`%s' is not a checkpoint", testLoops_checkpointPath );
+    }
+
+}
+
+bool testLoops_skippingInstance( void )
+{
+
+    return resumeFile && (numInstancesDone < resumeNumInstancesDone);
+
+}
+
+void testLoops_instanceDone( void )
+{
+
+    ++numInstancesDone;
+
+}
+
+void testLoops_startBatch( void )
+{
+    uint_fast64_t caseNum;
+    double now;
+
+    testLoops_selectBatch();
+    liveStats_batch( testLoops_caseNum(), genCases_total );
+    if ( ! testLoops_watchBatch() ) return;
+    verCases_flushErrors();
+    if ( ! testLoops_checkpointPath ) return;
+    if ( resumeFile ) {
+        if ( ! genCases_readState( resumeFile ) ) {
+            fail( "`%s' is damaged", testLoops_checkpointPath );
+        }
+        fclose( resumeFile );
+        resumeFile = 0;
+        random_setSeed( resumeSeed );
+        random_setState( resumeRandomState );
+        verCases_tenThousandsCount = resumeTenThousandsCount;
+        verCases_errorCount = resumeErrorCount;
+        verCases_anyErrors = resumeAnyErrors;
+        testLoops_anyEarlierErrors = resumeAnyEarlierErrors;
+        testLoops_setCaseNum( resumeCaseNum );
+        testLoops_watchResumed();
+        return;
+    }
+    caseNum = testLoops_caseNum();
+    if ( ! caseNum || (caseNum % 10000) ) return;
+    now = thread_seconds();
+    if ( ! checkpointTimeSet ) {
+        checkpointTime = now;
+        checkpointTimeSet = true;
+    }
+    if ( now < checkpointTime + testLoops_checkpointSeconds ) return;
+    checkpointTime = now;
+    writeCheckpoint( caseNum );
+
+}
+
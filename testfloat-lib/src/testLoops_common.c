@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "testLoops.h"
 
 bool testLoops_forever = false;
+int testLoops_numThreads = 1;
 
-uint_fast8_t *testLoops_trueFlagsPtr;
+THREAD_LOCAL uint_fast8_t *testLoops_trueFlagsPtr;
 uint_fast8_t (*testLoops_subjFlagsFunction)( void );
+void (*testLoops_subjRoundingModeFunction)( uint_fast8_t ) = 0;
 
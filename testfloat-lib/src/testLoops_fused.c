@@ -0,0 +1,172 @@
+
+/*============================================================================
+
+This C source file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include "platform.h"
+#include "softfloat.h"
+#include "fail.h"
+#include "genCases.h"
+#include "verCases.h"
+#include "testLoops.h"
+
+struct testLoops_fused *
+ testLoops_startFused(
+     int numFunctions,
+     const struct testLoops_fusedInfo infos[],
+     size_t errorCaseSize
+ )
+{
+    struct testLoops_fused *functions;
+    int i;
+
+    functions = malloc( numFunctions * sizeof *functions );
+    if ( ! functions ) fail( "Out of memory" );
+    for ( i = 0; i < numFunctions; ++i ) {
+        functions[i].info = infos[i];
+        functions[i].done = false;
+        functions[i].errorCount = 0;
+        functions[i].numTests = 0;
+        functions[i].errorCaseSize = errorCaseSize;
+        functions[i].numErrorCases = 0;
+        functions[i].maxErrorCases = 0;
+        functions[i].errorCases = 0;
+    }
+    return functions;
+
+}
+
+uint_fast8_t
+ testLoops_setFusedRounding( const struct testLoops_fused *functionPtr )
+{
+
+    if ( functionPtr->info.roundingCode ) {
+        softfloat_roundingMode = functionPtr->info.roundingMode;
+        if (
+            ! functionPtr->info.fixedRounding
+                && testLoops_subjRoundingModeFunction
+        ) {
+            testLoops_subjRoundingModeFunction(
+                functionPtr->info.roundingMode );
+        }
+    }
+    return softfloat_roundingMode;
+
+}
+
+void *
+ testLoops_fusedErrorFound(
+     struct testLoops_fused *functionPtr, uint_fast64_t numTests )
+{
+    size_t maxErrorCases;
+    void *errorCases;
+
+    ++functionPtr->errorCount;
+    if ( functionPtr->errorCount == verCases_maxErrorCount ) {
+        functionPtr->done = true;
+        functionPtr->numTests = numTests;
+    }
+    if ( ! testLoops_keepErrorCase( numTests - 1 ) ) return 0;
+    if ( functionPtr->numErrorCases == functionPtr->maxErrorCases ) {
+        maxErrorCases =
+            functionPtr->maxErrorCases ? 2 * functionPtr->maxErrorCases : 32;
+        errorCases =
+            realloc(
+                functionPtr->errorCases,
+                maxErrorCases * functionPtr->errorCaseSize
+            );
+        if ( ! errorCases ) fail( "Out of memory" );
+        functionPtr->errorCases = errorCases;
+        functionPtr->maxErrorCases = maxErrorCases;
+    }
+    return
+        (char *) functionPtr->errorCases
+            + functionPtr->numErrorCases++ * functionPtr->errorCaseSize;
+
+}
+
+void
+ testLoops_finishFused(
+     struct testLoops_fused *functions,
+     int numFunctions,
+     uint_fast64_t numTests,
+     void writeErrorCase( const void * )
+ )
+{
+    struct testLoops_fused *functionPtr;
+    size_t i;
+
+    for (
+        functionPtr = functions;
+        functionPtr != functions + numFunctions;
+        ++functionPtr
+    ) {
+        if ( ! functionPtr->done ) functionPtr->numTests = numTests;
+        if ( ! verCases_quiet ) {
+            verCases_functionNamePtr = functionPtr->info.namePtr;
+            if ( functionPtr->info.roundingCode ) {
+                verCases_roundingCode =
+                    functionPtr->info.fixedRounding
+                        ? 0 : functionPtr->info.roundingCode;
+            }
+            fputs( "Testing ", stderr );
+            verCases_writeFunctionName( stderr );
+            fputs( ".\n", stderr );
+            genCases_writeTestsTotal( false );
+            verCases_errorCount = 0;
+            for ( i = 0; i < functionPtr->numErrorCases; ++i ) {
+                ++verCases_errorCount;
+                verCases_writeErrorFound( 0 );
+                writeErrorCase(
+                    (char *) functionPtr->errorCases
+                        + i * functionPtr->errorCaseSize
+                );
+            }
+            verCases_tenThousandsCount = functionPtr->numTests / 10000;
+            verCases_writeTestsPerformed( functionPtr->numTests % 10000 );
+            if ( verCases_errorStop && verCases_anyErrors ) {
+                verCases_exitWithStatus();
+            }
+        }
+        free( functionPtr->errorCases );
+    }
+    free( functions );
+
+}
+
@@ -0,0 +1,474 @@
+
+/*============================================================================
+
+This C source file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "platform.h"
+#include "fail.h"
+#include "random.h"
+#include "softfloat.h"
+#include "genCases.h"
+#include "verCases.h"
+#include "testLoops.h"
+#include "liveStats.h"
+#include "failMap.h"
+#include "thread.h"
+
+struct instance;
+
+struct worker {
+    struct thread *threadPtr;
+    struct instance *instancePtr;
+    int threadNum, numThreads;
+    struct random_state randomState;
+    uint_fast8_t roundingMode, detectTininess;
+#ifdef EXTFLOAT80
+    uint_fast8_t extF80RoundingPrecision;
+#endif
+    uint_fast64_t *errorCaseNums;
+    size_t numErrorCases, maxErrorCases;
+    uint_fast32_t errorCount;
+    uint_fast64_t numCases;
+    struct testLoops_watch *watchPtr;
+    int statsSlotNum;
+    struct failMap_part *failMapPartPtr;
+};
+
+struct instance {
+    void (*function)( void * );
+    void *argPtr;
+    struct random_state randomState;
+    struct worker *workers;
+    int numWorkers;
+};
+
+double testLoops_deadline = 0;
+uint_fast64_t testLoops_numCasesRun = 0;
+
+static THREAD_LOCAL struct worker *workerPtr;
+static THREAD_LOCAL uint_fast64_t caseNum;
+static THREAD_LOCAL bool selecting;
+static THREAD_LOCAL const uint_fast64_t *selectedCaseNumPtr;
+static THREAD_LOCAL const uint_fast64_t *endSelectedCaseNumPtr;
+
+/*----------------------------------------------------------------------------
+| While a failure map is kept and only `failMap_maxErrorCount' errors are
+| written, workers note just the first that many of their failing cases, and
+| only the first that many overall are replayed.  Once the last of them has
+| been found again, the error count is set to `replayErrorCount', the number
+| of errors all of the instance's workers found.  With no limit, every
+| failing case of the map is replayed.
+*----------------------------------------------------------------------------*/
+static THREAD_LOCAL uint_fast32_t numSelectedErrors, replayErrorCount;
+
+/*----------------------------------------------------------------------------
+| While replaying, the cases between one selected case and the next are
+| passed over ten thousand at a time, by seeking the case generators and
+| counting each ten thousand as the test loop would have.  So that the
+| loop's count of its cases stays right, this is done only while
+| `batchSelected' is false:  from the start of a batch (see
+| `testLoops_selectBatch') until a case of that batch is selected.  A loop
+| that does not start batches is never skipped ahead.
+*----------------------------------------------------------------------------*/
+static THREAD_LOCAL bool batchSelected;
+
+static void skipAhead( uint_fast64_t thisCaseNum, uint_fast64_t endCaseNum )
+{
+    uint_fast64_t numSkips;
+
+    if ( genCases_total <= endCaseNum ) endCaseNum = genCases_total - 1;
+    if ( endCaseNum <= thisCaseNum + 10000 ) return;
+    numSkips = (endCaseNum - thisCaseNum - 1) / 10000;
+    genCases_seek( thisCaseNum + 1 + numSkips * 10000 );
+    for ( ; numSkips; --numSkips ) verCases_perTenThousand();
+
+}
+
+static bool skipThisCase( uint_fast64_t thisCaseNum )
+{
+    uint_fast64_t selectedCaseNum;
+
+    if ( ! selecting ) return false;
+    if ( failMap_active && ! failMap_maxErrorCount ) {
+        selectedCaseNum = failMap_nextCase( thisCaseNum );
+    } else {
+        selectedCaseNum = UINT64_MAX;
+        if ( selectedCaseNumPtr != endSelectedCaseNumPtr ) {
+            selectedCaseNum = *selectedCaseNumPtr;
+            if ( selectedCaseNum == thisCaseNum ) ++selectedCaseNumPtr;
+        }
+    }
+    if ( selectedCaseNum == thisCaseNum ) {
+        batchSelected = true;
+        return false;
+    }
+    if ( ! batchSelected ) skipAhead( thisCaseNum, selectedCaseNum );
+    return true;
+
+}
+
+void testLoops_selectBatch( void )
+{
+
+    batchSelected = false;
+    if (
+        testLoops_deadline && ! selecting
+            && (testLoops_deadline <= thread_seconds())
+    ) {
+        genCases_endPart();
+    }
+
+}
+
+bool testLoops_skipCase( void )
+{
+    uint_fast64_t thisCaseNum;
+    bool skip;
+
+    thisCaseNum = genCases_caseNum;
+    caseNum = thisCaseNum + 1;
+    skip = skipThisCase( thisCaseNum );
+    if ( ! skip ) ++liveStats_numCases;
+    return
+        testLoops_hangSeconds ? testLoops_watchCase( thisCaseNum, skip )
+            : skip;
+
+}
+
+uint_fast64_t testLoops_caseNum( void )
+{
+
+    return caseNum;
+
+}
+
+void testLoops_setCaseNum( uint_fast64_t newCaseNum )
+{
+
+    caseNum = newCaseNum;
+
+}
+
+bool testLoops_keepErrorCase( uint_fast64_t thisCaseNum )
+{
+    size_t maxErrorCases;
+    uint_fast64_t *errorCaseNums;
+
+    if ( ! selecting ) {
+        liveStats_errorFound();
+        if ( failMap_active ) {
+            failMap_add( genCases_firstCaseNum + thisCaseNum );
+        }
+    }
+    if ( ! workerPtr ) {
+        return
+            ! failMap_active || ! failMap_maxErrorCount
+                || (verCases_errorCount <= failMap_maxErrorCount);
+    }
+    if (
+        failMap_active
+            && (! failMap_maxErrorCount
+                    || (failMap_maxErrorCount <= workerPtr->numErrorCases))
+    ) {
+        return false;
+    }
+    if ( workerPtr->numErrorCases == workerPtr->maxErrorCases ) {
+        maxErrorCases =
+            workerPtr->maxErrorCases ? 2 * workerPtr->maxErrorCases : 64;
+        errorCaseNums =
+            realloc(
+                workerPtr->errorCaseNums, maxErrorCases * sizeof *errorCaseNums
+            );
+        if ( ! errorCaseNums ) fail( "Out of memory" );
+        workerPtr->errorCaseNums = errorCaseNums;
+        workerPtr->maxErrorCases = maxErrorCases;
+    }
+    workerPtr->errorCaseNums[workerPtr->numErrorCases++] =
+        genCases_firstCaseNum + thisCaseNum;
+    return false;
+
+}
+
+bool testLoops_errorFound( int count )
+{
+
+    if (
+        ! testLoops_keepErrorCase(
+              (uint_fast64_t) verCases_tenThousandsCount * 10000 + count - 1 )
+    ) {
+        return false;
+    }
+    verCases_writeErrorFound( count );
+    if ( replayErrorCount && (verCases_errorCount == numSelectedErrors) ) {
+        verCases_errorCount = replayErrorCount;
+        replayErrorCount = 0;
+    }
+    return true;
+
+}
+
+static void workerMain( void *argPtr )
+{
+
+    workerPtr = argPtr;
+    random_setState( workerPtr->randomState );
+    softfloat_roundingMode = workerPtr->roundingMode;
+    softfloat_detectTininess = workerPtr->detectTininess;
+#ifdef EXTFLOAT80
+    extF80_roundingPrecision = workerPtr->extF80RoundingPrecision;
+#endif
+    verCases_quiet = true;
+    genCases_setPart( workerPtr->threadNum, workerPtr->numThreads );
+    testLoops_setWatch( workerPtr->watchPtr );
+    liveStats_useSlot( workerPtr->statsSlotNum );
+    liveStats_setState( liveStats_testing );
+    workerPtr->instancePtr->function( workerPtr->instancePtr->argPtr );
+    workerPtr->numCases = caseNum ? caseNum - genCases_firstCaseNum : 0;
+    workerPtr->errorCount = verCases_errorCount;
+    liveStats_endInstance();
+    liveStats_setState( liveStats_idle );
+    if ( failMap_active ) workerPtr->failMapPartPtr = failMap_endPart();
+
+}
+
+/*----------------------------------------------------------------------------
+| Instances are started and finished in the same order, so `instances' is
+| used as a queue:  entries before `numJoinedInstances' have had all their
+| workers joined, and entries before `numFinishedInstances' have also been
+| replayed.  `numRunningThreads' counts workers not yet joined.
+*----------------------------------------------------------------------------*/
+static bool serial;
+static struct instance *instances;
+static int numInstances, numStartedInstances;
+static int numJoinedInstances, numFinishedInstances;
+static int numThreadsPerInstance, numRunningThreads;
+
+void testLoops_startInstances( int count )
+{
+
+    free( instances );
+    instances = malloc( count * sizeof *instances );
+    if ( ! instances ) fail( "Out of memory" );
+    numInstances = count;
+    numStartedInstances = 0;
+    numJoinedInstances = 0;
+    numFinishedInstances = 0;
+    serial = (testLoops_numThreads <= 1) || testLoops_forever;
+    numThreadsPerInstance = testLoops_numThreads / count;
+    if ( ! numThreadsPerInstance ) numThreadsPerInstance = 1;
+    numRunningThreads = 0;
+
+}
+
+static void joinInstance( struct instance *instancePtr )
+{
+    int threadNum;
+
+    for ( threadNum = 0; threadNum < instancePtr->numWorkers; ++threadNum ) {
+        thread_join( instancePtr->workers[threadNum].threadPtr );
+        testLoops_endWatch( instancePtr->workers[threadNum].watchPtr );
+        liveStats_releaseSlot( instancePtr->workers[threadNum].statsSlotNum );
+    }
+    numRunningThreads -= instancePtr->numWorkers;
+
+}
+
+void testLoops_startInstance( void function( void * ), void *argPtr )
+{
+    struct instance *instancePtr;
+    int numThreads, threadNum;
+    struct worker *workers;
+
+    instancePtr = &instances[numStartedInstances];
+    instancePtr->function = function;
+    instancePtr->argPtr = argPtr;
+    if ( serial ) {
+        ++numStartedInstances;
+        return;
+    }
+    ++numStartedInstances;
+    instancePtr->randomState = random_getState();
+    numThreads = numThreadsPerInstance;
+    while (
+        (testLoops_numThreads < numRunningThreads + numThreads)
+            && (numJoinedInstances < numStartedInstances - 1)
+    ) {
+        joinInstance( &instances[numJoinedInstances++] );
+    }
+    workers = malloc( numThreads * sizeof *workers );
+    if ( ! workers ) fail( "Out of memory" );
+    instancePtr->workers = workers;
+    instancePtr->numWorkers = numThreads;
+    for ( threadNum = 0; threadNum < numThreads; ++threadNum ) {
+        workers[threadNum].instancePtr = instancePtr;
+        workers[threadNum].threadNum = threadNum;
+        workers[threadNum].numThreads = numThreads;
+        workers[threadNum].randomState = instancePtr->randomState;
+        workers[threadNum].roundingMode = softfloat_roundingMode;
+        workers[threadNum].detectTininess = softfloat_detectTininess;
+#ifdef EXTFLOAT80
+        workers[threadNum].extF80RoundingPrecision = extF80_roundingPrecision;
+#endif
+        workers[threadNum].errorCaseNums = 0;
+        workers[threadNum].numErrorCases = 0;
+        workers[threadNum].maxErrorCases = 0;
+        workers[threadNum].watchPtr =
+            testLoops_startWatch(
+                function, argPtr, &instancePtr->randomState );
+        workers[threadNum].statsSlotNum = liveStats_claimSlot();
+        workers[threadNum].threadPtr =
+            thread_start( workerMain, &workers[threadNum] );
+    }
+    numRunningThreads += numThreads;
+
+}
+
+static int compareCaseNums( const void *aPtr, const void *bPtr )
+{
+    uint_fast64_t a, b;
+
+    a = *(const uint_fast64_t *) aPtr;
+    b = *(const uint_fast64_t *) bPtr;
+    return (a < b) ? -1 : (b < a) ? 1 : 0;
+
+}
+
+void testLoops_finishInstance( void )
+{
+    struct instance *instancePtr;
+    struct worker *workers;
+    size_t numErrorCases, i;
+    int threadNum;
+    uint_fast64_t *errorCaseNums, *caseNumPtr;
+    uint_fast32_t errorCount;
+    struct testLoops_watch *watchPtr;
+    struct random_state randomState;
+
+    instancePtr = &instances[numFinishedInstances++];
+    liveStats_startInstance();
+    if ( serial ) {
+        if ( ! testLoops_skippingInstance() ) {
+            randomState = random_getState();
+            watchPtr =
+                testLoops_startWatch(
+                    instancePtr->function, instancePtr->argPtr, &randomState );
+            testLoops_setWatch( watchPtr );
+            caseNum = 0;
+            liveStats_setState( liveStats_testing );
+            instancePtr->function( instancePtr->argPtr );
+            testLoops_numCasesRun += caseNum;
+            liveStats_endInstance();
+            liveStats_setState( liveStats_idle );
+            testLoops_setWatch( 0 );
+            testLoops_endWatch( watchPtr );
+        }
+        if ( failMap_active ) failMap_finishInstance();
+        testLoops_instanceDone();
+        return;
+    }
+    liveStats_setState( liveStats_waiting );
+    while ( numJoinedInstances < numFinishedInstances ) {
+        joinInstance( &instances[numJoinedInstances++] );
+    }
+    workers = instancePtr->workers;
+    numErrorCases = 0;
+    errorCount = 0;
+    for ( threadNum = 0; threadNum < instancePtr->numWorkers; ++threadNum ) {
+        numErrorCases += workers[threadNum].numErrorCases;
+        errorCount += workers[threadNum].errorCount;
+        testLoops_numCasesRun += workers[threadNum].numCases;
+        if ( failMap_active ) {
+            failMap_addPart( workers[threadNum].failMapPartPtr );
+        }
+    }
+    /*------------------------------------------------------------------------
+    | Every worker stops after `verCases_maxErrorCount' errors of its own, or
+    | with a failure map notes only its first `failMap_maxErrorCount', so the
+    | first that many errors overall are sure to be among those noted.
+    *------------------------------------------------------------------------*/
+    errorCaseNums = malloc( (numErrorCases + 1) * sizeof *errorCaseNums );
+    if ( ! errorCaseNums ) fail( "Out of memory" );
+    caseNumPtr = errorCaseNums;
+    for ( threadNum = 0; threadNum < instancePtr->numWorkers; ++threadNum ) {
+        for ( i = 0; i < workers[threadNum].numErrorCases; ++i ) {
+            *caseNumPtr++ = workers[threadNum].errorCaseNums[i];
+        }
+        free( workers[threadNum].errorCaseNums );
+    }
+    free( workers );
+    qsort(
+        errorCaseNums, numErrorCases, sizeof *errorCaseNums, compareCaseNums );
+    /*------------------------------------------------------------------------
+    | A case can be noted more than once if it fails for several functions of
+    | a fused loop.  The loop itself stops at `verCases_maxErrorCount' errors,
+    | so the list is not otherwise trimmed.
+    *------------------------------------------------------------------------*/
+    if ( numErrorCases ) {
+        caseNumPtr = errorCaseNums;
+        for ( i = 1; i < numErrorCases; ++i ) {
+            if ( errorCaseNums[i] != *caseNumPtr ) {
+                *++caseNumPtr = errorCaseNums[i];
+            }
+        }
+        numErrorCases = caseNumPtr - errorCaseNums + 1;
+    }
+    numSelectedErrors = 0;
+    replayErrorCount = 0;
+    if ( failMap_active && failMap_maxErrorCount ) {
+        if ( failMap_maxErrorCount < numErrorCases ) {
+            numErrorCases = failMap_maxErrorCount;
+        }
+        numSelectedErrors = numErrorCases;
+        replayErrorCount = errorCount;
+    }
+    random_setState( instancePtr->randomState );
+    caseNum = 0;
+    selecting = true;
+    batchSelected = true;
+    selectedCaseNumPtr = errorCaseNums;
+    endSelectedCaseNumPtr = errorCaseNums + numErrorCases;
+    liveStats_setState( liveStats_replaying );
+    instancePtr->function( instancePtr->argPtr );
+    liveStats_setState( liveStats_idle );
+    selecting = false;
+    free( errorCaseNums );
+    if ( failMap_active ) failMap_finishInstance();
+    testLoops_instanceDone();
+
+}
+
@@ -0,0 +1,241 @@
+
+/*============================================================================
+
+This C source file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include "platform.h"
+#include "fail.h"
+#include "random.h"
+#include "genCases.h"
+#include "verCases.h"
+#include "testLoops.h"
+#include "thread.h"
+
+double testLoops_hangSeconds = 0;
+
+/*----------------------------------------------------------------------------
+| Each watched thread counts its calls to `testLoops_subjFlagsFunction' in
+| `count', which is thus odd only while a subject function is running.  The
+| numbers of the cases the thread evaluates in its current batch are kept in
+| `caseNums', so that a stuck count identifies the case.  `lastCount' and
+| `lastTime' belong to the watchdog thread.
+*----------------------------------------------------------------------------*/
+struct testLoops_watch {
+    volatile bool active;
+    volatile uint_fast32_t count;
+    uint_fast32_t batchCount;
+    int numCases;
+    uint_fast64_t caseNums[testLoops_batchSize];
+    void (*function)( void * );
+    void *argPtr;
+    struct random_state randomState;
+    bool replayable;
+    uint_fast32_t lastCount;
+    double lastTime;
+};
+
+static struct testLoops_watch *watches;
+static int numWatches;
+static uint_fast8_t (*subjFlagsFunction)( void );
+
+static THREAD_LOCAL struct testLoops_watch *watchPtr;
+static THREAD_LOCAL bool locating;
+static THREAD_LOCAL uint_fast64_t locateCaseNum;
+
+static uint_fast8_t countSubjCalls( void )
+{
+
+    if ( watchPtr ) ++watchPtr->count;
+    return subjFlagsFunction();
+
+}
+
+/*----------------------------------------------------------------------------
+| Runs the hung instance again on the watchdog thread, evaluating no cases.
+| After the first case, `testLoops_watchCase' has the generator go straight
+| to the hung case, and then writes it.
+*----------------------------------------------------------------------------*/
+static void reportHang( struct testLoops_watch *hungWatchPtr )
+{
+    uint_fast64_t caseNum;
+
+    caseNum =
+        hungWatchPtr->caseNums[
+            (hungWatchPtr->count - hungWatchPtr->batchCount) / 2];
+    fflush( stdout );
+    printf(
+        "Subject function did not return within %g seconds, on test %llu",
+        testLoops_hangSeconds,
+        (unsigned long long) caseNum + 1
+    );
+    if ( hungWatchPtr->replayable ) {
+        fputs( ":\n  ", stdout );
+        verCases_quiet = true;
+        random_setState( hungWatchPtr->randomState );
+        testLoops_setCaseNum( 0 );
+        locating = true;
+        locateCaseNum = caseNum;
+        hungWatchPtr->function( hungWatchPtr->argPtr );
+    }
+    fputs( ".\n", stdout );
+    fflush( stdout );
+    exit( testLoops_hangExitStatus );
+
+}
+
+static void watchdogMain( void *argPtr )
+{
+    double now;
+    int i;
+    struct testLoops_watch *thisWatchPtr;
+    uint_fast32_t count;
+
+    (void) argPtr;
+    for (;;) {
+        thread_sleep( testLoops_hangSeconds / 4 );
+        now = thread_seconds();
+        for ( i = 0; i < numWatches; ++i ) {
+            thisWatchPtr = &watches[i];
+            if ( ! thisWatchPtr->active ) continue;
+            count = thisWatchPtr->count;
+            if ( ! (count & 1) || (count != thisWatchPtr->lastCount) ) {
+                thisWatchPtr->lastCount = count;
+                thisWatchPtr->lastTime = now;
+            } else if (
+                thisWatchPtr->lastTime + testLoops_hangSeconds <= now
+            ) {
+                reportHang( thisWatchPtr );
+            }
+        }
+    }
+
+}
+
+void testLoops_startWatchdog( void )
+{
+
+    numWatches = testLoops_numThreads + 1;
+    watches = calloc( numWatches, sizeof *watches );
+    if ( ! watches ) fail( "Out of memory" );
+    subjFlagsFunction = testLoops_subjFlagsFunction;
+    testLoops_subjFlagsFunction = countSubjCalls;
+    thread_start( watchdogMain, 0 );
+
+}
+
+struct testLoops_watch *
+ testLoops_startWatch(
+     void function( void * ),
+     void *argPtr,
+     const struct random_state *randomStatePtr
+ )
+{
+    int i;
+    struct testLoops_watch *newWatchPtr;
+
+    if ( ! watches ) return 0;
+    for ( i = 0; watches[i].active; ++i ) {
+        if ( i == numWatches - 1 ) fail( "Too many threads to watch" );
+    }
+    newWatchPtr = &watches[i];
+    newWatchPtr->batchCount = newWatchPtr->count;
+    newWatchPtr->numCases = 0;
+    newWatchPtr->function = function;
+    newWatchPtr->argPtr = argPtr;
+    newWatchPtr->randomState = *randomStatePtr;
+    newWatchPtr->replayable = true;
+    newWatchPtr->active = true;
+    return newWatchPtr;
+
+}
+
+void testLoops_setWatch( struct testLoops_watch *newWatchPtr )
+{
+
+    watchPtr = newWatchPtr;
+
+}
+
+void testLoops_endWatch( struct testLoops_watch *oldWatchPtr )
+{
+
+    if ( oldWatchPtr ) oldWatchPtr->active = false;
+
+}
+
+bool testLoops_watchBatch( void )
+{
+
+    if ( locating ) return false;
+    if ( watchPtr ) {
+        watchPtr->batchCount = watchPtr->count;
+        watchPtr->numCases = 0;
+    }
+    return true;
+
+}
+
+void testLoops_watchResumed( void )
+{
+
+    if ( watchPtr ) watchPtr->replayable = false;
+
+}
+
+bool testLoops_watchCase( uint_fast64_t caseNum, bool skip )
+{
+
+    if ( locating ) {
+        if ( caseNum == locateCaseNum ) {
+            genCases_writeCase();
+            fputs( ".\n", stdout );
+            fflush( stdout );
+            exit( testLoops_hangExitStatus );
+        }
+        genCases_seek( locateCaseNum );
+        return true;
+    }
+    if (
+        ! skip && watchPtr && (watchPtr->numCases < testLoops_batchSize)
+    ) {
+        watchPtr->caseNums[watchPtr->numCases++] = caseNum;
+    }
+    return skip;
+
+}
+
@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 =============================================================================*/
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "platform.h"
 #include "softfloat.h"
@@ -52,11 +53,13 @@ void
      float32_t trueFunction( float16_t ), float32_t subjFunction( float16_t ) )
 {
     printf(__func__);
-    int count;
-    float32_t trueZ;
-    uint_fast8_t trueFlags;
-    float32_t subjZ;
-    uint_fast8_t subjFlags;
+    int count, numCases, i;
+    float16_t a[testLoops_batchSize];
+    bool skip[testLoops_batchSize];
+    float32_t trueZ[testLoops_batchSize];
+    uint_fast8_t trueFlags[testLoops_batchSize];
+    float32_t subjZ[testLoops_batchSize];
+    uint_fast8_t subjFlags[testLoops_batchSize];
 
     genCases_bf16_a_init();
     genCases_writeTestsTotal( testLoops_forever );
@@ -64,38 +67,63 @@ void
     verCases_tenThousandsCount = 0;
     count = 10000;
     while ( ! genCases_done || testLoops_forever ) {
-        genCases_bf16_a_next();
-        *testLoops_trueFlagsPtr = 0;
-        trueZ = trueFunction( genCases_bf16_a );
-        trueFlags = *testLoops_trueFlagsPtr;
-        testLoops_subjFlagsFunction();
-        subjZ = subjFunction( genCases_bf16_a );
-        subjFlags = testLoops_subjFlagsFunction();
-        --count;
-        if ( ! count ) {
-            verCases_perTenThousand();
-            count = 10000;
+        testLoops_startBatch();
+        numCases = 0;
+        do {
+            genCases_bf16_a_next();
+            a[numCases] = genCases_bf16_a;
+            skip[numCases] = testLoops_skipCase();
+            ++numCases;
+        } while (
+            (numCases < testLoops_batchSize)
+                && (! genCases_done || testLoops_forever)
+        );
+        for ( i = 0; i < numCases; ++i ) {
+            if ( skip[i] ) continue;
+            *testLoops_trueFlagsPtr = 0;
+            trueZ[i] = trueFunction( a[i] );
+            trueFlags[i] = *testLoops_trueFlagsPtr;
         }
-        if ( ! f32_same( trueZ, subjZ ) || (trueFlags != subjFlags) ) {
-            if (
-                ! verCases_checkNaNs && bf16_isSignalingNaN( genCases_bf16_a )
-            ) {
-                trueFlags |= softfloat_flag_invalid;
+        for ( i = 0; i < numCases; ++i ) {
+            if ( skip[i] ) continue;
+            testLoops_subjFlagsFunction();
+            subjZ[i] = subjFunction( a[i] );
+            subjFlags[i] = testLoops_subjFlagsFunction();
+        }
+        for ( i = 0; i < numCases; ++i ) {
+            --count;
+            if ( ! count ) {
+                verCases_perTenThousand();
+                count = 10000;
             }
+            if ( skip[i] ) continue;
             if (
-                   verCases_checkNaNs
-                || ! f32_isNaN( trueZ )
-                || ! f32_isNaN( subjZ )
-                || f32_isSignalingNaN( subjZ )
-                || (trueFlags != subjFlags)
+                ! f32_same( trueZ[i], subjZ[i] )
+                    || (trueFlags[i] != subjFlags[i])
             ) {
-                ++verCases_errorCount;
-                verCases_writeErrorFound( 10000 - count );
-                writeCase_a_bf16( genCases_bf16_a );
-                writeCase_z_f32( trueZ, trueFlags, subjZ, subjFlags );
-                if ( verCases_errorCount == verCases_maxErrorCount ) break;
+                if (
+                    ! verCases_checkNaNs && bf16_isSignalingNaN( a[i] )
+                ) {
+                    trueFlags[i] |= softfloat_flag_invalid;
+                }
+                if (
+                       verCases_checkNaNs
+                    || ! f32_isNaN( trueZ[i] )
+                    || ! f32_isNaN( subjZ[i] )
+                    || f32_isSignalingNaN( subjZ[i] )
+                    || (trueFlags[i] != subjFlags[i])
+                ) {
+                    ++verCases_errorCount;
+                    if ( testLoops_errorFound( 10000 - count ) ) {
+                        writeCase_a_bf16( a[i] );
+                        writeCase_z_f32(
+                            trueZ[i], trueFlags[i], subjZ[i], subjFlags[i] );
+                    }
+                    if ( verCases_errorCount == verCases_maxErrorCount ) break;
+                }
             }
         }
+        if ( i < numCases ) break;
     }
     verCases_writeTestsPerformed( 10000 - count );
 
@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 =============================================================================*/
 
+#include <stdbool.h>
 #include <stdio.h>
 #include "platform.h"
 #include "softfloat.h"
@@ -53,11 +54,13 @@ void
      float16_t subjFunction( const extFloat80_t * )
  )
 {
-    int count;
-    float16_t trueZ;
-    uint_fast8_t trueFlags;
-    float16_t subjZ;
-    uint_fast8_t subjFlags;
+    int count, numCases, i;
+    extFloat80_t a[testLoops_batchSize];
+    bool skip[testLoops_batchSize];
+    float16_t trueZ[testLoops_batchSize];
+    uint_fast8_t trueFlags[testLoops_batchSize];
+    float16_t subjZ[testLoops_batchSize];
+    uint_fast8_t subjFlags[testLoops_batchSize];
 
     genCases_extF80_a_init();
     genCases_writeTestsTotal( testLoops_forever );
@@ -65,39 +68,64 @@ void
     verCases_tenThousandsCount = 0;
     count = 10000;
     while ( ! genCases_done || testLoops_forever ) {
-        genCases_extF80_a_next();
-        *testLoops_trueFlagsPtr = 0;
-        trueZ = trueFunction( &genCases_extF80_a );
-        trueFlags = *testLoops_trueFlagsPtr;
-        testLoops_subjFlagsFunction();
-        subjZ = subjFunction( &genCases_extF80_a );
-        subjFlags = testLoops_subjFlagsFunction();
-        --count;
-        if ( ! count ) {
-            verCases_perTenThousand();
-            count = 10000;
+        testLoops_startBatch();
+        numCases = 0;
+        do {
+            genCases_extF80_a_next();
+            a[numCases] = genCases_extF80_a;
+            skip[numCases] = testLoops_skipCase();
+            ++numCases;
+        } while (
+            (numCases < testLoops_batchSize)
+                && (! genCases_done || testLoops_forever)
+        );
+        for ( i = 0; i < numCases; ++i ) {
+            if ( skip[i] ) continue;
+            *testLoops_trueFlagsPtr = 0;
+            trueZ[i] = trueFunction( &a[i] );
+            trueFlags[i] = *testLoops_trueFlagsPtr;
         }
-        if ( ! f16_same( trueZ, subjZ ) || (trueFlags != subjFlags) ) {
-            if (
-                ! verCases_checkNaNs
-                    && extF80M_isSignalingNaN( &genCases_extF80_a )
-            ) {
-                trueFlags |= softfloat_flag_invalid;
+        for ( i = 0; i < numCases; ++i ) {
+            if ( skip[i] ) continue;
+            testLoops_subjFlagsFunction();
+            subjZ[i] = subjFunction( &a[i] );
+            subjFlags[i] = testLoops_subjFlagsFunction();
+        }
+        for ( i = 0; i < numCases; ++i ) {
+            --count;
+            if ( ! count ) {
+                verCases_perTenThousand();
+                count = 10000;
             }
+            if ( skip[i] ) continue;
             if (
-                   verCases_checkNaNs
-                || ! f16_isNaN( trueZ )
-                || ! f16_isNaN( subjZ )
-                || f16_isSignalingNaN( subjZ )
-                || (trueFlags != subjFlags)
+                ! f16_same( trueZ[i], subjZ[i] )
+                    || (trueFlags[i] != subjFlags[i])
             ) {
-                ++verCases_errorCount;
-                verCases_writeErrorFound( 10000 - count );
-                writeCase_a_extF80M( &genCases_extF80_a, "  " );
-                writeCase_z_f16( trueZ, trueFlags, subjZ, subjFlags );
-                if ( verCases_errorCount == verCases_maxErrorCount ) break;
+                if (
+                    ! verCases_checkNaNs
+                        && extF80M_isSignalingNaN( &a[i] )
+                ) {
+                    trueFlags[i] |= softfloat_flag_invalid;
+                }
+                if (
+                       verCases_checkNaNs
+                    || ! f16_isNaN( trueZ[i] )
+                    || ! f16_isNaN( subjZ[i] )
+                    || f16_isSignalingNaN( subjZ[i] )
+                    || (trueFlags[i] != subjFlags[i])
+                ) {
+                    ++verCases_errorCount;
+                    if ( testLoops_errorFound( 10000 - count ) ) {
+                        writeCase_a_extF80M( &a[i], "  " );
+                        writeCase_z_f16(
+                            trueZ[i], trueFlags[i], subjZ[i], subjFlags[i] );
+                    }
+                    if ( verCases_errorCount == verCases_maxErrorCount ) break;
+                }
             }
         }
+        if ( i < numCases ) break;
     }
     verCases_writeTestsPerformed( 10000 - count );
 
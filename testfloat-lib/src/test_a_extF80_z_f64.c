@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 =============================================================================*/
 
+#include <stdbool.h>
 #include <stdio.h>
 #include "platform.h"
 #include "softfloat.h"
@@ -53,11 +54,13 @@ void
      float64_t subjFunction( const extFloat80_t * )
  )
 {
-    int count;
-    float64_t trueZ;
-    uint_fast8_t trueFlags;
-    float64_t subjZ;
-    uint_fast8_t subjFlags;
+    int count, numCases, i;
+    extFloat80_t a[testLoops_batchSize];
+    bool skip[testLoops_batchSize];
+    float64_t trueZ[testLoops_batchSize];
+    uint_fast8_t trueFlags[testLoops_batchSize];
+    float64_t subjZ[testLoops_batchSize];
+    uint_fast8_t subjFlags[testLoops_batchSize];
 
     genCases_extF80_a_init();
     genCases_writeTestsTotal( testLoops_forever );
@@ -65,39 +68,64 @@ void
     verCases_tenThousandsCount = 0;
     count = 10000;
     while ( ! genCases_done || testLoops_forever ) {
-        genCases_extF80_a_next();
-        *testLoops_trueFlagsPtr = 0;
-        trueZ = trueFunction( &genCases_extF80_a );
-        trueFlags = *testLoops_trueFlagsPtr;
-        testLoops_subjFlagsFunction();
-        subjZ = subjFunction( &genCases_extF80_a );
-        subjFlags = testLoops_subjFlagsFunction();
-        --count;
-        if ( ! count ) {
-            verCases_perTenThousand();
-            count = 10000;
+        testLoops_startBatch();
+        numCases = 0;
+        do {
+            genCases_extF80_a_next();
+            a[numCases] = genCases_extF80_a;
+            skip[numCases] = testLoops_skipCase();
+            ++numCases;
+        } while (
+            (numCases < testLoops_batchSize)
+                && (! genCases_done || testLoops_forever)
+        );
+        for ( i = 0; i < numCases; ++i ) {
+            if ( skip[i] ) continue;
+            *testLoops_trueFlagsPtr = 0;
+            trueZ[i] = trueFunction( &a[i] );
+            trueFlags[i] = *testLoops_trueFlagsPtr;
         }
-        if ( ! f64_same( trueZ, subjZ ) || (trueFlags != subjFlags) ) {
-            if (
-                ! verCases_checkNaNs
-                    && extF80M_isSignalingNaN( &genCases_extF80_a )
-            ) {
-                trueFlags |= softfloat_flag_invalid;
+        for ( i = 0; i < numCases; ++i ) {
+            if ( skip[i] ) continue;
+            testLoops_subjFlagsFunction();
+            subjZ[i] = subjFunction( &a[i] );
+            subjFlags[i] = testLoops_subjFlagsFunction();
+        }
+        for ( i = 0; i < numCases; ++i ) {
+            --count;
+            if ( ! count ) {
+                verCases_perTenThousand();
+                count = 10000;
             }
+            if ( skip[i] ) continue;
             if (
-                   verCases_checkNaNs
-                || ! f64_isNaN( trueZ )
-                || ! f64_isNaN( subjZ )
-                || f64_isSignalingNaN( subjZ )
-                || (trueFlags != subjFlags)
+                ! f64_same( trueZ[i], subjZ[i] )
+                    || (trueFlags[i] != subjFlags[i])
             ) {
-                ++verCases_errorCount;
-                verCases_writeErrorFound( 10000 - count );
-                writeCase_a_extF80M( &genCases_extF80_a, "\n\t" );
-                writeCase_z_f64( trueZ, trueFlags, subjZ, subjFlags );
-                if ( verCases_errorCount == verCases_maxErrorCount ) break;
+                if (
+                    ! verCases_checkNaNs
+                        && extF80M_isSignalingNaN( &a[i] )
+                ) {
+                    trueFlags[i] |= softfloat_flag_invalid;
+                }
+                if (
+                       verCases_checkNaNs
+                    || ! f64_isNaN( trueZ[i] )
+                    || ! f64_isNaN( subjZ[i] )
+                    || f64_isSignalingNaN( subjZ[i] )
+                    || (trueFlags[i] != subjFlags[i])
+                ) {
+                    ++verCases_errorCount;
+                    if ( testLoops_errorFound( 10000 - count ) ) {
+                        writeCase_a_extF80M( &a[i], "\n\t" );
+                        writeCase_z_f64(
+                            trueZ[i], trueFlags[i], subjZ[i], subjFlags[i] );
+                    }
+                    if ( verCases_errorCount == verCases_maxErrorCount ) break;
+                }
             }
         }
+        if ( i < numCases ) break;
     }
     verCases_writeTestsPerformed( 10000 - count );
 
@@ -56,11 +56,13 @@ void
      bool exact
  )
 {
-    int count;
-    int_fast32_t trueZ;
-    uint_fast8_t trueFlags;
-    int_fast32_t subjZ;
-    uint_fast8_t subjFlags;
+    int count, numCases, i;
+    extFloat80_t a[testLoops_batchSize];
+    bool skip[testLoops_batchSize];
+    int_fast32_t trueZ[testLoops_batchSize];
+    uint_fast8_t trueFlags[testLoops_batchSize];
+    int_fast32_t subjZ[testLoops_batchSize];
+    uint_fast8_t subjFlags[testLoops_batchSize];
 
     genCases_extF80_a_init();
     genCases_writeTestsTotal( testLoops_forever );
@@ -68,34 +70,57 @@ void
     verCases_tenThousandsCount = 0;
     count = 10000;
     while ( ! genCases_done || testLoops_forever ) {
-        genCases_extF80_a_next();
-        *testLoops_trueFlagsPtr = 0;
-        trueZ = trueFunction( &genCases_extF80_a, roundingMode, exact );
-        trueFlags = *testLoops_trueFlagsPtr;
-        testLoops_subjFlagsFunction();
-        subjZ = subjFunction( &genCases_extF80_a, roundingMode, exact );
-        subjFlags = testLoops_subjFlagsFunction();
-        --count;
-        if ( ! count ) {
-            verCases_perTenThousand();
-            count = 10000;
+        testLoops_startBatch();
+        numCases = 0;
+        do {
+            genCases_extF80_a_next();
+            a[numCases] = genCases_extF80_a;
+            skip[numCases] = testLoops_skipCase();
+            ++numCases;
+        } while (
+            (numCases < testLoops_batchSize)
+                && (! genCases_done || testLoops_forever)
+        );
+        for ( i = 0; i < numCases; ++i ) {
+            if ( skip[i] ) continue;
+            *testLoops_trueFlagsPtr = 0;
+            trueZ[i] = trueFunction( &a[i], roundingMode, exact );
+            trueFlags[i] = *testLoops_trueFlagsPtr;
         }
-        if ( (trueZ != subjZ) || (trueFlags != subjFlags) ) {
-            if (
-                   verCases_checkInvInts
-                || (trueFlags != softfloat_flag_invalid)
-                || (subjFlags != softfloat_flag_invalid)
-                || ((subjZ != 0x7FFFFFFF) && (subjZ != -0x7FFFFFFF - 1)
-                        && (! extF80M_isNaN( &genCases_extF80_a )
-                                || (subjZ != 0)))
-            ) {
-                ++verCases_errorCount;
-                verCases_writeErrorFound( 10000 - count );
-                writeCase_a_extF80M( &genCases_extF80_a, "  " );
-                writeCase_z_i32( trueZ, trueFlags, subjZ, subjFlags );
-                if ( verCases_errorCount == verCases_maxErrorCount ) break;
+        for ( i = 0; i < numCases; ++i ) {
+            if ( skip[i] ) continue;
+            testLoops_subjFlagsFunction();
+            subjZ[i] = subjFunction( &a[i], roundingMode, exact );
+            subjFlags[i] = testLoops_subjFlagsFunction();
+        }
+        for ( i = 0; i < numCases; ++i ) {
+            --count;
+            if ( ! count ) {
+                verCases_perTenThousand();
+                count = 10000;
+            }
+            if ( skip[i] ) continue;
+            if ( (trueZ[i] != subjZ[i]) || (trueFlags[i] != subjFlags[i]) ) {
+                if (
+                       verCases_checkInvInts
+                    || (trueFlags[i] != softfloat_flag_invalid)
+                    || (subjFlags[i] != softfloat_flag_invalid)
+                    || ((subjZ[i] != 0x7FFFFFFF)
+                            && (subjZ[i] != -0x7FFFFFFF - 1)
+                            && (! extF80M_isNaN( &a[i] )
+                                    || (subjZ[i] != 0)))
+                ) {
+                    ++verCases_errorCount;
+                    if ( testLoops_errorFound( 10000 - count ) ) {
+                        writeCase_a_extF80M( &a[i], "  " );
+                        writeCase_z_i32(
+                            trueZ[i], trueFlags[i], subjZ[i], subjFlags[i] );
+                    }
+                    if ( verCases_errorCount == verCases_maxErrorCount ) break;
+                }
             }
         }
+        if ( i < numCases ) break;
     }
     verCases_writeTestsPerformed( 10000 - count );
 
@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 =============================================================================*/
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "platform.h"
 #include "softfloat.h"
@@ -53,11 +54,13 @@ void
      void subjFunction( float16_t, float128_t * )
  )
 {
-    int count;
-    float128_t trueZ;
-    uint_fast8_t trueFlags;
-    float128_t subjZ;
-    uint_fast8_t subjFlags;
+    int count, numCases, i;
+    float16_t a[testLoops_batchSize];
+    bool skip[testLoops_batchSize];
+    float128_t trueZ[testLoops_batchSize];
+    uint_fast8_t trueFlags[testLoops_batchSize];
+    float128_t subjZ[testLoops_batchSize];
+    uint_fast8_t subjFlags[testLoops_batchSize];
 
     genCases_f16_a_init();
     genCases_writeTestsTotal( testLoops_forever );
@@ -65,38 +68,63 @@ void
     verCases_tenThousandsCount = 0;
     count = 10000;
     while ( ! genCases_done || testLoops_forever ) {
-        genCases_f16_a_next();
-        *testLoops_trueFlagsPtr = 0;
-        trueFunction( genCases_f16_a, &trueZ );
-        trueFlags = *testLoops_trueFlagsPtr;
-        testLoops_subjFlagsFunction();
-        subjFunction( genCases_f16_a, &subjZ );
-        subjFlags = testLoops_subjFlagsFunction();
-        --count;
-        if ( ! count ) {
-            verCases_perTenThousand();
-            count = 10000;
+        testLoops_startBatch();
+        numCases = 0;
+        do {
+            genCases_f16_a_next();
+            a[numCases] = genCases_f16_a;
+            skip[numCases] = testLoops_skipCase();
+            ++numCases;
+        } while (
+            (numCases < testLoops_batchSize)
+                && (! genCases_done || testLoops_forever)
+        );
+        for ( i = 0; i < numCases; ++i ) {
+            if ( skip[i] ) continue;
+            *testLoops_trueFlagsPtr = 0;
+            trueFunction( a[i], &trueZ[i] );
+            trueFlags[i] = *testLoops_trueFlagsPtr;
         }
-        if ( ! f128M_same( &trueZ, &subjZ ) || (trueFlags != subjFlags) ) {
-            if (
-                ! verCases_checkNaNs && f16_isSignalingNaN( genCases_f16_a )
-            ) {
-                trueFlags |= softfloat_flag_invalid;
+        for ( i = 0; i < numCases; ++i ) {
+            if ( skip[i] ) continue;
+            testLoops_subjFlagsFunction();
+            subjFunction( a[i], &subjZ[i] );
+            subjFlags[i] = testLoops_subjFlagsFunction();
+        }
+        for ( i = 0; i < numCases; ++i ) {
+            --count;
+            if ( ! count ) {
+                verCases_perTenThousand();
+                count = 10000;
             }
+            if ( skip[i] ) continue;
             if (
-                   verCases_checkNaNs
-                || ! f128M_isNaN( &trueZ )
-                || ! f128M_isNaN( &subjZ )
-                || f128M_isSignalingNaN( &subjZ )
-                || (trueFlags != subjFlags)
+                ! f128M_same( &trueZ[i], &subjZ[i] )
+                    || (trueFlags[i] != subjFlags[i])
             ) {
-                ++verCases_errorCount;
-                verCases_writeErrorFound( 10000 - count );
-                writeCase_a_f16( genCases_f16_a );
-                writeCase_z_f128M( &trueZ, trueFlags, &subjZ, subjFlags );
-                if ( verCases_errorCount == verCases_maxErrorCount ) break;
+                if (
+                    ! verCases_checkNaNs && f16_isSignalingNaN( a[i] )
+                ) {
+                    trueFlags[i] |= softfloat_flag_invalid;
+                }
+                if (
+                       verCases_checkNaNs
+                    || ! f128M_isNaN( &trueZ[i] )
+                    || ! f128M_isNaN( &subjZ[i] )
+                    || f128M_isSignalingNaN( &subjZ[i] )
+                    || (trueFlags[i] != subjFlags[i])
+                ) {
+                    ++verCases_errorCount;
+                    if ( testLoops_errorFound( 10000 - count ) ) {
+                        writeCase_a_f16( a[i] );
+                        writeCase_z_f128M(
+                            &trueZ[i], trueFlags[i], &subjZ[i], subjFlags[i] );
+                    }
+                    if ( verCases_errorCount == verCases_maxErrorCount ) break;
+                }
             }
         }
+        if ( i < numCases ) break;
     }
     verCases_writeTestsPerformed( 10000 - count );
 
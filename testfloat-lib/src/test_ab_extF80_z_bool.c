@@ -54,11 +54,14 @@ void
      bool subjFunction( const extFloat80_t *, const extFloat80_t * )
  )
 {
-    int count;
-    bool trueZ;
-    uint_fast8_t trueFlags;
-    bool subjZ;
-    uint_fast8_t subjFlags;
+    int count, numCases, i;
+    extFloat80_t a[testLoops_batchSize];
+    extFloat80_t b[testLoops_batchSize];
+    bool skip[testLoops_batchSize];
+    bool trueZ[testLoops_batchSize];
+    uint_fast8_t trueFlags[testLoops_batchSize];
+    bool subjZ[testLoops_batchSize];
+    uint_fast8_t subjFlags[testLoops_batchSize];
 
     genCases_extF80_ab_init();
     genCases_writeTestsTotal( testLoops_forever );
@@ -66,35 +69,61 @@ void
     verCases_tenThousandsCount = 0;
     count = 10000;
     while ( ! genCases_done || testLoops_forever ) {
-        genCases_extF80_ab_next();
-        *testLoops_trueFlagsPtr = 0;
-        trueZ = trueFunction( &genCases_extF80_a, &genCases_extF80_b );
-        trueFlags = *testLoops_trueFlagsPtr;
-        testLoops_subjFlagsFunction();
-        subjZ = subjFunction( &genCases_extF80_a, &genCases_extF80_b );
-        subjFlags = testLoops_subjFlagsFunction();
-        --count;
-        if ( ! count ) {
-            verCases_perTenThousand();
-            count = 10000;
+        testLoops_startBatch();
+        numCases = 0;
+        do {
+            genCases_extF80_ab_next();
+            a[numCases] = genCases_extF80_a;
+            b[numCases] = genCases_extF80_b;
+            skip[numCases] = testLoops_skipCase();
+            ++numCases;
+        } while (
+            (numCases < testLoops_batchSize)
+                && (! genCases_done || testLoops_forever)
+        );
+        for ( i = 0; i < numCases; ++i ) {
+            if ( skip[i] ) continue;
+            *testLoops_trueFlagsPtr = 0;
+            trueZ[i] = trueFunction( &a[i], &b[i] );
+            trueFlags[i] = *testLoops_trueFlagsPtr;
         }
-        if ( (trueZ != subjZ) || (trueFlags != subjFlags) ) {
-            if (
-                ! verCases_checkNaNs
-                    && (extF80M_isSignalingNaN( &genCases_extF80_a )
-                            || extF80M_isSignalingNaN( &genCases_extF80_b ))
-            ) {
-                trueFlags |= softfloat_flag_invalid;
+        for ( i = 0; i < numCases; ++i ) {
+            if ( skip[i] ) continue;
+            testLoops_subjFlagsFunction();
+            subjZ[i] = subjFunction( &a[i], &b[i] );
+            subjFlags[i] = testLoops_subjFlagsFunction();
+        }
+        for ( i = 0; i < numCases; ++i ) {
+            --count;
+            if ( ! count ) {
+                verCases_perTenThousand();
+                count = 10000;
             }
-            if ( (trueZ != subjZ) || (trueFlags != subjFlags) ) {
-                ++verCases_errorCount;
-                verCases_writeErrorFound( 10000 - count );
-                writeCase_ab_extF80M(
-                    &genCases_extF80_a, &genCases_extF80_b, "  " );
-                writeCase_z_bool( trueZ, trueFlags, subjZ, subjFlags );
-                if ( verCases_errorCount == verCases_maxErrorCount ) break;
+            if ( skip[i] ) continue;
+            if ( (trueZ[i] != subjZ[i]) || (trueFlags[i] != subjFlags[i]) ) {
+                if (
+                    ! verCases_checkNaNs
+                        && (extF80M_isSignalingNaN( &a[i] )
+                                || extF80M_isSignalingNaN( &b[i] ))
+                ) {
+                    trueFlags[i] |= softfloat_flag_invalid;
+                }
+                if (
+                    (trueZ[i] != subjZ[i])
+                        || (trueFlags[i] != subjFlags[i])
+                ) {
+                    ++verCases_errorCount;
+                    if ( testLoops_errorFound( 10000 - count ) ) {
+                        writeCase_ab_extF80M(
+                            &a[i], &b[i], "  " );
+                        writeCase_z_bool(
+                            trueZ[i], trueFlags[i], subjZ[i], subjFlags[i] );
+                    }
+                    if ( verCases_errorCount == verCases_maxErrorCount ) break;
+                }
             }
         }
+        if ( i < numCases ) break;
     }
     verCases_writeTestsPerformed( 10000 - count );
 
@@ -50,6 +50,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "genCases.h"
 #include "verCases.h"
 #include "testLoops.h"
+#include "functionRegistry.h"
 
 static void catchSIGINT(int signalCode)
 {
@@ -1462,7 +1463,7 @@ int main(int argc, char* argv[])
 	uint_fast8_t roundingPrecision;
 	int roundingCode;
 	const char* argPtr;
-	void (* const* subjFunctionPtrPtr)();
+	void (**subjFunctionPtrPtr)();
 	const char* functionNamePtr;
 	unsigned long ui;
 	long i;
@@ -1494,8 +1495,9 @@ int main(int argc, char* argv[])
 			standardFunctionInfoPtr, roundingPrecision, roundingCode);
 	}
 	else {
+		functionRegistry_init();
 		standardFunctionInfoPtr = standardFunctionInfos;
-		subjFunctionPtrPtr = subjfloat_functions;
+		subjFunctionPtrPtr = functionRegistry_subjFunctions;
 		while (standardFunctionInfoPtr->namePtr) {
 			subjFunctionPtr = *subjFunctionPtrPtr;
 			if (subjFunctionPtr) {
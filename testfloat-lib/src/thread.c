@@ -0,0 +1,185 @@
+
+/*============================================================================
+
+This C source file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "platform.h"
+#include "fail.h"
+#include "thread.h"
+
+#ifdef _WIN32
+
+#include <windows.h>
+
+struct thread {
+    HANDLE handle;
+    void (*function)( void * );
+    void *argPtr;
+};
+
+static DWORD WINAPI threadMain( LPVOID threadPtr )
+{
+
+    ((struct thread *) threadPtr)->function(
+        ((struct thread *) threadPtr)->argPtr );
+    return 0;
+
+}
+
+struct thread *thread_start( void function( void * ), void *argPtr )
+{
+    struct thread *threadPtr;
+
+    threadPtr = malloc( sizeof *threadPtr );
+    if ( ! threadPtr ) fail( "Out of memory" );
+    threadPtr->function = function;
+    threadPtr->argPtr = argPtr;
+    threadPtr->handle = CreateThread( 0, 0, threadMain, threadPtr, 0, 0 );
+    if ( ! threadPtr->handle ) fail( "Cannot create thread" );
+    return threadPtr;
+
+}
+
+void thread_join( struct thread *threadPtr )
+{
+
+    WaitForSingleObject( threadPtr->handle, INFINITE );
+    CloseHandle( threadPtr->handle );
+    free( threadPtr );
+
+}
+
+int thread_numProcessors( void )
+{
+    SYSTEM_INFO systemInfo;
+
+    GetSystemInfo( &systemInfo );
+    return systemInfo.dwNumberOfProcessors;
+
+}
+
+double thread_seconds( void )
+{
+    LARGE_INTEGER count, frequency;
+
+    QueryPerformanceCounter( &count );
+    QueryPerformanceFrequency( &frequency );
+    return (double) count.QuadPart / frequency.QuadPart;
+
+}
+
+void thread_sleep( double seconds )
+{
+
+    Sleep( (DWORD) (seconds * 1000) );
+
+}
+
+#else
+
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+struct thread {
+    pthread_t handle;
+    void (*function)( void * );
+    void *argPtr;
+};
+
+static void *threadMain( void *threadPtr )
+{
+
+    ((struct thread *) threadPtr)->function(
+        ((struct thread *) threadPtr)->argPtr );
+    return 0;
+
+}
+
+struct thread *thread_start( void function( void * ), void *argPtr )
+{
+    struct thread *threadPtr;
+
+    threadPtr = malloc( sizeof *threadPtr );
+    if ( ! threadPtr ) fail( "Out of memory" );
+    threadPtr->function = function;
+    threadPtr->argPtr = argPtr;
+    if ( pthread_create( &threadPtr->handle, 0, threadMain, threadPtr ) ) {
+        fail( "Cannot create thread" );
+    }
+    return threadPtr;
+
+}
+
+void thread_join( struct thread *threadPtr )
+{
+
+    pthread_join( threadPtr->handle, 0 );
+    free( threadPtr );
+
+}
+
+int thread_numProcessors( void )
+{
+    long numProcessors;
+
+    numProcessors = sysconf( _SC_NPROCESSORS_ONLN );
+    return (0 < numProcessors) ? numProcessors : 1;
+
+}
+
+double thread_seconds( void )
+{
+    struct timespec time;
+
+    clock_gettime( CLOCK_MONOTONIC, &time );
+    return time.tv_sec + time.tv_nsec * 1e-9;
+
+}
+
+void thread_sleep( double seconds )
+{
+    struct timespec time;
+
+    time.tv_sec = (time_t) seconds;
+    time.tv_nsec = (long) ((seconds - time.tv_sec) * 1e9);
+    while ( nanosleep( &time, &time ) ) continue;
+
+}
+
+#endif
+
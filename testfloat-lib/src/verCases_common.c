@@ -42,6 +42,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <signal.h>
 #include "platform.h"
 #include "verCases.h"
+#include "errorClasses.h"
 
 const char *verCases_functionNamePtr;
 uint_fast8_t verCases_roundingPrecision = 0;
@@ -65,11 +66,35 @@ void verCases_exitWithStatus( void )
 
 }
 
-uint_fast32_t verCases_tenThousandsCount, verCases_errorCount;
+THREAD_LOCAL uint_fast32_t verCases_tenThousandsCount, verCases_errorCount;
+
+THREAD_LOCAL bool verCases_quiet = false;
+
+/*----------------------------------------------------------------------------
+| `progressWritten' is true while the cursor may be left after a progress
+| count on standard error, and `errorsWritten' while error reports are
+| waiting in the buffer of standard output.
+*----------------------------------------------------------------------------*/
+static THREAD_LOCAL bool progressWritten = false;
+static THREAD_LOCAL bool errorsWritten = false;
+
+void verCases_flushErrors( void )
+{
+
+    if ( errorsWritten ) {
+        fflush( stdout );
+        errorsWritten = false;
+    }
+
+}
 
 void verCases_writeTestsPerformed( int count )
 {
 
+    if ( verCases_quiet ) return;
+    if ( errorClasses_active ) errorClasses_write();
+    verCases_flushErrors();
+    progressWritten = false;
     if ( verCases_tenThousandsCount ) {
         fprintf(
             stderr,
@@ -114,15 +139,22 @@ void verCases_perTenThousand( void )
         verCases_writeTestsPerformed( 0 );
         verCases_exitWithStatus();
     }
+    if ( verCases_quiet ) return;
+    verCases_flushErrors();
     fprintf(
         stderr, "\r%3lu0000", (unsigned long) verCases_tenThousandsCount );
+    progressWritten = true;
 
 }
 
 void verCases_writeErrorFound( int count )
 {
 
-    fputc( '\r', stderr );
+    if ( progressWritten ) {
+        fputc( '\r', stderr );
+        progressWritten = false;
+    }
+    errorsWritten = true;
     if ( verCases_errorCount == 1 ) {
         fputs( "Errors found in ", stdout );
         verCases_writeFunctionName( stdout );
@@ -40,40 +40,50 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "functions.h"
 #include "verCases.h"
 
-void verCases_writeFunctionName( FILE *streamPtr )
-{
-    static const char *roundingModeNames[NUM_ROUNDINGMODES] = {
-        0,
-        ", rounding near_even",
-        ", rounding minMag",
-        ", rounding min",
-        ", rounding max",
-        ", rounding near_maxMag",
+static const char *roundingModeNames[NUM_ROUNDINGMODES] = {
+    0,
+    ", rounding near_even",
+    ", rounding minMag",
+    ", rounding min",
+    ", rounding max",
+    ", rounding near_maxMag",
 #ifdef FLOAT_ROUND_ODD
-        ", rounding odd"
+    ", rounding odd"
 #endif
-    };
-
-    fputs( verCases_functionNamePtr, streamPtr );
-    if ( verCases_roundingCode ) {
-        if ( verCases_roundingPrecision ) {
-            fprintf(
-                streamPtr, ", precision %d", (int) verCases_roundingPrecision
-            );
-        }
-        fputs( roundingModeNames[verCases_roundingCode], streamPtr );
-        if ( verCases_tininessCode ) {
-            fputs(
-                (verCases_tininessCode == TININESS_BEFORE_ROUNDING)
-                    ? ", tininess before rounding"
-                    : ", tininess after rounding",
-                streamPtr
-            );
-        }
-    }
-    if ( verCases_usesExact ) {
-        fputs( verCases_exact ? ", exact" : ", not exact", streamPtr );
+};
+
+void verCases_formatFunctionName( char *bufPtr, size_t size )
+{
+    char precision[24];
+
+    precision[0] = 0;
+    if ( verCases_roundingCode && verCases_roundingPrecision ) {
+        sprintf(
+            precision, ", precision %d", (int) verCases_roundingPrecision );
     }
+    snprintf(
+        bufPtr,
+        size,
+        "%s%s%s%s%s",
+        verCases_functionNamePtr,
+        precision,
+        verCases_roundingCode ? roundingModeNames[verCases_roundingCode] : "",
+        ! verCases_roundingCode || ! verCases_tininessCode ? ""
+            : (verCases_tininessCode == TININESS_BEFORE_ROUNDING)
+                  ? ", tininess before rounding"
+                  : ", tininess after rounding",
+        ! verCases_usesExact ? ""
+            : verCases_exact ? ", exact" : ", not exact"
+    );
+
+}
+
+void verCases_writeFunctionName( FILE *streamPtr )
+{
+    char name[128];
+
+    verCases_formatFunctionName( name, sizeof name );
+    fputs( name, streamPtr );
 
 }
 
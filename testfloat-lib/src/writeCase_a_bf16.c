@@ -39,12 +39,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 
 void writeCase_a_bf16( float16_t a )
 {
 
+    if ( corpus_recording ) corpus_ui16Operand( a.v );
+    if ( errorClasses_active ) {
+        errorClasses_bf16Operand( a );
+        return;
+    }
     writeHex_bf16( a, 0 );
     fputs( "  ", stdout );
 
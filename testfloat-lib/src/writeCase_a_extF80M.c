@@ -39,6 +39,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 #ifdef EXTFLOAT80
@@ -46,6 +48,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 void writeCase_a_extF80M( const extFloat80_t *aPtr, const char *sepStringPtr )
 {
 
+    if ( corpus_recording ) corpus_extF80MOperand( aPtr );
+    if ( errorClasses_active ) {
+        errorClasses_extF80MOperand( aPtr );
+        return;
+    }
     writeHex_extF80M( aPtr, 0 );
     fputs( sepStringPtr, stdout );
 
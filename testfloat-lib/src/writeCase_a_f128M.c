@@ -39,6 +39,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 #ifdef FLOAT128
@@ -46,6 +48,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 void writeCase_a_f128M( const float128_t *aPtr, const char *sepStringPtr )
 {
 
+    if ( corpus_recording ) corpus_f128MOperand( aPtr );
+    if ( errorClasses_active ) {
+        errorClasses_f128MOperand( aPtr );
+        return;
+    }
     writeHex_f128M( aPtr, 0 );
     fputs( sepStringPtr, stdout );
 
@@ -39,6 +39,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 #ifdef FLOAT16
@@ -46,6 +48,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 void writeCase_a_f16( float16_t a )
 {
 
+    if ( corpus_recording ) corpus_ui16Operand( a.v );
+    if ( errorClasses_active ) {
+        errorClasses_f16Operand( a );
+        return;
+    }
     writeHex_f16( a, 0 );
     fputs( "  ", stdout );
 
@@ -39,11 +39,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 void writeCase_a_f32( float32_t a, const char *sepStringPtr )
 {
 
+    if ( corpus_recording ) corpus_ui32Operand( a.v );
+    if ( errorClasses_active ) {
+        errorClasses_f32Operand( a );
+        return;
+    }
     writeHex_f32( a, 0 );
     fputs( sepStringPtr, stdout );
 
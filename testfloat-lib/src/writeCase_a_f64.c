@@ -39,6 +39,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 #ifdef FLOAT64
@@ -46,6 +48,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 void writeCase_a_f64( float64_t a, const char *sepStringPtr )
 {
 
+    if ( corpus_recording ) corpus_ui64Operand( a.v );
+    if ( errorClasses_active ) {
+        errorClasses_f64Operand( a );
+        return;
+    }
     writeHex_f64( a, 0 );
     fputs( sepStringPtr, stdout );
 
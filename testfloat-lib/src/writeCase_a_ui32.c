@@ -39,11 +39,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 void writeCase_a_ui32( uint_fast32_t a, const char *sepStringPtr )
 {
 
+    if ( corpus_recording ) corpus_ui32Operand( a );
+    if ( errorClasses_active ) {
+        errorClasses_ui32Operand( a );
+        return;
+    }
     writeHex_ui32( a, 0 );
     fputs( sepStringPtr, stdout );
 
@@ -39,11 +39,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 void writeCase_a_ui64( uint_fast64_t a, const char *sepStringPtr )
 {
 
+    if ( corpus_recording ) corpus_ui64Operand( a );
+    if ( errorClasses_active ) {
+        errorClasses_ui64Operand( a );
+        return;
+    }
     writeHex_ui64( a, 0 );
     fputs( sepStringPtr, stdout );
 
@@ -39,6 +39,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 #ifdef EXTFLOAT80
@@ -51,6 +53,15 @@ void
  )
 {
 
+    if ( corpus_recording ) {
+        corpus_extF80MOperand( aPtr );
+        corpus_extF80MOperand( bPtr );
+    }
+    if ( errorClasses_active ) {
+        errorClasses_extF80MOperand( aPtr );
+        errorClasses_extF80MOperand( bPtr );
+        return;
+    }
     writeHex_extF80M( aPtr, 0 );
     fputs( "  ", stdout );
     writeHex_extF80M( bPtr, 0 );
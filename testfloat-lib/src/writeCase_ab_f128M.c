@@ -39,6 +39,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 #ifdef FLOAT128
@@ -46,6 +48,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 void writeCase_ab_f128M( const float128_t *aPtr, const float128_t *bPtr )
 {
 
+    if ( corpus_recording ) {
+        corpus_f128MOperand( aPtr );
+        corpus_f128MOperand( bPtr );
+    }
+    if ( errorClasses_active ) {
+        errorClasses_f128MOperand( aPtr );
+        errorClasses_f128MOperand( bPtr );
+        return;
+    }
     writeHex_f128M( aPtr, 0 );
     fputs( "  ", stdout );
     writeHex_f128M( bPtr, 0 );
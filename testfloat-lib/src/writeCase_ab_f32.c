@@ -39,11 +39,22 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 void writeCase_ab_f32( float32_t a, float32_t b )
 {
 
+    if ( corpus_recording ) {
+        corpus_ui32Operand( a.v );
+        corpus_ui32Operand( b.v );
+    }
+    if ( errorClasses_active ) {
+        errorClasses_f32Operand( a );
+        errorClasses_f32Operand( b );
+        return;
+    }
     writeHex_f32( a, 0 );
     fputs( "  ", stdout );
     writeHex_f32( b, 0 );
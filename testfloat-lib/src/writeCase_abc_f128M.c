@@ -39,6 +39,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 #ifdef FLOAT128
@@ -48,6 +50,17 @@ void
      const float128_t *aPtr, const float128_t *bPtr, const float128_t *cPtr )
 {
 
+    if ( corpus_recording ) {
+        corpus_f128MOperand( aPtr );
+        corpus_f128MOperand( bPtr );
+        corpus_f128MOperand( cPtr );
+    }
+    if ( errorClasses_active ) {
+        errorClasses_f128MOperand( aPtr );
+        errorClasses_f128MOperand( bPtr );
+        errorClasses_f128MOperand( cPtr );
+        return;
+    }
     writeHex_f128M( aPtr, 0 );
     fputs( "  ", stdout );
     writeHex_f128M( bPtr, 0 );
@@ -39,6 +39,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 #ifdef FLOAT16
@@ -46,6 +48,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 void writeCase_abc_f16( float16_t a, float16_t b, float16_t c )
 {
 
+    if ( corpus_recording ) {
+        corpus_ui16Operand( a.v );
+        corpus_ui16Operand( b.v );
+        corpus_ui16Operand( c.v );
+    }
+    if ( errorClasses_active ) {
+        errorClasses_f16Operand( a );
+        errorClasses_f16Operand( b );
+        errorClasses_f16Operand( c );
+        return;
+    }
     writeHex_f16( a, 0 );
     fputs( "  ", stdout );
     writeHex_f16( b, 0 );
@@ -39,11 +39,24 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 void writeCase_abc_f32( float32_t a, float32_t b, float32_t c )
 {
 
+    if ( corpus_recording ) {
+        corpus_ui32Operand( a.v );
+        corpus_ui32Operand( b.v );
+        corpus_ui32Operand( c.v );
+    }
+    if ( errorClasses_active ) {
+        errorClasses_f32Operand( a );
+        errorClasses_f32Operand( b );
+        errorClasses_f32Operand( c );
+        return;
+    }
     writeHex_f32( a, 0 );
     fputs( "  ", stdout );
     writeHex_f32( b, 0 );
@@ -39,6 +39,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 #ifdef FLOAT64
@@ -46,6 +48,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 void writeCase_abc_f64( float64_t a, float64_t b, float64_t c )
 {
 
+    if ( corpus_recording ) {
+        corpus_ui64Operand( a.v );
+        corpus_ui64Operand( b.v );
+        corpus_ui64Operand( c.v );
+    }
+    if ( errorClasses_active ) {
+        errorClasses_f64Operand( a );
+        errorClasses_f64Operand( b );
+        errorClasses_f64Operand( c );
+        return;
+    }
     writeHex_f64( a, 0 );
     fputs( "  ", stdout );
     writeHex_f64( b, 0 );
@@ -40,6 +40,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "platform.h"
 #include "softfloat.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 #ifdef BFLOAT16
@@ -53,13 +55,19 @@ void
  )
 {
 
+    if ( corpus_recording ) corpus_addCase();
+    if (
+        errorClasses_active
+            && ! errorClasses_bf16Result( trueZ, trueFlags, subjZ, subjFlags )
+    ) {
+        return;
+    }
     fputs( "=> ", stdout );
     writeHex_bf16( subjZ, ' ' );
     writeHex_softfloat_flags( subjFlags, 0 );
     fputs( "  expected ", stdout );
     writeHex_bf16( trueZ, ' ' );
     writeHex_softfloat_flags( trueFlags, '\n' );
-    fflush( stdout );
 
 }
 
@@ -40,6 +40,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include "platform.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 void
@@ -47,13 +49,19 @@ void
      bool trueZ, uint_fast8_t trueFlags, bool subjZ, uint_fast8_t subjFlags )
 {
 
+    if ( corpus_recording ) corpus_addCase();
+    if (
+        errorClasses_active
+            && ! errorClasses_boolResult( trueZ, trueFlags, subjZ, subjFlags )
+    ) {
+        return;
+    }
     fputs( "=> ", stdout );
     writeHex_bool( subjZ, ' ' );
     writeHex_softfloat_flags( subjFlags, 0 );
     fputs( "  expected ", stdout );
     writeHex_bool( trueZ, ' ' );
     writeHex_softfloat_flags( trueFlags, '\n' );
-    fflush( stdout );
 
 }
 
@@ -40,6 +40,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "platform.h"
 #include "softfloat.h"
 #include "writeHex.h"
+#include "errorClasses.h"
+#include "corpus.h"
 #include "writeCase.h"
 
 #ifdef FLOAT128
@@ -53,13 +55,20 @@ void
  )
 {
 
+    if ( corpus_recording ) corpus_addCase();
+    if (
+        errorClasses_active
+            && ! errorClasses_f128MResult(
+                     trueZPtr, trueFlags, subjZPtr, subjFlags )
+    ) {
+        return;
+    }
     fputs( "=> ", stdout );
     writeHex_f128M( subjZPtr, ' ' );
     writeHex_softfloat_flags( subjFlags, 0 );
     fputs( "\n\texpected ", stdout );
     writeHex_f128M( trueZPtr, ' ' );
     writeHex_softfloat_flags( trueFlags, '\n' );
-    fflush( stdout );
 
 }
 
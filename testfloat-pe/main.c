@@ -50,6 +50,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "genCases.h"
 #include "verCases.h"
 #include "testLoops.h"
+#include "writeCase.h"
+#include "errorClasses.h"
+#include "corpus.h"
+#include "failFast.h"
+#include "liveStats.h"
+#include "thread.h"
+#include "random.h"
+#include "subprocess.h"
+#include "jobCosts.h"
+#include "functionRegistry.h"
+#include "failMap.h"
 
 static void catchSIGINT(int signalCode)
 {
@@ -160,6 +171,11 @@ typedef float32_t funcType_az_f32(float32_t);
 typedef float32_t funcType_abz_f32(float32_t, float32_t);
 typedef float32_t funcType_abcz_f32(float32_t, float32_t, float32_t);
 typedef bool funcType_ab_f32_z_bool(float32_t, float32_t);
+typedef uint_fast32_t funcType_a_f32_z_ui32_rx(float32_t, uint_fast8_t, bool);
+typedef uint_fast64_t funcType_a_f32_z_ui64_rx(float32_t, uint_fast8_t, bool);
+typedef int_fast32_t funcType_a_f32_z_i32_rx(float32_t, uint_fast8_t, bool);
+typedef int_fast64_t funcType_a_f32_z_i64_rx(float32_t, uint_fast8_t, bool);
+typedef float32_t funcType_az_f32_rx(float32_t, uint_fast8_t, bool);
 
 #ifdef FLOAT64
 typedef uint_fast32_t funcType_a_f64_z_ui32(float64_t);
@@ -180,6 +196,11 @@ typedef float64_t funcType_az_f64(float64_t);
 typedef float64_t funcType_abz_f64(float64_t, float64_t);
 typedef float64_t funcType_abcz_f64(float64_t, float64_t, float64_t);
 typedef bool funcType_ab_f64_z_bool(float64_t, float64_t);
+typedef uint_fast32_t funcType_a_f64_z_ui32_rx(float64_t, uint_fast8_t, bool);
+typedef uint_fast64_t funcType_a_f64_z_ui64_rx(float64_t, uint_fast8_t, bool);
+typedef int_fast32_t funcType_a_f64_z_i32_rx(float64_t, uint_fast8_t, bool);
+typedef int_fast64_t funcType_a_f64_z_i64_rx(float64_t, uint_fast8_t, bool);
+typedef float64_t funcType_az_f64_rx(float64_t, uint_fast8_t, bool);
 #endif
 
 #ifdef EXTFLOAT80
@@ -504,20 +525,285 @@ subjFunction_az_f128_rx(
 
 #endif
 
+/*----------------------------------------------------------------------------
+| Test loops specialized to each subject function of the common forms, made
+| from "testLoops_template.h".  `runTestLoop' uses these in place of the
+| general `test_*' functions, so the true and subject functions are called
+| directly.  This program always checks NaN results exactly.
+*----------------------------------------------------------------------------*/
+#define testLoops_checkNaNs true
+
+#ifdef SUBJ_UI32_TO_F32
+#define testLoop_function ui32_to_f32
+#define testLoop_a ui32
+#define testLoop_numOperands 1
+#define testLoop_z f32
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_UI64_TO_F32
+#define testLoop_function ui64_to_f32
+#define testLoop_a ui64
+#define testLoop_numOperands 1
+#define testLoop_z f32
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_I32_TO_F32
+#define testLoop_function i32_to_f32
+#define testLoop_a i32
+#define testLoop_numOperands 1
+#define testLoop_z f32
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_I64_TO_F32
+#define testLoop_function i64_to_f32
+#define testLoop_a i64
+#define testLoop_numOperands 1
+#define testLoop_z f32
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F32_ADD
+#define testLoop_function f32_add
+#define testLoop_a f32
+#define testLoop_numOperands 2
+#define testLoop_z f32
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F32_SUB
+#define testLoop_function f32_sub
+#define testLoop_a f32
+#define testLoop_numOperands 2
+#define testLoop_z f32
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F32_MUL
+#define testLoop_function f32_mul
+#define testLoop_a f32
+#define testLoop_numOperands 2
+#define testLoop_z f32
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F32_MULADD
+#define testLoop_function f32_mulAdd
+#define testLoop_a f32
+#define testLoop_numOperands 3
+#define testLoop_z f32
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F32_DIV
+#define testLoop_function f32_div
+#define testLoop_a f32
+#define testLoop_numOperands 2
+#define testLoop_z f32
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F32_REM
+#define testLoop_function f32_rem
+#define testLoop_a f32
+#define testLoop_numOperands 2
+#define testLoop_z f32
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F32_SQRT
+#define testLoop_function f32_sqrt
+#define testLoop_a f32
+#define testLoop_numOperands 1
+#define testLoop_z f32
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F32_EQ
+#define testLoop_function f32_eq
+#define testLoop_a f32
+#define testLoop_numOperands 2
+#define testLoop_z boolean
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F32_LE
+#define testLoop_function f32_le
+#define testLoop_a f32
+#define testLoop_numOperands 2
+#define testLoop_z boolean
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F32_LT
+#define testLoop_function f32_lt
+#define testLoop_a f32
+#define testLoop_numOperands 2
+#define testLoop_z boolean
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F32_EQ_SIGNALING
+#define testLoop_function f32_eq_signaling
+#define testLoop_a f32
+#define testLoop_numOperands 2
+#define testLoop_z boolean
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F32_LE_QUIET
+#define testLoop_function f32_le_quiet
+#define testLoop_a f32
+#define testLoop_numOperands 2
+#define testLoop_z boolean
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F32_LT_QUIET
+#define testLoop_function f32_lt_quiet
+#define testLoop_a f32
+#define testLoop_numOperands 2
+#define testLoop_z boolean
+#include "testLoops_template.h"
+#endif
+#ifdef FLOAT64
+#ifdef SUBJ_UI32_TO_F64
+#define testLoop_function ui32_to_f64
+#define testLoop_a ui32
+#define testLoop_numOperands 1
+#define testLoop_z f64
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_UI64_TO_F64
+#define testLoop_function ui64_to_f64
+#define testLoop_a ui64
+#define testLoop_numOperands 1
+#define testLoop_z f64
+#define testLoop_longCase
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_I32_TO_F64
+#define testLoop_function i32_to_f64
+#define testLoop_a i32
+#define testLoop_numOperands 1
+#define testLoop_z f64
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_I64_TO_F64
+#define testLoop_function i64_to_f64
+#define testLoop_a i64
+#define testLoop_numOperands 1
+#define testLoop_z f64
+#define testLoop_longCase
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F32_TO_F64
+#define testLoop_function f32_to_f64
+#define testLoop_a f32
+#define testLoop_numOperands 1
+#define testLoop_z f64
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F64_TO_F32
+#define testLoop_function f64_to_f32
+#define testLoop_a f64
+#define testLoop_numOperands 1
+#define testLoop_z f32
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F64_ADD
+#define testLoop_function f64_add
+#define testLoop_a f64
+#define testLoop_numOperands 2
+#define testLoop_z f64
+#define testLoop_longCase
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F64_SUB
+#define testLoop_function f64_sub
+#define testLoop_a f64
+#define testLoop_numOperands 2
+#define testLoop_z f64
+#define testLoop_longCase
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F64_MUL
+#define testLoop_function f64_mul
+#define testLoop_a f64
+#define testLoop_numOperands 2
+#define testLoop_z f64
+#define testLoop_longCase
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F64_MULADD
+#define testLoop_function f64_mulAdd
+#define testLoop_a f64
+#define testLoop_numOperands 3
+#define testLoop_z f64
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F64_DIV
+#define testLoop_function f64_div
+#define testLoop_a f64
+#define testLoop_numOperands 2
+#define testLoop_z f64
+#define testLoop_longCase
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F64_REM
+#define testLoop_function f64_rem
+#define testLoop_a f64
+#define testLoop_numOperands 2
+#define testLoop_z f64
+#define testLoop_longCase
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F64_SQRT
+#define testLoop_function f64_sqrt
+#define testLoop_a f64
+#define testLoop_numOperands 1
+#define testLoop_z f64
+#define testLoop_longCase
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F64_EQ
+#define testLoop_function f64_eq
+#define testLoop_a f64
+#define testLoop_numOperands 2
+#define testLoop_z boolean
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F64_LE
+#define testLoop_function f64_le
+#define testLoop_a f64
+#define testLoop_numOperands 2
+#define testLoop_z boolean
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F64_LT
+#define testLoop_function f64_lt
+#define testLoop_a f64
+#define testLoop_numOperands 2
+#define testLoop_z boolean
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F64_EQ_SIGNALING
+#define testLoop_function f64_eq_signaling
+#define testLoop_a f64
+#define testLoop_numOperands 2
+#define testLoop_z boolean
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F64_LE_QUIET
+#define testLoop_function f64_le_quiet
+#define testLoop_a f64
+#define testLoop_numOperands 2
+#define testLoop_z boolean
+#include "testLoops_template.h"
+#endif
+#ifdef SUBJ_F64_LT_QUIET
+#define testLoop_function f64_lt_quiet
+#define testLoop_a f64
+#define testLoop_numOperands 2
+#define testLoop_z boolean
+#include "testLoops_template.h"
+#endif
+#endif
+
 static
 void
-testFunctionInstance(
+runTestLoop(
 	int functionCode, uint_fast8_t roundingMode, bool exact)
 {
 #ifdef FLOAT16
 	funcType_abz_f16* trueFunction_abz_f16;
 	funcType_ab_f16_z_bool* trueFunction_ab_f16_z_bool;
-#endif
-	funcType_abz_f32* trueFunction_abz_f32;
-	funcType_ab_f32_z_bool* trueFunction_ab_f32_z_bool;
-#ifdef FLOAT64
-	funcType_abz_f64* trueFunction_abz_f64;
-	funcType_ab_f64_z_bool* trueFunction_ab_f64_z_bool;
 #endif
 #ifdef EXTFLOAT80
 	funcType_abz_extF80* trueFunction_abz_extF80;
@@ -528,9 +814,6 @@ testFunctionInstance(
 	funcType_ab_f128_z_bool* trueFunction_ab_f128_z_bool;
 #endif
 
-	fputs("Testing ", stderr);
-	verCases_writeFunctionName(stderr);
-	fputs(".\n", stderr);
 	switch (functionCode) {
 		/*--------------------------------------------------------------------
 		*--------------------------------------------------------------------*/
@@ -544,15 +827,13 @@ testFunctionInstance(
 #endif
 #ifdef SUBJ_UI32_TO_F32
 	case UI32_TO_F32:
-		test_a_ui32_z_f32(
-			ui32_to_f32, (funcType_a_ui32_z_f32*)subjFunctionPtr);
+		test_ui32_to_f32();
 		break;
 #endif
 #ifdef FLOAT64
 #ifdef SUBJ_UI32_TO_F64
 	case UI32_TO_F64:
-		test_a_ui32_z_f64(
-			ui32_to_f64, (funcType_a_ui32_z_f64*)subjFunctionPtr);
+		test_ui32_to_f64();
 		break;
 #endif
 #endif
@@ -582,15 +863,13 @@ testFunctionInstance(
 #endif
 #ifdef SUBJ_UI64_TO_F32
 	case UI64_TO_F32:
-		test_a_ui64_z_f32(
-			ui64_to_f32, (funcType_a_ui64_z_f32*)subjFunctionPtr);
+		test_ui64_to_f32();
 		break;
 #endif
 #ifdef FLOAT64
 #ifdef SUBJ_UI64_TO_F64
 	case UI64_TO_F64:
-		test_a_ui64_z_f64(
-			ui64_to_f64, (funcType_a_ui64_z_f64*)subjFunctionPtr);
+		test_ui64_to_f64();
 		break;
 #endif
 #endif
@@ -620,15 +899,13 @@ testFunctionInstance(
 #endif
 #ifdef SUBJ_I32_TO_F32
 	case I32_TO_F32:
-		test_a_i32_z_f32(
-			i32_to_f32, (funcType_a_i32_z_f32*)subjFunctionPtr);
+		test_i32_to_f32();
 		break;
 #endif
 #ifdef FLOAT64
 #ifdef SUBJ_I32_TO_F64
 	case I32_TO_F64:
-		test_a_i32_z_f64(
-			i32_to_f64, (funcType_a_i32_z_f64*)subjFunctionPtr);
+		test_i32_to_f64();
 		break;
 #endif
 #endif
@@ -658,15 +935,13 @@ testFunctionInstance(
 #endif
 #ifdef SUBJ_I64_TO_F32
 	case I64_TO_F32:
-		test_a_i64_z_f32(
-			i64_to_f32, (funcType_a_i64_z_f32*)subjFunctionPtr);
+		test_i64_to_f32();
 		break;
 #endif
 #ifdef FLOAT64
 #ifdef SUBJ_I64_TO_F64
 	case I64_TO_F64:
-		test_a_i64_z_f64(
-			i64_to_f64, (funcType_a_i64_z_f64*)subjFunctionPtr);
+		test_i64_to_f64();
 		break;
 #endif
 #endif
@@ -858,8 +1133,7 @@ testFunctionInstance(
 #ifdef FLOAT64
 #ifdef SUBJ_F32_TO_F64
 	case F32_TO_F64:
-		test_a_f32_z_f64(
-			f32_to_f64, (funcType_a_f32_z_f64*)subjFunctionPtr);
+		test_f32_to_f64();
 		break;
 #endif
 #endif
@@ -885,79 +1159,69 @@ testFunctionInstance(
 		break;
 #ifdef SUBJ_F32_ADD
 	case F32_ADD:
-		trueFunction_abz_f32 = f32_add;
-		goto test_abz_f32;
+		test_f32_add();
+		break;
 #endif
 #ifdef SUBJ_F32_SUB
 	case F32_SUB:
-		trueFunction_abz_f32 = f32_sub;
-		goto test_abz_f32;
+		test_f32_sub();
+		break;
 #endif
 #ifdef SUBJ_F32_MUL
 	case F32_MUL:
-		trueFunction_abz_f32 = f32_mul;
-		goto test_abz_f32;
+		test_f32_mul();
+		break;
 #endif
 #ifdef SUBJ_F32_MULADD
 	case F32_MULADD:
-		test_abcz_f32(f32_mulAdd, (funcType_abcz_f32*)subjFunctionPtr);
+		test_f32_mulAdd();
 		break;
 #endif
 #ifdef SUBJ_F32_DIV
 	case F32_DIV:
-		trueFunction_abz_f32 = f32_div;
-		goto test_abz_f32;
+		test_f32_div();
+		break;
 #endif
 #ifdef SUBJ_F32_REM
 	case F32_REM:
-		trueFunction_abz_f32 = f32_rem;
-		goto test_abz_f32;
-#endif
-	test_abz_f32:
-		test_abz_f32(
-			trueFunction_abz_f32, (funcType_abz_f32*)subjFunctionPtr);
+		test_f32_rem();
 		break;
+#endif
 #ifdef SUBJ_F32_SQRT
 	case F32_SQRT:
-		test_az_f32(f32_sqrt, (funcType_az_f32*)subjFunctionPtr);
+		test_f32_sqrt();
 		break;
 #endif
 #ifdef SUBJ_F32_EQ
 	case F32_EQ:
-		trueFunction_ab_f32_z_bool = f32_eq;
-		goto test_ab_f32_z_bool;
+		test_f32_eq();
+		break;
 #endif
 #ifdef SUBJ_F32_LE
 	case F32_LE:
-		trueFunction_ab_f32_z_bool = f32_le;
-		goto test_ab_f32_z_bool;
+		test_f32_le();
+		break;
 #endif
 #ifdef SUBJ_F32_LT
 	case F32_LT:
-		trueFunction_ab_f32_z_bool = f32_lt;
-		goto test_ab_f32_z_bool;
+		test_f32_lt();
+		break;
 #endif
 #ifdef SUBJ_F32_EQ_SIGNALING
 	case F32_EQ_SIGNALING:
-		trueFunction_ab_f32_z_bool = f32_eq_signaling;
-		goto test_ab_f32_z_bool;
+		test_f32_eq_signaling();
+		break;
 #endif
 #ifdef SUBJ_F32_LE_QUIET
 	case F32_LE_QUIET:
-		trueFunction_ab_f32_z_bool = f32_le_quiet;
-		goto test_ab_f32_z_bool;
+		test_f32_le_quiet();
+		break;
 #endif
 #ifdef SUBJ_F32_LT_QUIET
 	case F32_LT_QUIET:
-		trueFunction_ab_f32_z_bool = f32_lt_quiet;
-		goto test_ab_f32_z_bool;
-#endif
-	test_ab_f32_z_bool:
-		test_ab_f32_z_bool(
-			trueFunction_ab_f32_z_bool,
-			(funcType_ab_f32_z_bool*)subjFunctionPtr
-		);
+		test_f32_lt_quiet();
 		break;
+#endif
 		/*--------------------------------------------------------------------
 		*--------------------------------------------------------------------*/
 #ifdef FLOAT64
@@ -987,8 +1251,7 @@ testFunctionInstance(
 #endif
 #ifdef SUBJ_F64_TO_F32
 	case F64_TO_F32:
-		test_a_f64_z_f32(
-			f64_to_f32, (funcType_a_f64_z_f32*)subjFunctionPtr);
+		test_f64_to_f32();
 		break;
 #endif
 #ifdef EXTFLOAT80
@@ -1013,79 +1276,69 @@ testFunctionInstance(
 		break;
 #ifdef SUBJ_F64_ADD
 	case F64_ADD:
-		trueFunction_abz_f64 = f64_add;
-		goto test_abz_f64;
+		test_f64_add();
+		break;
 #endif
 #ifdef SUBJ_F64_SUB
 	case F64_SUB:
-		trueFunction_abz_f64 = f64_sub;
-		goto test_abz_f64;
+		test_f64_sub();
+		break;
 #endif
 #ifdef SUBJ_F64_MUL
 	case F64_MUL:
-		trueFunction_abz_f64 = f64_mul;
-		goto test_abz_f64;
+		test_f64_mul();
+		break;
 #endif
 #ifdef SUBJ_F64_MULADD
 	case F64_MULADD:
-		test_abcz_f64(f64_mulAdd, (funcType_abcz_f64*)subjFunctionPtr);
+		test_f64_mulAdd();
 		break;
 #endif
 #ifdef SUBJ_F64_DIV
 	case F64_DIV:
-		trueFunction_abz_f64 = f64_div;
-		goto test_abz_f64;
+		test_f64_div();
+		break;
 #endif
 #ifdef SUBJ_F64_REM
 	case F64_REM:
-		trueFunction_abz_f64 = f64_rem;
-		goto test_abz_f64;
-#endif
-	test_abz_f64:
-		test_abz_f64(
-			trueFunction_abz_f64, (funcType_abz_f64*)subjFunctionPtr);
+		test_f64_rem();
 		break;
+#endif
 #ifdef SUBJ_F64_SQRT
 	case F64_SQRT:
-		test_az_f64(f64_sqrt, (funcType_az_f64*)subjFunctionPtr);
+		test_f64_sqrt();
 		break;
 #endif
 #ifdef SUBJ_F64_EQ
 	case F64_EQ:
-		trueFunction_ab_f64_z_bool = f64_eq;
-		goto test_ab_f64_z_bool;
+		test_f64_eq();
+		break;
 #endif
 #ifdef SUBJ_F64_LE
 	case F64_LE:
-		trueFunction_ab_f64_z_bool = f64_le;
-		goto test_ab_f64_z_bool;
+		test_f64_le();
+		break;
 #endif
 #ifdef SUBJ_F64_LT
 	case F64_LT:
-		trueFunction_ab_f64_z_bool = f64_lt;
-		goto test_ab_f64_z_bool;
+		test_f64_lt();
+		break;
 #endif
 #ifdef SUBJ_F64_EQ_SIGNALING
 	case F64_EQ_SIGNALING:
-		trueFunction_ab_f64_z_bool = f64_eq_signaling;
-		goto test_ab_f64_z_bool;
+		test_f64_eq_signaling();
+		break;
 #endif
 #ifdef SUBJ_F64_LE_QUIET
 	case F64_LE_QUIET:
-		trueFunction_ab_f64_z_bool = f64_le_quiet;
-		goto test_ab_f64_z_bool;
+		test_f64_le_quiet();
+		break;
 #endif
 #ifdef SUBJ_F64_LT_QUIET
 	case F64_LT_QUIET:
-		trueFunction_ab_f64_z_bool = f64_lt_quiet;
-		goto test_ab_f64_z_bool;
-#endif
-	test_ab_f64_z_bool:
-		test_ab_f64_z_bool(
-			trueFunction_ab_f64_z_bool,
-			(funcType_ab_f64_z_bool*)subjFunctionPtr
-		);
+		test_f64_lt_quiet();
 		break;
+#endif
 #endif
 		/*--------------------------------------------------------------------
 		*--------------------------------------------------------------------*/
@@ -1354,7 +1607,539 @@ testFunctionInstance(
 		break;
 #endif
 	}
-	if ((verCases_errorStop && verCases_anyErrors) || verCases_stop) {
+
+}
+
+struct testLoopArgs {
+	int functionCode;
+	uint_fast8_t roundingPrecision;
+	int roundingCode;
+	uint_fast8_t roundingMode;
+	bool fixedRounding;
+	bool exact;
+	bool fused;
+};
+
+/*----------------------------------------------------------------------------
+| With option `-fuse', functions of the same form are tested together in one
+| pass over a shared stream of operands, by `test_abz_f32_fused' and its
+| siblings.  With option `-rfuse', each function is likewise tested in all
+| selected rounding modes in one pass, and functions whose names fix the
+| rounding mode (such as `f32_to_i32_r_minMag') are tested together with
+| the same function in the other modes.  While `testFunction' runs such a
+| group, the group is described by the variables below, with one entry for
+| each function and rounding mode.
+*----------------------------------------------------------------------------*/
+enum {
+	FUSED_NONE = 0,
+	FUSED_ABZ_F32,
+	FUSED_AB_F32_Z_BOOL,
+	FUSED_AZ_F32,
+	FUSED_ABCZ_F32,
+	FUSED_AZ_F32_RX,
+	FUSED_A_F32_Z_UI32_RX,
+	FUSED_A_F32_Z_UI64_RX,
+	FUSED_A_F32_Z_I32_RX,
+	FUSED_A_F32_Z_I64_RX,
+#ifdef FLOAT64
+	FUSED_ABZ_F64,
+	FUSED_AB_F64_Z_BOOL,
+	FUSED_AZ_F64,
+	FUSED_ABCZ_F64,
+	FUSED_AZ_F64_RX,
+	FUSED_A_F64_Z_UI32_RX,
+	FUSED_A_F64_Z_UI64_RX,
+	FUSED_A_F64_Z_I32_RX,
+	FUSED_A_F64_Z_I64_RX,
+#endif
+};
+enum { maxFusedFunctions = 16 };
+enum {
+	fusedAttribsMask =
+		FUNC_ARG_ROUNDINGMODE | FUNC_EFF_ROUNDINGMODE
+			| FUNC_EFF_ROUNDINGPRECISION
+};
+
+static bool fuse = false;
+static bool rfuse = false;
+static bool* fusedTested;
+static int fusedKind, numFusedFunctions;
+static struct testLoops_fusedInfo
+	fusedInfos[maxFusedFunctions * NUM_ROUNDINGMODES];
+static void
+	(*fusedTrueFunctions[maxFusedFunctions * NUM_ROUNDINGMODES])();
+static void
+	(*fusedSubjFunctions[maxFusedFunctions * NUM_ROUNDINGMODES])();
+
+static int fusedKindOf(int functionCode, void (**trueFunctionPtr)())
+{
+
+	switch (functionCode) {
+	case F32_ADD:
+		*trueFunctionPtr = (void (*)())f32_add;
+		return FUSED_ABZ_F32;
+	case F32_SUB:
+		*trueFunctionPtr = (void (*)())f32_sub;
+		return FUSED_ABZ_F32;
+	case F32_MUL:
+		*trueFunctionPtr = (void (*)())f32_mul;
+		return FUSED_ABZ_F32;
+	case F32_DIV:
+		*trueFunctionPtr = (void (*)())f32_div;
+		return FUSED_ABZ_F32;
+	case F32_REM:
+		*trueFunctionPtr = (void (*)())f32_rem;
+		return FUSED_ABZ_F32;
+	case F32_EQ:
+		*trueFunctionPtr = (void (*)())f32_eq;
+		return FUSED_AB_F32_Z_BOOL;
+	case F32_LE:
+		*trueFunctionPtr = (void (*)())f32_le;
+		return FUSED_AB_F32_Z_BOOL;
+	case F32_LT:
+		*trueFunctionPtr = (void (*)())f32_lt;
+		return FUSED_AB_F32_Z_BOOL;
+	case F32_EQ_SIGNALING:
+		*trueFunctionPtr = (void (*)())f32_eq_signaling;
+		return FUSED_AB_F32_Z_BOOL;
+	case F32_LE_QUIET:
+		*trueFunctionPtr = (void (*)())f32_le_quiet;
+		return FUSED_AB_F32_Z_BOOL;
+	case F32_LT_QUIET:
+		*trueFunctionPtr = (void (*)())f32_lt_quiet;
+		return FUSED_AB_F32_Z_BOOL;
+	case F32_SQRT:
+		*trueFunctionPtr = (void (*)())f32_sqrt;
+		return FUSED_AZ_F32;
+	case F32_MULADD:
+		*trueFunctionPtr = (void (*)())f32_mulAdd;
+		return FUSED_ABCZ_F32;
+	case F32_ROUNDTOINT:
+		*trueFunctionPtr = (void (*)())f32_roundToInt;
+		return FUSED_AZ_F32_RX;
+	case F32_TO_UI32:
+		*trueFunctionPtr = (void (*)())f32_to_ui32;
+		return FUSED_A_F32_Z_UI32_RX;
+	case F32_TO_UI64:
+		*trueFunctionPtr = (void (*)())f32_to_ui64;
+		return FUSED_A_F32_Z_UI64_RX;
+	case F32_TO_I32:
+		*trueFunctionPtr = (void (*)())f32_to_i32;
+		return FUSED_A_F32_Z_I32_RX;
+	case F32_TO_I64:
+		*trueFunctionPtr = (void (*)())f32_to_i64;
+		return FUSED_A_F32_Z_I64_RX;
+#ifdef FLOAT64
+	case F64_ADD:
+		*trueFunctionPtr = (void (*)())f64_add;
+		return FUSED_ABZ_F64;
+	case F64_SUB:
+		*trueFunctionPtr = (void (*)())f64_sub;
+		return FUSED_ABZ_F64;
+	case F64_MUL:
+		*trueFunctionPtr = (void (*)())f64_mul;
+		return FUSED_ABZ_F64;
+	case F64_DIV:
+		*trueFunctionPtr = (void (*)())f64_div;
+		return FUSED_ABZ_F64;
+	case F64_REM:
+		*trueFunctionPtr = (void (*)())f64_rem;
+		return FUSED_ABZ_F64;
+	case F64_EQ:
+		*trueFunctionPtr = (void (*)())f64_eq;
+		return FUSED_AB_F64_Z_BOOL;
+	case F64_LE:
+		*trueFunctionPtr = (void (*)())f64_le;
+		return FUSED_AB_F64_Z_BOOL;
+	case F64_LT:
+		*trueFunctionPtr = (void (*)())f64_lt;
+		return FUSED_AB_F64_Z_BOOL;
+	case F64_EQ_SIGNALING:
+		*trueFunctionPtr = (void (*)())f64_eq_signaling;
+		return FUSED_AB_F64_Z_BOOL;
+	case F64_LE_QUIET:
+		*trueFunctionPtr = (void (*)())f64_le_quiet;
+		return FUSED_AB_F64_Z_BOOL;
+	case F64_LT_QUIET:
+		*trueFunctionPtr = (void (*)())f64_lt_quiet;
+		return FUSED_AB_F64_Z_BOOL;
+	case F64_SQRT:
+		*trueFunctionPtr = (void (*)())f64_sqrt;
+		return FUSED_AZ_F64;
+	case F64_MULADD:
+		*trueFunctionPtr = (void (*)())f64_mulAdd;
+		return FUSED_ABCZ_F64;
+	case F64_ROUNDTOINT:
+		*trueFunctionPtr = (void (*)())f64_roundToInt;
+		return FUSED_AZ_F64_RX;
+	case F64_TO_UI32:
+		*trueFunctionPtr = (void (*)())f64_to_ui32;
+		return FUSED_A_F64_Z_UI32_RX;
+	case F64_TO_UI64:
+		*trueFunctionPtr = (void (*)())f64_to_ui64;
+		return FUSED_A_F64_Z_UI64_RX;
+	case F64_TO_I32:
+		*trueFunctionPtr = (void (*)())f64_to_i32;
+		return FUSED_A_F64_Z_I32_RX;
+	case F64_TO_I64:
+		*trueFunctionPtr = (void (*)())f64_to_i64;
+		return FUSED_A_F64_Z_I64_RX;
+#endif
+	}
+	return FUSED_NONE;
+
+}
+
+static void runFusedTestLoop(void)
+{
+
+	switch (fusedKind) {
+	case FUSED_ABZ_F32:
+		test_abz_f32_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_abz_f32* const*)fusedTrueFunctions,
+			(funcType_abz_f32* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_AB_F32_Z_BOOL:
+		test_ab_f32_z_bool_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_ab_f32_z_bool* const*)fusedTrueFunctions,
+			(funcType_ab_f32_z_bool* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_AZ_F32:
+		test_az_f32_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_az_f32* const*)fusedTrueFunctions,
+			(funcType_az_f32* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_ABCZ_F32:
+		test_abcz_f32_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_abcz_f32* const*)fusedTrueFunctions,
+			(funcType_abcz_f32* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_AZ_F32_RX:
+		test_az_f32_rx_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_az_f32_rx* const*)fusedTrueFunctions,
+			(funcType_az_f32* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_A_F32_Z_UI32_RX:
+		test_a_f32_z_ui32_rx_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_a_f32_z_ui32_rx* const*)fusedTrueFunctions,
+			(funcType_a_f32_z_ui32* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_A_F32_Z_UI64_RX:
+		test_a_f32_z_ui64_rx_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_a_f32_z_ui64_rx* const*)fusedTrueFunctions,
+			(funcType_a_f32_z_ui64* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_A_F32_Z_I32_RX:
+		test_a_f32_z_i32_rx_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_a_f32_z_i32_rx* const*)fusedTrueFunctions,
+			(funcType_a_f32_z_i32* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_A_F32_Z_I64_RX:
+		test_a_f32_z_i64_rx_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_a_f32_z_i64_rx* const*)fusedTrueFunctions,
+			(funcType_a_f32_z_i64* const*)fusedSubjFunctions
+		);
+		break;
+#ifdef FLOAT64
+	case FUSED_ABZ_F64:
+		test_abz_f64_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_abz_f64* const*)fusedTrueFunctions,
+			(funcType_abz_f64* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_AB_F64_Z_BOOL:
+		test_ab_f64_z_bool_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_ab_f64_z_bool* const*)fusedTrueFunctions,
+			(funcType_ab_f64_z_bool* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_AZ_F64:
+		test_az_f64_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_az_f64* const*)fusedTrueFunctions,
+			(funcType_az_f64* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_ABCZ_F64:
+		test_abcz_f64_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_abcz_f64* const*)fusedTrueFunctions,
+			(funcType_abcz_f64* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_AZ_F64_RX:
+		test_az_f64_rx_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_az_f64_rx* const*)fusedTrueFunctions,
+			(funcType_az_f64* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_A_F64_Z_UI32_RX:
+		test_a_f64_z_ui32_rx_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_a_f64_z_ui32_rx* const*)fusedTrueFunctions,
+			(funcType_a_f64_z_ui32* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_A_F64_Z_UI64_RX:
+		test_a_f64_z_ui64_rx_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_a_f64_z_ui64_rx* const*)fusedTrueFunctions,
+			(funcType_a_f64_z_ui64* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_A_F64_Z_I32_RX:
+		test_a_f64_z_i32_rx_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_a_f64_z_i32_rx* const*)fusedTrueFunctions,
+			(funcType_a_f64_z_i32* const*)fusedSubjFunctions
+		);
+		break;
+	case FUSED_A_F64_Z_I64_RX:
+		test_a_f64_z_i64_rx_fused(
+			numFusedFunctions,
+			fusedInfos,
+			(funcType_a_f64_z_i64_rx* const*)fusedTrueFunctions,
+			(funcType_a_f64_z_i64* const*)fusedSubjFunctions
+		);
+		break;
+#endif
+	}
+
+}
+
+/*----------------------------------------------------------------------------
+| With `-failfast', `failFastPath' names the failure history, which is updated
+| after each function unless `saveFailures' is false, as in a `-job' child.
+| `probing' is true while a function's fail-fast probe runs.
+*----------------------------------------------------------------------------*/
+static const char* failFastPath = 0;
+static bool saveFailures = false;
+static bool probing = false;
+
+/*----------------------------------------------------------------------------
+| Entry point for each thread running all or part of one instance of a test
+| loop.  SoftFloat's rounding mode and precision and the subject's
+| floating-point environment are per-thread, so every thread establishes the
+| instance's settings itself before entering the loop.  With `-replay', the
+| thread also selects the instance's cases from the corpus; a fail-fast probe
+| tests all of its cases in every instance.
+*----------------------------------------------------------------------------*/
+static void runTestLoopThread(void* argPtr)
+{
+	const struct testLoopArgs* argsPtr = argPtr;
+
+	testLoops_trueFlagsPtr = &softfloat_exceptionFlags;
+#ifdef EXTFLOAT80
+	if (argsPtr->roundingPrecision) {
+		extF80_roundingPrecision = argsPtr->roundingPrecision;
+		subjfloat_setExtF80RoundingPrecision(argsPtr->roundingPrecision);
+	}
+#endif
+	if (argsPtr->roundingCode) {
+		softfloat_roundingMode = argsPtr->roundingMode;
+		if (!argsPtr->fixedRounding) {
+			subjfloat_setRoundingMode(argsPtr->roundingMode);
+		}
+	}
+	if (probing) {
+		corpus_selectCases(verCases_functionNamePtr, -1, -1);
+	}
+	else if (corpus_replaying) {
+		corpus_selectCases(
+			verCases_functionNamePtr,
+			argsPtr->fixedRounding ? 0 : argsPtr->roundingCode,
+			argsPtr->roundingPrecision
+		);
+	}
+	if (argsPtr->fused) {
+		runFusedTestLoop();
+	}
+	else {
+		runTestLoop(
+			argsPtr->functionCode, argsPtr->roundingMode, argsPtr->exact);
+	}
+
+}
+
+/*----------------------------------------------------------------------------
+| For `-rfuse':  turns the instances for the separate rounding modes of each
+| rounding precision into a single instance, with the fused group's entries
+| repeated for every one of those rounding modes.  Returns the new number of
+| instances.
+*----------------------------------------------------------------------------*/
+static int fuseRoundingModes(struct testLoopArgs instances[], int numInstances)
+{
+	int numModes, functionNum, modeNum, entryNum, instanceNum;
+
+	numModes = 1;
+	while (
+		(numModes < numInstances)
+		&& (instances[numModes].roundingPrecision
+			== instances[0].roundingPrecision)
+		) {
+		++numModes;
+	}
+	for (
+		functionNum = numFusedFunctions - 1; 0 <= functionNum; --functionNum
+		) {
+		for (modeNum = numModes - 1; 0 <= modeNum; --modeNum) {
+			entryNum = functionNum * numModes + modeNum;
+			fusedInfos[entryNum] = fusedInfos[functionNum];
+			fusedInfos[entryNum].roundingCode = instances[modeNum].roundingCode;
+			fusedInfos[entryNum].roundingMode = instances[modeNum].roundingMode;
+			fusedTrueFunctions[entryNum] = fusedTrueFunctions[functionNum];
+			fusedSubjFunctions[entryNum] = fusedSubjFunctions[functionNum];
+		}
+	}
+	numFusedFunctions *= numModes;
+	for (
+		instanceNum = 0;
+		instanceNum * numModes < numInstances;
+		++instanceNum
+		) {
+		instances[instanceNum] = instances[instanceNum * numModes];
+		instances[instanceNum].roundingCode = 0;
+	}
+	return instanceNum;
+
+}
+
+/*----------------------------------------------------------------------------
+| Incremented by `-soak' before each pass, so that the pass draws its random
+| cases from streams no earlier pass has used.
+*----------------------------------------------------------------------------*/
+static uint_fast64_t soakPassNum = 0;
+
+/*----------------------------------------------------------------------------
+| Sets the rounding precision and mode written after the function's name to
+| those of the instance at `argsPtr'.  Each instance is named this way before
+| it is started, for `-stats', as well as before it is finished.  The random
+| stream is also set here, from a hash of the function's name, the instance's
+| rounding and `soakPassNum', so that the instance's cases are the same
+| whatever other instances are run and however the cases are divided among
+| threads, processes or shards.
+*----------------------------------------------------------------------------*/
+static void nameInstance(const struct testLoopArgs* argsPtr, bool fixedRounding)
+{
+	const char* charPtr;
+	uint_fast64_t stream;
+
+#ifdef EXTFLOAT80
+	verCases_roundingPrecision = argsPtr->roundingPrecision;
+#endif
+	verCases_roundingCode = fixedRounding ? 0 : argsPtr->roundingCode;
+	stream = UINT64_C(0xCBF29CE484222325);
+	for (charPtr = verCases_functionNamePtr; *charPtr; ++charPtr) {
+		stream = (stream ^ (unsigned char)*charPtr) * UINT64_C(0x100000001B3);
+	}
+	stream = (stream ^ argsPtr->roundingCode) * UINT64_C(0x100000001B3);
+	stream = (stream ^ argsPtr->roundingPrecision) * UINT64_C(0x100000001B3);
+	stream = (stream ^ soakPassNum) * UINT64_C(0x100000001B3);
+	random_setStream(stream);
+
+}
+
+/*----------------------------------------------------------------------------
+| Ends the test of the function at `infoPtr', which found errors if
+| `verCases_anyErrors' is true:  with `-failfast', the test is added to the
+| failure history, unless it was stopped early without errors.  The errors of
+| earlier functions, from `anyErrors' or, after resuming from a checkpoint,
+| `testLoops_anyEarlierErrors', are then added back.
+*----------------------------------------------------------------------------*/
+static void endFunctionTest(const struct standardFunctionInfo* infoPtr, bool anyErrors)
+{
+
+	if (saveFailures && (verCases_anyErrors || !verCases_stop)) {
+		failFast_record(infoPtr->namePtr, verCases_anyErrors);
+		failFast_save(failFastPath);
+	}
+	verCases_anyErrors |= anyErrors || testLoops_anyEarlierErrors;
+
+}
+
+/*----------------------------------------------------------------------------
+| Before the full test of the function at `infoPtr', runs its fail-fast
+| probe (see `failFast.h') in each of the `numInstances' instances at
+| `instances', and stops at once if the probe finds errors.  Nothing is
+| written for a probe that passes.
+*----------------------------------------------------------------------------*/
+static
+void
+probeFunction(
+	const struct standardFunctionInfo* infoPtr,
+	struct testLoopArgs* instances,
+	int numInstances,
+	bool fixedRounding,
+	bool anyErrors
+)
+{
+	int functionAttribs, instanceNum;
+
+	functionAttribs = functionInfos[infoPtr->functionCode].attribs;
+	if (
+		!failFast_makeProbe(
+			infoPtr->namePtr,
+			(functionAttribs & FUNC_ARG_UNARY) ? 1
+				: (functionAttribs & FUNC_ARG_BINARY) ? 2 : 3
+		)
+		) {
+		return;
+	}
+	corpus_replaying = true;
+	probing = true;
+	verCases_quiet = true;
+	testLoops_startInstances(numInstances);
+	for (instanceNum = 0; instanceNum < numInstances; ++instanceNum) {
+		nameInstance(&instances[instanceNum], fixedRounding);
+		testLoops_startInstance(runTestLoopThread, &instances[instanceNum]);
+	}
+	for (instanceNum = 0; instanceNum < numInstances; ++instanceNum) {
+		nameInstance(&instances[instanceNum], fixedRounding);
+		testLoops_finishInstance();
+	}
+	verCases_quiet = false;
+	probing = false;
+	corpus_replaying = false;
+	if (verCases_anyErrors || verCases_stop) {
+		fputs("Stopped by the fail-fast probe.\n", stderr);
+		endFunctionTest(infoPtr, anyErrors);
 		verCases_exitWithStatus();
 	}
 
@@ -1373,10 +2158,21 @@ testFunction(
 	int roundingCode;
 	bool exact;
 	uint_fast8_t roundingPrecision, roundingMode;
+	struct testLoopArgs instances[3 * NUM_ROUNDINGMODES];
+	int numInstances, instanceNum;
+	bool anyErrors;
 
 	functionCode = standardFunctionInfoPtr->functionCode;
 	functionAttribs = functionInfos[functionCode].attribs;
 	standardFunctionHasFixedRounding = false;
+	if (corpus_replaying) {
+		/*--------------------------------------------------------------------
+		| A replay covers every rounding mode and precision with cases in the
+		| corpus, and nothing else.
+		*--------------------------------------------------------------------*/
+		roundingPrecisionIn = 0;
+		roundingCodeIn = 0;
+	}
 	if (functionAttribs & FUNC_ARG_ROUNDINGMODE) {
 		roundingCode = standardFunctionInfoPtr->roundingCode;
 		if (roundingCode) {
@@ -1387,6 +2183,8 @@ testFunction(
 	exact = standardFunctionInfoPtr->exact;
 	verCases_functionNamePtr = standardFunctionInfoPtr->namePtr;
 	roundingPrecision = 32;
+	roundingMode = softfloat_round_near_even;
+	numInstances = 0;
 	for (;;) {
 		if (functionAttribs & FUNC_EFF_ROUNDINGPRECISION) {
 			if (roundingPrecisionIn) roundingPrecision = roundingPrecisionIn;
@@ -1394,13 +2192,6 @@ testFunction(
 		else {
 			roundingPrecision = 0;
 		}
-#ifdef EXTFLOAT80
-		verCases_roundingPrecision = roundingPrecision;
-		if (roundingPrecision) {
-			extF80_roundingPrecision = roundingPrecision;
-			subjfloat_setExtF80RoundingPrecision(roundingPrecision);
-		}
-#endif
 		for (
 			roundingCode = 1; roundingCode < NUM_ROUNDINGMODES; ++roundingCode
 			) {
@@ -1419,16 +2210,25 @@ testFunction(
 					else {
 						roundingCode = 0;
 					}
-					verCases_roundingCode =
-						standardFunctionHasFixedRounding ? 0 : roundingCode;
-					if (roundingCode) {
-						roundingMode = roundingModes[roundingCode];
-						softfloat_roundingMode = roundingMode;
-						if (!standardFunctionHasFixedRounding) {
-							subjfloat_setRoundingMode(roundingMode);
-						}
+					if (roundingCode) roundingMode = roundingModes[roundingCode];
+					instances[numInstances].functionCode = functionCode;
+					instances[numInstances].roundingPrecision =
+						roundingPrecision;
+					instances[numInstances].roundingCode = roundingCode;
+					instances[numInstances].roundingMode = roundingMode;
+					instances[numInstances].fixedRounding =
+						standardFunctionHasFixedRounding;
+					instances[numInstances].exact = exact;
+					instances[numInstances].fused = (numFusedFunctions != 0);
+					if (
+						!corpus_replaying
+						|| corpus_numCases(
+							standardFunctionInfoPtr->namePtr,
+							standardFunctionHasFixedRounding ? 0 : roundingCode,
+							roundingPrecision)
+						) {
+						++numInstances;
 					}
-					testFunctionInstance(functionCode, roundingMode, exact);
 					if (roundingCodeIn || !roundingCode) break;
 #if defined FLOAT_ROUND_ODD && ! defined SUBJFLOAT_ROUND_NEAR_MAXMAG
 				}
@@ -1448,7 +2248,1080 @@ testFunction(
 			roundingPrecision = 64;
 		}
 	}
-
+	if (
+		rfuse && numFusedFunctions && !standardFunctionHasFixedRounding
+		&& instances[0].roundingCode
+		) {
+		numInstances = fuseRoundingModes(instances, numInstances);
+	}
+	anyErrors = verCases_anyErrors;
+	verCases_anyErrors = false;
+	testLoops_anyEarlierErrors = anyErrors;
+	if (failFastPath && verCases_errorStop && numInstances) {
+		probeFunction(
+			standardFunctionInfoPtr,
+			instances,
+			numInstances,
+			standardFunctionHasFixedRounding,
+			anyErrors
+		);
+	}
+	/*------------------------------------------------------------------------
+	| All rounding modes and precisions are started before any is finished, so
+	| that with multiple threads they run concurrently.  Output still appears
+	| one instance at a time, in the usual order.
+	*------------------------------------------------------------------------*/
+	testLoops_startInstances(numInstances);
+	for (instanceNum = 0; instanceNum < numInstances; ++instanceNum) {
+		nameInstance(&instances[instanceNum], standardFunctionHasFixedRounding);
+		testLoops_startInstance(runTestLoopThread, &instances[instanceNum]);
+	}
+	for (instanceNum = 0; instanceNum < numInstances; ++instanceNum) {
+		nameInstance(&instances[instanceNum], standardFunctionHasFixedRounding);
+		if (
+			!numFusedFunctions && !verCases_quiet
+			&& !testLoops_skippingInstance()
+			) {
+			fputs("Testing ", stderr);
+			verCases_writeFunctionName(stderr);
+			fputs(".\n", stderr);
+		}
+		testLoops_finishInstance();
+		if ((verCases_errorStop && verCases_anyErrors) || verCases_stop) {
+			endFunctionTest(standardFunctionInfoPtr, anyErrors);
+			verCases_exitWithStatus();
+		}
+	}
+	endFunctionTest(standardFunctionInfoPtr, anyErrors);
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns the rounding mode code fixed by the name of the function at
+| `infoPtr', or zero if there is none.
+*----------------------------------------------------------------------------*/
+static int fixedRoundingCode(const struct standardFunctionInfo* infoPtr)
+{
+
+	return
+		(functionInfos[infoPtr->functionCode].attribs & FUNC_ARG_ROUNDINGMODE)
+			? infoPtr->roundingCode : 0;
+
+}
+
+/*----------------------------------------------------------------------------
+| Tests, in one fused pass, the function at `standardFunctionInfoPtr' along
+| with every later function that is not yet tested and can share the pass:
+| with `-fuse', any function of the same form affected by the same rounding
+| settings; with only `-rfuse', the same function in another fixed rounding
+| mode.
+*----------------------------------------------------------------------------*/
+static
+void
+testFusedFunctions(
+	const struct standardFunctionInfo* standardFunctionInfoPtr,
+	void (* const* subjFunctionPtrPtr)(),
+	uint_fast8_t roundingPrecisionIn,
+	int roundingCodeIn
+)
+{
+	const struct standardFunctionInfo* infoPtr;
+	int functionCode, attribs, roundingCode;
+	bool fixedRounding;
+	void (*trueFunction)();
+
+	fusedKind =
+		fusedKindOf(standardFunctionInfoPtr->functionCode, &trueFunction);
+	attribs =
+		functionInfos[standardFunctionInfoPtr->functionCode].attribs
+			& fusedAttribsMask;
+	fixedRounding = (fixedRoundingCode(standardFunctionInfoPtr) != 0);
+	numFusedFunctions = 0;
+	for (
+		infoPtr = standardFunctionInfoPtr;
+		infoPtr->namePtr && (numFusedFunctions < maxFusedFunctions);
+		++infoPtr, ++subjFunctionPtrPtr
+		) {
+		functionCode = infoPtr->functionCode;
+		roundingCode = fixedRoundingCode(infoPtr);
+		if (
+			*subjFunctionPtrPtr
+			&& !fusedTested[infoPtr - standardFunctionInfos]
+			&& (fusedKindOf(functionCode, &trueFunction) == fusedKind)
+			&& ((roundingCode != 0) == fixedRounding)
+			&& (fuse
+				? ((functionInfos[functionCode].attribs & fusedAttribsMask)
+					== attribs)
+				: ((functionCode == standardFunctionInfoPtr->functionCode)
+					&& (infoPtr->exact == standardFunctionInfoPtr->exact)))
+			) {
+			fusedTested[infoPtr - standardFunctionInfos] = true;
+			fusedInfos[numFusedFunctions].namePtr = infoPtr->namePtr;
+			fusedInfos[numFusedFunctions].roundingCode = roundingCode;
+			fusedInfos[numFusedFunctions].roundingMode =
+				roundingModes[roundingCode];
+			fusedInfos[numFusedFunctions].fixedRounding = fixedRounding;
+			fusedInfos[numFusedFunctions].exact = infoPtr->exact;
+			fusedTrueFunctions[numFusedFunctions] = trueFunction;
+			fusedSubjFunctions[numFusedFunctions] = *subjFunctionPtrPtr;
+			++numFusedFunctions;
+		}
+	}
+	testFunction(standardFunctionInfoPtr, roundingPrecisionIn, roundingCodeIn);
+	numFusedFunctions = 0;
+
+}
+
+/*----------------------------------------------------------------------------
+| With option `-processes', every test is run as a separate job in a child
+| process (this same program, given option `-job'), so that a crash in the
+| subject functions ends only that job.  A job is one function in one
+| rounding mode and rounding precision.  Each job's output is collected in
+| temporary files and copied out in job order once the job is finished.
+|   Jobs are started longest first, by an estimated cost of the number of
+| cases times the time per case from the history named by `-history', so
+| that the last jobs to finish are short ones.
+|   With option `-shard', only one share of the jobs is run, and with
+| `-partial' each finished job is written to a partial result file instead of
+| being reported, so that the shares can be run on different machines and
+| combined by `-merge'.  `fullJobNum' is a job's number among all jobs.
+*----------------------------------------------------------------------------*/
+struct job {
+	int fullJobNum;
+	int standardFunctionNum;
+	int roundingCode;
+	uint_fast8_t roundingPrecision;
+	uint_fast64_t numCases;
+	double cost;
+	double startTime;
+	double seconds;
+	FILE* outFile;
+	FILE* errFile;
+	bool started;
+	bool done;
+	bool crashed;
+	int status;
+	double failScore;
+};
+
+static const char* historyPath = 0;
+static const char* corpusPath = 0;
+static const char* statsName = 0;
+static int shardNum = 0;
+static int numShards = 0;
+static const char* partialPath = 0;
+static FILE* partialFile;
+
+static const char partialMagic[] = "TFPART1";
+
+static const struct {
+	const char* typeNamePtr;
+	void (*initFunctions[3])(void);
+} genCasesInits[] = {
+	{ "ui32", { genCases_ui32_a_init } },
+	{ "ui64", { genCases_ui64_a_init } },
+	{ "i32", { genCases_i32_a_init } },
+	{ "i64", { genCases_i64_a_init } },
+#ifdef FLOAT16
+	{ "f16", { genCases_f16_a_init, genCases_f16_ab_init, genCases_f16_abc_init } },
+#endif
+	{ "bf16", { genCases_bf16_a_init, genCases_bf16_ab_init, genCases_bf16_abc_init } },
+	{ "f32", { genCases_f32_a_init, genCases_f32_ab_init, genCases_f32_abc_init } },
+#ifdef FLOAT64
+	{ "f64", { genCases_f64_a_init, genCases_f64_ab_init, genCases_f64_abc_init } },
+#endif
+#ifdef EXTFLOAT80
+	{ "extF80", { genCases_extF80_a_init, genCases_extF80_ab_init, genCases_extF80_abc_init } },
+#endif
+#ifdef FLOAT128
+	{ "f128", { genCases_f128_a_init, genCases_f128_ab_init, genCases_f128_abc_init } },
+#endif
+	{ 0 }
+};
+
+/*----------------------------------------------------------------------------
+| Returns the number of cases tested for the function with `functionCode', as
+| found by starting its case generator:  the operand type is the start of the
+| function's name, and the number of operands follows from its attributes.
+*----------------------------------------------------------------------------*/
+static uint_fast64_t functionNumCases(int functionCode)
+{
+	const char* namePtr;
+	size_t typeNameLength;
+	int functionAttribs, i;
+
+	namePtr = functionInfos[functionCode].namePtr;
+	typeNameLength = strcspn(namePtr, "_");
+	functionAttribs = functionInfos[functionCode].attribs;
+	for (i = 0; genCasesInits[i].typeNamePtr; ++i) {
+		if (
+			(strlen(genCasesInits[i].typeNamePtr) == typeNameLength)
+			&& !strncmp(genCasesInits[i].typeNamePtr, namePtr, typeNameLength)
+			) {
+			genCasesInits[i].initFunctions[
+				(functionAttribs & FUNC_ARG_UNARY) ? 0
+					: (functionAttribs & FUNC_ARG_BINARY) ? 1 : 2
+			]();
+			return genCases_total;
+		}
+	}
+	return 0;
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns true if the function at `infoPtr' can be tested with `-exhaustive',
+| that is, if it takes a single 32-bit operand or two 16-bit operands, for
+| which the case generators can give every value.
+*----------------------------------------------------------------------------*/
+static bool exhaustiveApplies(const struct standardFunctionInfo* infoPtr)
+{
+	const char* namePtr;
+	int functionAttribs;
+
+	namePtr = infoPtr->namePtr;
+	functionAttribs = functionInfos[infoPtr->functionCode].attribs;
+	if (functionAttribs & FUNC_ARG_UNARY) {
+		return
+			!strncmp(namePtr, "ui32_", 5) || !strncmp(namePtr, "i32_", 4)
+			|| !strncmp(namePtr, "f32_", 4);
+	}
+	if (functionAttribs & FUNC_ARG_BINARY) {
+		return !strncmp(namePtr, "f16_", 4) || !strncmp(namePtr, "bf16_", 5);
+	}
+	return false;
+
+}
+
+static int compareJobCosts(const void* aPtr, const void* bPtr)
+{
+	const struct job* jobAPtr = *(const struct job* const*)aPtr;
+	const struct job* jobBPtr = *(const struct job* const*)bPtr;
+
+	if (jobAPtr->failScore != jobBPtr->failScore) {
+		return (jobAPtr->failScore < jobBPtr->failScore) ? 1 : -1;
+	}
+	if (jobAPtr->cost != jobBPtr->cost) {
+		return (jobAPtr->cost < jobBPtr->cost) ? 1 : -1;
+	}
+	return (jobAPtr < jobBPtr) ? -1 : 1;
+
+}
+
+/*----------------------------------------------------------------------------
+| With `-failfast', jobs are reported, as well as started, in order of their
+| functions' failure scores, highest first.
+*----------------------------------------------------------------------------*/
+static int compareJobFailScores(const void* aPtr, const void* bPtr)
+{
+	const struct job* jobAPtr = aPtr;
+	const struct job* jobBPtr = bPtr;
+
+	if (jobAPtr->failScore != jobBPtr->failScore) {
+		return (jobAPtr->failScore < jobBPtr->failScore) ? 1 : -1;
+	}
+	return jobAPtr->fullJobNum - jobBPtr->fullJobNum;
+
+}
+
+static int compareJobNumCases(const void* aPtr, const void* bPtr)
+{
+	const struct job* jobAPtr = *(const struct job* const*)aPtr;
+	const struct job* jobBPtr = *(const struct job* const*)bPtr;
+
+	if (jobAPtr->numCases != jobBPtr->numCases) {
+		return (jobAPtr->numCases < jobBPtr->numCases) ? 1 : -1;
+	}
+	return (jobAPtr < jobBPtr) ? -1 : 1;
+
+}
+
+/*----------------------------------------------------------------------------
+| Deals the `numJobs' jobs at `jobs' out to `numShards' shards, most cases
+| first, each to the shard with the fewest cases so far.  The deal depends
+| only on the jobs, so every shard makes the same one.  The jobs of shard
+| `shardNum' are moved to the start of `jobs', in their original order, and
+| their number is returned.
+*----------------------------------------------------------------------------*/
+static int selectShardJobs(struct job* jobs, int numJobs)
+{
+	struct job** dealOrder;
+	uint_fast64_t* shardNumCases;
+	int* jobShardNums;
+	int i, shard, leastShard, numShardJobs;
+
+	dealOrder = malloc((numJobs + 1) * sizeof *dealOrder);
+	shardNumCases = calloc(numShards, sizeof *shardNumCases);
+	jobShardNums = malloc((numJobs + 1) * sizeof *jobShardNums);
+	if (!dealOrder || !shardNumCases || !jobShardNums) fail("Out of memory");
+	for (i = 0; i < numJobs; ++i) dealOrder[i] = &jobs[i];
+	qsort(dealOrder, numJobs, sizeof *dealOrder, compareJobNumCases);
+	for (i = 0; i < numJobs; ++i) {
+		leastShard = 0;
+		for (shard = 1; shard < numShards; ++shard) {
+			if (shardNumCases[shard] < shardNumCases[leastShard]) {
+				leastShard = shard;
+			}
+		}
+		shardNumCases[leastShard] += dealOrder[i]->numCases;
+		jobShardNums[dealOrder[i] - jobs] = leastShard;
+	}
+	numShardJobs = 0;
+	for (i = 0; i < numJobs; ++i) {
+		if (jobShardNums[i] == shardNum) jobs[numShardJobs++] = jobs[i];
+	}
+	free(jobShardNums);
+	free(shardNumCases);
+	free(dealOrder);
+	return numShardJobs;
+
+}
+
+static bool subjHasRoundingMode(int roundingCode)
+{
+
+#ifndef SUBJFLOAT_ROUND_NEAR_MAXMAG
+	if (roundingCode == ROUND_NEAR_MAXMAG) return false;
+#endif
+#if defined FLOAT_ROUND_ODD && ! defined SUBJFLOAT_ROUND_NEAR_MAXMAG
+	if (roundingCode == ROUND_ODD) return false;
+#endif
+	return true;
+
+}
+
+/*----------------------------------------------------------------------------
+| Adds to `*jobsPtr' the jobs for every function with a subject function, in
+| the order `testFunction' would test them, and returns the number of jobs.
+*----------------------------------------------------------------------------*/
+static
+int
+collectJobs(
+	struct job** jobsPtr, uint_fast8_t roundingPrecisionIn, int roundingCodeIn)
+{
+	struct job* jobs;
+	int numJobs, maxJobs, standardFunctionNum, functionAttribs;
+	int roundingCode;
+	uint_fast8_t roundingPrecision;
+
+	jobs = 0;
+	numJobs = 0;
+	maxJobs = 0;
+	for (
+		standardFunctionNum = 0;
+		standardFunctionInfos[standardFunctionNum].namePtr;
+		++standardFunctionNum
+		) {
+		if (!functionRegistry_subjFunctions[standardFunctionNum]) continue;
+		functionAttribs =
+			functionInfos[standardFunctionInfos[standardFunctionNum].functionCode]
+				.attribs;
+		roundingPrecision = 0;
+		if (functionAttribs & FUNC_EFF_ROUNDINGPRECISION) {
+			roundingPrecision =
+				roundingPrecisionIn ? roundingPrecisionIn : 32;
+		}
+		for (;;) {
+			for (roundingCode = 0; roundingCode < NUM_ROUNDINGMODES; ++roundingCode) {
+				if (
+					fixedRoundingCode(&standardFunctionInfos[standardFunctionNum])
+					|| !(functionAttribs
+						& (FUNC_ARG_ROUNDINGMODE | FUNC_EFF_ROUNDINGMODE))
+					) {
+					if (roundingCode) break;
+				}
+				else if (
+					!roundingCode
+					|| (roundingCodeIn && (roundingCode != roundingCodeIn))
+					|| !subjHasRoundingMode(roundingCode)
+					) {
+					continue;
+				}
+				if (numJobs == maxJobs) {
+					maxJobs = maxJobs ? 2 * maxJobs : 256;
+					jobs = realloc(jobs, maxJobs * sizeof *jobs);
+					if (!jobs) fail("Out of memory");
+				}
+				jobs[numJobs].fullJobNum = numJobs;
+				jobs[numJobs].standardFunctionNum = standardFunctionNum;
+				jobs[numJobs].roundingCode = roundingCode;
+				jobs[numJobs].roundingPrecision = roundingPrecision;
+				jobs[numJobs].numCases =
+					functionNumCases(
+						standardFunctionInfos[standardFunctionNum].functionCode);
+				jobs[numJobs].cost =
+					jobs[numJobs].numCases
+						* jobCosts_nsPerCase(
+							standardFunctionInfos[standardFunctionNum].namePtr);
+				jobs[numJobs].failScore =
+					failFastPath
+						? failFast_score(
+							standardFunctionInfos[standardFunctionNum].namePtr)
+						: 0;
+				jobs[numJobs].started = false;
+				jobs[numJobs].done = false;
+				++numJobs;
+			}
+			if (roundingPrecisionIn || !roundingPrecision) break;
+			if (roundingPrecision == 80) break;
+			roundingPrecision = (roundingPrecision == 32) ? 64 : 80;
+		}
+	}
+	*jobsPtr = jobs;
+	return numJobs;
+
+}
+
+static void writeJobName(const struct job* jobPtr, FILE* streamPtr)
+{
+
+	verCases_functionNamePtr =
+		standardFunctionInfos[jobPtr->standardFunctionNum].namePtr;
+	verCases_roundingPrecision = jobPtr->roundingPrecision;
+	verCases_roundingCode = jobPtr->roundingCode;
+	verCases_writeFunctionName(streamPtr);
+
+}
+
+static void copyJobOutput(FILE* filePtr, FILE* streamPtr)
+{
+	char buffer[4096];
+	size_t size;
+
+	rewind(filePtr);
+	while ((size = fread(buffer, 1, sizeof buffer, filePtr))) {
+		fwrite(buffer, 1, size, streamPtr);
+	}
+	fclose(filePtr);
+
+}
+
+/*----------------------------------------------------------------------------
+| Writes what is reported about a finished job after its output:  whether it
+| crashed or hung.  Any failure is noted in `verCases_anyErrors', and crashes
+| and hangs are counted at `numCrashesPtr' and `numHangsPtr'.
+*----------------------------------------------------------------------------*/
+static
+void
+writeJobEnd(const struct job* jobPtr, int* numCrashesPtr, int* numHangsPtr)
+{
+
+	if (jobPtr->crashed) {
+		++*numCrashesPtr;
+		fputs("Crashed while testing ", stdout);
+		writeJobName(jobPtr, stdout);
+		printf(" (code 0x%X).\n", (unsigned int)jobPtr->status);
+		verCases_anyErrors = true;
+	}
+	else if (jobPtr->status == testLoops_hangExitStatus) {
+		++*numHangsPtr;
+		fputs("Hung while testing ", stdout);
+		writeJobName(jobPtr, stdout);
+		fputs(".\n", stdout);
+		verCases_anyErrors = true;
+	}
+	else if (jobPtr->status) {
+		verCases_anyErrors = true;
+	}
+	fflush(stdout);
+
+}
+
+static void writeJobTotals(int numCrashes, int numHangs)
+{
+
+	if (numCrashes) {
+		printf("%d job(s) crashed.\n", numCrashes);
+	}
+	if (numHangs) {
+		printf("%d job(s) hung.\n", numHangs);
+	}
+
+}
+
+/*----------------------------------------------------------------------------
+| A partial result file starts with a line giving `partialMagic', the shard
+| number and count, the testing level, the random seed and the total number
+| of jobs.  Each finished job follows as a line giving its full job number,
+| function number and name, rounding mode and precision, number of cases,
+| exit status, whether it crashed, the seconds it took, and the sizes of its
+| standard error and standard output, which follow the line as they are.
+*----------------------------------------------------------------------------*/
+static void writePartialHeader(int numFullJobs)
+{
+
+	partialFile = fopen(partialPath, "wb");
+	if (!partialFile) fail("Cannot write '%s'", partialPath);
+	fprintf(
+		partialFile,
+		"%s %d %d %d %llu %d\n",
+		partialMagic,
+		shardNum,
+		numShards,
+		genCases_level,
+		(unsigned long long)random_getSeed(),
+		numFullJobs
+	);
+
+}
+
+static long jobOutputSize(FILE* filePtr)
+{
+
+	fseek(filePtr, 0, SEEK_END);
+	return ftell(filePtr);
+
+}
+
+static void writePartialJob(const struct job* jobPtr)
+{
+
+	fprintf(
+		partialFile,
+		"%d %d %s %d %d %llu %d %d %.6f %ld %ld\n",
+		jobPtr->fullJobNum,
+		jobPtr->standardFunctionNum,
+		standardFunctionInfos[jobPtr->standardFunctionNum].namePtr,
+		jobPtr->roundingCode,
+		(int)jobPtr->roundingPrecision,
+		(unsigned long long)jobPtr->numCases,
+		jobPtr->status,
+		(int)jobPtr->crashed,
+		jobPtr->seconds,
+		jobOutputSize(jobPtr->errFile),
+		jobOutputSize(jobPtr->outFile)
+	);
+	copyJobOutput(jobPtr->errFile, partialFile);
+	copyJobOutput(jobPtr->outFile, partialFile);
+	fflush(partialFile);
+
+}
+
+/*----------------------------------------------------------------------------
+| Runs all jobs on `numProcesses' child processes started from
+| `programPath'.  A job that crashes, or hangs past the `-watchdog' time, is
+| reported and the run goes on; a job that finds errors stops the run when
+| `verCases_errorStop' is true, as testing in one process would.
+*----------------------------------------------------------------------------*/
+static
+void
+runJobs(
+	const char* programPath,
+	int numProcesses,
+	uint_fast8_t roundingPrecisionIn,
+	int roundingCodeIn
+)
+{
+	struct job* jobs;
+	struct job** startOrder;
+	int numJobs, endJobNum, nextStartNum, nextOutputJobNum, numRunning, i;
+	int numFullJobs, jobNum, numCrashes, numHangs, status, numArgs;
+	bool crashed;
+	struct subprocess* subprocesses[subprocess_maxWait];
+	int runningJobNums[subprocess_maxWait];
+	char levelArg[16], threadsArg[16], functionArg[16], roundingArg[16];
+	char precisionArg[16], seedArg[24], hangArg[32], quickArg[16];
+	const char* args[24];
+	struct job* jobPtr;
+
+	if (subprocess_maxWait < numProcesses) numProcesses = subprocess_maxWait;
+	liveStats_setState(liveStats_waiting);
+	if (historyPath) jobCosts_load(historyPath);
+	numJobs = collectJobs(&jobs, roundingPrecisionIn, roundingCodeIn);
+	numFullJobs = numJobs;
+	if (numShards) numJobs = selectShardJobs(jobs, numJobs);
+	if (partialPath) writePartialHeader(numFullJobs);
+	if (failFastPath) qsort(jobs, numJobs, sizeof *jobs, compareJobFailScores);
+	startOrder = malloc(numJobs * sizeof *startOrder);
+	if (numJobs && !startOrder) fail("Out of memory");
+	for (i = 0; i < numJobs; ++i) startOrder[i] = &jobs[i];
+	qsort(startOrder, numJobs, sizeof *startOrder, compareJobCosts);
+	sprintf(levelArg, "%d", genCases_level);
+	sprintf(threadsArg, "%d", testLoops_numThreads);
+	sprintf(seedArg, "%llu", (unsigned long long)random_getSeed());
+	args[0] = programPath;
+	args[1] = "-level";
+	args[2] = levelArg;
+	args[3] = "-threads";
+	args[4] = threadsArg;
+	args[5] = "-seed";
+	args[6] = seedArg;
+	numArgs = 7;
+	if (testLoops_hangSeconds) {
+		sprintf(hangArg, "%g", testLoops_hangSeconds);
+		args[numArgs++] = "-watchdog";
+		args[numArgs++] = hangArg;
+	}
+	if (genCases_quick) {
+		sprintf(quickArg, "%d", genCases_quick);
+		args[numArgs++] = "-quick";
+		args[numArgs++] = quickArg;
+	}
+	if (errorClasses_active) args[numArgs++] = "-classify";
+	if (genCases_exhaustive) args[numArgs++] = "-exhaustive";
+	if (statsName) {
+		args[numArgs++] = "-joinstats";
+		args[numArgs++] = statsName;
+	}
+	if (corpus_recording) {
+		args[numArgs++] = "-corpus";
+		args[numArgs++] = corpusPath;
+	}
+	if (failFastPath) {
+		args[numArgs++] = "-failfast";
+		args[numArgs++] = failFastPath;
+	}
+	args[numArgs++] = "-job";
+	args[numArgs++] = functionArg;
+	args[numArgs++] = roundingArg;
+	args[numArgs++] = precisionArg;
+	args[numArgs] = 0;
+	endJobNum = numJobs;
+	nextStartNum = 0;
+	nextOutputJobNum = 0;
+	numRunning = 0;
+	numCrashes = 0;
+	numHangs = 0;
+	while (nextOutputJobNum < endJobNum) {
+		while ((nextStartNum < numJobs) && (numRunning < numProcesses)) {
+			jobPtr = startOrder[nextStartNum];
+			++nextStartNum;
+			jobNum = jobPtr - jobs;
+			if (endJobNum <= jobNum) continue;
+			jobPtr->outFile = tmpfile();
+			jobPtr->errFile = tmpfile();
+			if (!jobPtr->outFile || !jobPtr->errFile) {
+				fail("Cannot create temporary file");
+			}
+			sprintf(functionArg, "%d", jobPtr->standardFunctionNum);
+			sprintf(roundingArg, "%d", jobPtr->roundingCode);
+			sprintf(precisionArg, "%d", (int)jobPtr->roundingPrecision);
+			jobPtr->startTime = thread_seconds();
+			subprocesses[numRunning] =
+				subprocess_start(args, jobPtr->outFile, jobPtr->errFile);
+			jobPtr->started = true;
+			runningJobNums[numRunning] = jobNum;
+			++numRunning;
+		}
+		if (jobs[nextOutputJobNum].done) {
+			jobPtr = &jobs[nextOutputJobNum];
+			if (partialFile) {
+				writePartialJob(jobPtr);
+				if (jobPtr->crashed || jobPtr->status) {
+					verCases_anyErrors = true;
+				}
+			}
+			else {
+				copyJobOutput(jobPtr->errFile, stderr);
+				copyJobOutput(jobPtr->outFile, stdout);
+				writeJobEnd(jobPtr, &numCrashes, &numHangs);
+			}
+			++nextOutputJobNum;
+			continue;
+		}
+		i = subprocess_wait(subprocesses, numRunning, &status, &crashed);
+		jobPtr = &jobs[runningJobNums[i]];
+		jobPtr->done = true;
+		jobPtr->crashed = crashed;
+		jobPtr->status = status;
+		jobPtr->seconds = thread_seconds() - jobPtr->startTime;
+		if (!crashed && !status) {
+			jobCosts_record(
+				standardFunctionInfos[jobPtr->standardFunctionNum].namePtr,
+				jobPtr->numCases,
+				jobPtr->seconds
+			);
+		}
+		if (failFastPath) {
+			failFast_record(
+				standardFunctionInfos[jobPtr->standardFunctionNum].namePtr,
+				crashed || status
+			);
+		}
+		if (
+			verCases_errorStop && !crashed && status
+			&& (status != testLoops_hangExitStatus)
+			&& (runningJobNums[i] < endJobNum)
+			) {
+			endJobNum = runningJobNums[i] + 1;
+		}
+		--numRunning;
+		subprocesses[i] = subprocesses[numRunning];
+		runningJobNums[i] = runningJobNums[numRunning];
+	}
+	/*------------------------------------------------------------------------
+	| Jobs still running past a stop are waited for, but not reported.
+	*------------------------------------------------------------------------*/
+	while (numRunning) {
+		i = subprocess_wait(subprocesses, numRunning, &status, &crashed);
+		jobs[runningJobNums[i]].done = true;
+		--numRunning;
+		subprocesses[i] = subprocesses[numRunning];
+		runningJobNums[i] = runningJobNums[numRunning];
+	}
+	for (i = nextOutputJobNum; i < numJobs; ++i) {
+		if (jobs[i].started) {
+			fclose(jobs[i].outFile);
+			fclose(jobs[i].errFile);
+		}
+	}
+	if (historyPath) jobCosts_save(historyPath);
+	if (failFastPath) failFast_save(failFastPath);
+	if (partialFile) {
+		if (ferror(partialFile) | fclose(partialFile)) {
+			fail("Cannot write '%s'", partialPath);
+		}
+		partialFile = 0;
+	}
+	free(startOrder);
+	free(jobs);
+	writeJobTotals(numCrashes, numHangs);
+
+}
+
+/*----------------------------------------------------------------------------
+| Where a job's output lies in one of the partial result files being merged.
+*----------------------------------------------------------------------------*/
+struct partialJob {
+	struct job job;
+	FILE* filePtr;
+	long offset;
+	long errSize, outSize;
+};
+
+static void copyPartialOutput(FILE* filePtr, long size, FILE* streamPtr)
+{
+	char buffer[4096];
+	size_t chunkSize;
+
+	while (size) {
+		chunkSize = (size < (long)sizeof buffer) ? (size_t)size : sizeof buffer;
+		if (fread(buffer, 1, chunkSize, filePtr) != chunkSize) {
+			fail("Partial result file ends too soon");
+		}
+		fwrite(buffer, 1, chunkSize, streamPtr);
+		size -= chunkSize;
+	}
+
+}
+
+/*----------------------------------------------------------------------------
+| With option `-merge', the partial result files of all shards of one run
+| are combined into the report a single run would have written, in the same
+| order and stopping at the same failing job.  The time taken per function,
+| summed over the shards, goes to standard error.
+*----------------------------------------------------------------------------*/
+static void mergePartials(int numPaths, char* paths[])
+{
+	struct partialJob* partialJobs;
+	struct partialJob* partialJobPtr;
+	bool* shardsSeen;
+	FILE** files;
+	FILE* filePtr;
+	int numFullJobs, fileNum, fileShardNum, fileNumShards, level, numJobs;
+	int fullJobNum, standardFunctionNum, roundingCode, roundingPrecision;
+	int status, crashed, shard, jobNum, endJobNum, numCrashes, numHangs;
+	int numStandardFunctions;
+	unsigned long long seed, fileSeed, numCases;
+	double seconds, functionSeconds;
+	long errSize, outSize;
+	char magic[sizeof partialMagic], name[64];
+	uint_fast64_t functionNumCases;
+
+	for (
+		numStandardFunctions = 0;
+		standardFunctionInfos[numStandardFunctions].namePtr;
+		++numStandardFunctions
+		);
+	partialJobs = 0;
+	shardsSeen = 0;
+	numFullJobs = 0;
+	seed = 0;
+	files = malloc(numPaths * sizeof *files);
+	if (!files) fail("Out of memory");
+	for (fileNum = 0; fileNum < numPaths; ++fileNum) {
+		filePtr = fopen(paths[fileNum], "rb");
+		if (!filePtr) fail("Cannot read '%s'", paths[fileNum]);
+		files[fileNum] = filePtr;
+		if (
+			(fscanf(
+				filePtr,
+				"%7s %d %d %d %llu %d",
+				magic,
+				&fileShardNum,
+				&fileNumShards,
+				&level,
+				&fileSeed,
+				&numJobs
+			) != 6)
+			|| strcmp(magic, partialMagic)
+			|| (fileShardNum < 0) || (fileNumShards <= fileShardNum)
+			|| (numJobs < 0)
+			) {
+			fail("'%s' is not a partial result file", paths[fileNum]);
+		}
+		if (!fileNum) {
+			numShards = fileNumShards;
+			genCases_setLevel(level);
+			seed = fileSeed;
+			numFullJobs = numJobs;
+			partialJobs = calloc(numFullJobs + 1, sizeof *partialJobs);
+			shardsSeen = calloc(numShards, sizeof *shardsSeen);
+			if (!partialJobs || !shardsSeen) fail("Out of memory");
+		}
+		else if (
+			(fileNumShards != numShards) || (level != genCases_level)
+			|| (fileSeed != seed) || (numJobs != numFullJobs)
+			) {
+			fail("'%s' is from a different run", paths[fileNum]);
+		}
+		if (shardsSeen[fileShardNum]) {
+			fail("Shard %d is given twice", fileShardNum + 1);
+		}
+		shardsSeen[fileShardNum] = true;
+		while (
+			fscanf(
+				filePtr,
+				"%d %d %63s %d %d %llu %d %d %lf %ld %ld",
+				&fullJobNum,
+				&standardFunctionNum,
+				name,
+				&roundingCode,
+				&roundingPrecision,
+				&numCases,
+				&status,
+				&crashed,
+				&seconds,
+				&errSize,
+				&outSize
+			) == 11
+			) {
+			if (
+				(fullJobNum < 0) || (numFullJobs <= fullJobNum)
+				|| (standardFunctionNum < 0)
+				|| (numStandardFunctions <= standardFunctionNum)
+				|| strcmp(
+					name, standardFunctionInfos[standardFunctionNum].namePtr)
+				|| (fgetc(filePtr) != '\n')
+				) {
+				fail("'%s' does not match this program", paths[fileNum]);
+			}
+			partialJobPtr = &partialJobs[fullJobNum];
+			if (partialJobPtr->filePtr) {
+				fail("Job %d is given twice", fullJobNum);
+			}
+			partialJobPtr->job.fullJobNum = fullJobNum;
+			partialJobPtr->job.standardFunctionNum = standardFunctionNum;
+			partialJobPtr->job.roundingCode = roundingCode;
+			partialJobPtr->job.roundingPrecision = roundingPrecision;
+			partialJobPtr->job.numCases = numCases;
+			partialJobPtr->job.status = status;
+			partialJobPtr->job.crashed = crashed;
+			partialJobPtr->job.seconds = seconds;
+			partialJobPtr->filePtr = filePtr;
+			partialJobPtr->offset = ftell(filePtr);
+			partialJobPtr->errSize = errSize;
+			partialJobPtr->outSize = outSize;
+			fseek(filePtr, errSize + outSize, SEEK_CUR);
+		}
+		if (!feof(filePtr)) {
+			fail("'%s' is damaged", paths[fileNum]);
+		}
+	}
+	for (shard = 0; shard < numShards; ++shard) {
+		if (!shardsSeen[shard]) fail("Shard %d is missing", shard + 1);
+	}
+	/*------------------------------------------------------------------------
+	| A shard stops at its first failing job when `verCases_errorStop' is
+	| true, so jobs may be missing only after the first failing job overall.
+	*------------------------------------------------------------------------*/
+	endJobNum = numFullJobs;
+	numCrashes = 0;
+	numHangs = 0;
+	for (jobNum = 0; jobNum < endJobNum; ++jobNum) {
+		partialJobPtr = &partialJobs[jobNum];
+		if (!partialJobPtr->filePtr) fail("Job %d is missing", jobNum);
+		fseek(partialJobPtr->filePtr, partialJobPtr->offset, SEEK_SET);
+		copyPartialOutput(
+			partialJobPtr->filePtr, partialJobPtr->errSize, stderr);
+		copyPartialOutput(
+			partialJobPtr->filePtr, partialJobPtr->outSize, stdout);
+		writeJobEnd(&partialJobPtr->job, &numCrashes, &numHangs);
+		if (
+			verCases_errorStop && !partialJobPtr->job.crashed
+			&& partialJobPtr->job.status
+			&& (partialJobPtr->job.status != testLoops_hangExitStatus)
+			) {
+			endJobNum = jobNum + 1;
+		}
+	}
+	writeJobTotals(numCrashes, numHangs);
+	/*------------------------------------------------------------------------
+	| The jobs of one function are consecutive.
+	*------------------------------------------------------------------------*/
+	functionNumCases = 0;
+	functionSeconds = 0;
+	for (jobNum = 0; jobNum < endJobNum; ++jobNum) {
+		partialJobPtr = &partialJobs[jobNum];
+		if (!partialJobPtr->job.crashed && !partialJobPtr->job.status) {
+			functionNumCases += partialJobPtr->job.numCases;
+			functionSeconds += partialJobPtr->job.seconds;
+		}
+		if (
+			(jobNum + 1 == endJobNum)
+			|| (partialJobs[jobNum + 1].job.standardFunctionNum
+				!= partialJobPtr->job.standardFunctionNum)
+			) {
+			if (functionNumCases && (0 < functionSeconds)) {
+				fprintf(
+					stderr,
+					"%s: %llu cases in %.1f seconds, %.0f cases per second.\n",
+					standardFunctionInfos[partialJobPtr->job.standardFunctionNum]
+						.namePtr,
+					(unsigned long long)functionNumCases,
+					functionSeconds,
+					functionNumCases / functionSeconds
+				);
+			}
+			functionNumCases = 0;
+			functionSeconds = 0;
+		}
+	}
+	for (fileNum = 0; fileNum < numPaths; ++fileNum) fclose(files[fileNum]);
+	free(files);
+	free(shardsSeen);
+	free(partialJobs);
+
+}
+
+/*----------------------------------------------------------------------------
+| With option `-soak', the selected functions are tested over and over for a
+| total time, shared among them in proportion to the priorities given with
+| `-priority' (1 by default).  Each pass has its own random streams (see
+| `nameInstance'), so it tests new random cases.  Passes are started until
+| the function's share is used up, and the last is cut short at that time
+| (see `testLoops_deadline'); time a function leaves unused goes to those
+| after it.  Only errors are written during the passes, and afterward the
+| number of cases tested and the rate for each function.
+*----------------------------------------------------------------------------*/
+enum { maxPriorities = 64 };
+
+static struct {
+	const char* namePtr;
+	double priority;
+} priorities[maxPriorities];
+static int numPriorities = 0;
+
+static double functionPriority(const char* namePtr)
+{
+	int i;
+
+	for (i = 0; i < numPriorities; ++i) {
+		if (!strcmp(priorities[i].namePtr, namePtr)) {
+			return priorities[i].priority;
+		}
+	}
+	return 1;
+
+}
+
+static
+void
+soakFunctions(
+	double seconds, uint_fast8_t roundingPrecisionIn, int roundingCodeIn)
+{
+	struct job* jobs;
+	int numJobs, jobNum, endJobNum;
+	const struct standardFunctionInfo* standardFunctionInfoPtr;
+	double remainingPriority, priority, endTime, functionEndTime;
+	double startTime, now;
+	uint_fast64_t numCases, totalNumCases;
+
+	numJobs = collectJobs(&jobs, roundingPrecisionIn, roundingCodeIn);
+	remainingPriority = 0;
+	for (jobNum = 0; jobNum < numJobs; ++jobNum) {
+		if (
+			!jobNum
+			|| (jobs[jobNum].standardFunctionNum
+				!= jobs[jobNum - 1].standardFunctionNum)
+			) {
+			remainingPriority +=
+				functionPriority(
+					standardFunctionInfos[jobs[jobNum].standardFunctionNum]
+						.namePtr);
+		}
+	}
+	now = thread_seconds();
+	endTime = now + seconds;
+	totalNumCases = 0;
+	verCases_quiet = true;
+	/*------------------------------------------------------------------------
+	| The jobs of one function are consecutive, and one pass tests them all.
+	*------------------------------------------------------------------------*/
+	for (jobNum = 0; jobNum < numJobs; jobNum = endJobNum) {
+		endJobNum = jobNum + 1;
+		while (
+			(endJobNum < numJobs)
+			&& (jobs[endJobNum].standardFunctionNum
+				== jobs[jobNum].standardFunctionNum)
+			) {
+			++endJobNum;
+		}
+		standardFunctionInfoPtr =
+			&standardFunctionInfos[jobs[jobNum].standardFunctionNum];
+		priority = functionPriority(standardFunctionInfoPtr->namePtr);
+		functionEndTime =
+			now + (endTime - now) * priority / remainingPriority;
+		remainingPriority -= priority;
+		if (functionEndTime <= now) continue;
+		subjFunctionPtr =
+			functionRegistry_subjFunctions[jobs[jobNum].standardFunctionNum];
+		startTime = now;
+		testLoops_deadline = functionEndTime;
+		testLoops_numCasesRun = 0;
+		do {
+			++soakPassNum;
+			testFunction(
+				standardFunctionInfoPtr, roundingPrecisionIn, roundingCodeIn);
+			now = thread_seconds();
+		} while (now < functionEndTime);
+		testLoops_deadline = 0;
+		numCases = testLoops_numCasesRun;
+		totalNumCases += numCases;
+		printf(
+			"%s: %llu cases in %.1f seconds, %.0f cases per second.\n",
+			standardFunctionInfoPtr->namePtr,
+			(unsigned long long)numCases,
+			now - startTime,
+			numCases / (now - startTime)
+		);
+		fflush(stdout);
+	}
+	verCases_quiet = false;
+	printf(
+		"Soak testing done:  %llu cases in %.1f seconds.\n",
+		(unsigned long long)totalNumCases,
+		seconds + now - endTime
+	);
+	free(jobs);
+
+}
+
+/*----------------------------------------------------------------------------
+| With `-failfast', functions are tested in order of their failure scores,
+| highest first, and otherwise in the standard order.
+*----------------------------------------------------------------------------*/
+static int compareFunctionFailScores(const void* aPtr, const void* bPtr)
+{
+	int functionNumA = *(const int*)aPtr;
+	int functionNumB = *(const int*)bPtr;
+	double scoreA, scoreB;
+
+	scoreA = failFast_score(standardFunctionInfos[functionNumA].namePtr);
+	scoreB = failFast_score(standardFunctionInfos[functionNumB].namePtr);
+	if (scoreA != scoreB) return (scoreA < scoreB) ? 1 : -1;
+	return functionNumA - functionNumB;
+
 }
 
 void softfloat_invalidF128M(uint32_t* val) {
@@ -1459,13 +3332,28 @@ int main(int argc, char* argv[])
 	const struct standardFunctionInfo* standardFunctionInfoPtr;
 	uint_fast8_t roundingPrecision;
 	int roundingCode;
-	void (* const* subjFunctionPtrPtr)();
+	void (**subjFunctionPtrPtr)();
+	const char* argPtr;
+	long i;
+	void (*trueFunction)();
+	bool resume;
+	const char* programPath;
+	int numProcesses;
+	double soakSeconds;
+	int numFunctions, functionNum;
+	int* functionOrder;
+	enum { maxRequestArgs = 64 };
+	char* requestArgs[maxRequestArgs];
+	bool threadsGiven, roundingGiven, functionsNamed;
+	const char* failMapPath;
 
 	fail_programName = "testfloat-pe";
+	functionRegistry_init();
 	genCases_setLevel(1);
 	verCases_maxErrorCount = 20;
 	testLoops_trueFlagsPtr = &softfloat_exceptionFlags;
 	testLoops_subjFlagsFunction = subjfloat_clearExceptionFlags;
+	testLoops_subjRoundingModeFunction = subjfloat_setRoundingMode;
 	standardFunctionInfoPtr = 0;
 	roundingPrecision = 80;
 	roundingCode = ROUND_NEAR_EVEN;
@@ -1476,18 +3364,495 @@ int main(int argc, char* argv[])
 	verCases_checkNaNs = true;
 	verCases_checkInvInts = false;
 	verCases_tininessCode = TININESS_BEFORE_ROUNDING;
+	resume = false;
+	programPath = argv[0];
+	numProcesses = 0;
+	soakSeconds = 0;
+	threadsGiven = false;
+	roundingGiven = false;
+	functionsNamed = false;
+	failMapPath = 0;
+	--argc;
+	++argv;
+	for (; argc; --argc, ++argv) {
+		argPtr = *argv;
+		if (argPtr[0] == '-') ++argPtr;
+		if (
+			!strcmp(argPtr, "help") || !strcmp(argPtr, "-help")
+			|| !strcmp(argPtr, "h")
+			) {
+			fprintf(stderr,
+				"%s [<option>...] [<function>...]\n"
+				"  <function>:  Test only the named functions (all by default).\n"
+				"  <option>:  (* is default)\n"
+				"    -help            --Write this message and exit.\n"
+				"    -level <num>     --Testing level <num> (1 or 2).\n"
+				" *  -level 1\n"
+				"    -quick <num>     --In place of the testing level, test <num> cases\n"
+				"                         from each stratum of operand classes and\n"
+				"                         exponents, and give the confidence that\n"
+				"                         strata without errors rarely fail.\n"
+				"    -exhaustive      --In place of the testing level, test every value\n"
+				"                         of the operand of ui32, i32 and f32 functions\n"
+				"                         of one operand, and every pair of operands of\n"
+				"                         f16 and bf16 functions of two (all such\n"
+				"                         functions by default), in all rounding modes\n"
+				"                         unless a rounding option is given, and on all\n"
+				"                         processors unless -threads, -processes or\n"
+				"                         -checkpoint is given.\n"
+				"    -failmap <file>  --With -exhaustive, go on after errors and keep a\n"
+				"                         bitmap of the failing operands of each test in\n"
+				"                         <file>.\n"
+				"    -threads <num>   --Run each test on <num> threads (0 = all\n"
+				"                         processors).\n"
+				" *  -threads 1\n"
+				"    -seed <num>      --Seed the random case sequence with <num>.\n"
+				" *  -seed 1\n"
+				"    -forkserver      --Read option lines from standard input and run\n"
+				"                         each in a forked child, writing its exit status\n"
+				"                         to standard output.\n"
+				"    -processes <num> --Run each test in a child process, on <num>\n"
+				"                         processes at a time (0 = all processors).\n"
+				"    -history <file>  --With -processes, keep the time taken per case by\n"
+				"                         each function in <file>, to start the longest\n"
+				"                         jobs first.\n"
+				"    -shard <i> <n>   --Run only the i-th of <n> equal shares of the jobs\n"
+				"                         (implies -processes 1 if not given).\n"
+				"    -partial <file>  --Write the results of the jobs run to <file> instead,\n"
+				"                         to be combined with -merge.\n"
+				"    -merge <file>... --Combine the -partial files of all shards into the\n"
+				"                         report of a single run, then exit.\n"
+				"    -soak <seconds>  --Test over and over with new random cases for a total\n"
+				"                         of about <seconds>, then report the rates.\n"
+				"    -priority <function> <num>\n"
+				"                     --With -soak, give <function> <num> times the\n"
+				"                         usual share of the time.\n"
+				"    -checkpoint <file>\n"
+				"                     --Save progress to <file> every minute (needs\n"
+				"                         -threads 1).\n"
+				"    -resume          --Go on from the -checkpoint file, given the same\n"
+				"                         options as the run that saved it.\n"
+				"    -watchdog <seconds>\n"
+				"                     --Report the operands and stop if a subject function\n"
+				"                         has not returned after <seconds>; with\n"
+				"                         -processes, go on with the next job.\n"
+				"    -stats <name>    --Publish live counts for each thread in the shared\n"
+				"                         memory <name>, to be shown by testfloat-stats.\n"
+				"    -classify        --Go on after errors, counting them by the classes of\n"
+				"                         operands and results and the flags that\n"
+				"                         differ, and writing a few of each class.\n"
+				"    -corpus <file>   --Add each error written to the corpus <file>, if it\n"
+				"                         is not there already (with -classify, every\n"
+				"                         error).\n"
+				"    -replay <file>   --Test only the cases in the corpus <file>, in their\n"
+				"                         own rounding modes and precisions.\n"
+				"    -failfast <file> --Test first the functions that have failed most\n"
+				"                         often, by the history in <file>, and first\n"
+				"                         probe each with typical operands of the\n"
+				"                         classes in the -corpus file that have failed.\n"
+				"    -fuse            --Test functions of the same form together, in\n"
+				"                         one pass over shared operands.\n"
+				"    -rfuse           --Test all selected rounding modes together, in one\n"
+				"                         pass over shared operands.\n"
+				"    -precision32     --For extF80, test only 32-bit rounding precision.\n"
+				"    -precision64     --For extF80, test only 64-bit rounding precision.\n"
+				" *  -precision80     --For extF80, test only 80-bit rounding precision.\n"
+				"    -precisionall    --For extF80, test all rounding precisions.\n"
+				" *  -rnear_even      --Test only rounding to nearest/even.\n"
+				"    -rminMag         --Test only rounding to minimum magnitude\n"
+				"                         (toward zero).\n"
+				"    -rmin            --Test only rounding to minimum (down).\n"
+				"    -rmax            --Test only rounding to maximum (up).\n"
+				"    -rall            --Test all rounding modes.\n",
+				fail_programName
+			);
+			return EXIT_SUCCESS;
+		}
+		else if (!strcmp(argPtr, "level")) {
+			if (argc < 2) goto optionError;
+			i = strtol(argv[1], (char**)&argPtr, 10);
+			if (*argPtr) goto optionError;
+			genCases_setLevel(i);
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "quick")) {
+			if (argc < 2) goto optionError;
+			i = strtol(argv[1], (char**)&argPtr, 10);
+			if (*argPtr) goto optionError;
+			genCases_setQuick(i);
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "exhaustive")) {
+			genCases_exhaustive = true;
+		}
+		else if (!strcmp(argPtr, "failmap")) {
+			if (argc < 2) goto optionError;
+			failMapPath = argv[1];
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "threads")) {
+			if (argc < 2) goto optionError;
+			i = strtol(argv[1], (char**)&argPtr, 10);
+			if (*argPtr || (i < 0)) goto optionError;
+			testLoops_numThreads = i ? i : thread_numProcessors();
+			threadsGiven = true;
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "processes")) {
+			if (argc < 2) goto optionError;
+			i = strtol(argv[1], (char**)&argPtr, 10);
+			if (*argPtr || (i < 0)) goto optionError;
+			numProcesses = i ? i : thread_numProcessors();
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "history")) {
+			if (argc < 2) goto optionError;
+			historyPath = argv[1];
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "shard")) {
+			if (argc < 3) goto optionError;
+			shardNum = strtol(argv[1], (char**)&argPtr, 10) - 1;
+			if (*argPtr) goto optionError;
+			numShards = strtol(argv[2], (char**)&argPtr, 10);
+			if (*argPtr) goto optionError;
+			if ((shardNum < 0) || (numShards <= shardNum)) {
+				fail("Invalid shard %d of %d", shardNum + 1, numShards);
+			}
+			argc -= 2;
+			argv += 2;
+		}
+		else if (!strcmp(argPtr, "partial")) {
+			if (argc < 2) goto optionError;
+			partialPath = argv[1];
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "merge")) {
+			if (argc < 2) fail("'%s' option requires file names", *argv);
+			mergePartials(argc - 1, argv + 1);
+			verCases_exitWithStatus();
+		}
+		else if (!strcmp(argPtr, "job")) {
+			/*----------------------------------------------------------------
+			| Internal, used by `-processes':  `-job <function> <rounding>
+			| <precision>' runs one job and exits.
+			*----------------------------------------------------------------*/
+			if (argc < 4) goto optionError;
+			i = strtol(argv[1], (char**)&argPtr, 10);
+			if (*argPtr || (i < 0)) goto optionError;
+			standardFunctionInfoPtr = &standardFunctionInfos[i];
+			subjFunctionPtr = functionRegistry_subjFunctions[i];
+			roundingCode = strtol(argv[2], (char**)&argPtr, 10);
+			if (*argPtr) goto optionError;
+			roundingPrecision = strtol(argv[3], (char**)&argPtr, 10);
+			if (*argPtr) goto optionError;
+			if (testLoops_hangSeconds) testLoops_startWatchdog();
+			saveFailures = false;
+			testFunction(standardFunctionInfoPtr, roundingPrecision, roundingCode);
+			verCases_exitWithStatus();
+		}
+		else if (!strcmp(argPtr, "seed")) {
+			if (argc < 2) goto optionError;
+			random_setSeed(strtoull(argv[1], (char**)&argPtr, 10));
+			if (*argPtr) goto optionError;
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "forkserver")) {
+			/*----------------------------------------------------------------
+			| Each request line holds more options, read in the forked child
+			| as if they followed `-forkserver' on the command line.
+			*----------------------------------------------------------------*/
+			i = subprocess_forkServer(
+					stdin, stdout, requestArgs + 1, maxRequestArgs - 1);
+			if (i < 0) return EXIT_SUCCESS;
+			argc = i + 1;
+			argv = requestArgs;
+		}
+		else if (!strcmp(argPtr, "soak")) {
+			if (argc < 2) goto optionError;
+			soakSeconds = strtod(argv[1], (char**)&argPtr);
+			if (*argPtr || (soakSeconds <= 0)) goto optionError;
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "priority")) {
+			if (argc < 3) goto optionError;
+			if (numPriorities == maxPriorities) fail("Too many priorities");
+			priorities[numPriorities].namePtr = argv[1];
+			priorities[numPriorities].priority =
+				strtod(argv[2], (char**)&argPtr);
+			if (*argPtr || (priorities[numPriorities].priority < 0)) {
+				goto optionError;
+			}
+			++numPriorities;
+			argc -= 2;
+			argv += 2;
+		}
+		else if (!strcmp(argPtr, "checkpoint")) {
+			if (argc < 2) goto optionError;
+			testLoops_checkpointPath = argv[1];
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "resume")) {
+			resume = true;
+		}
+		else if (!strcmp(argPtr, "watchdog")) {
+			if (argc < 2) goto optionError;
+			testLoops_hangSeconds = strtod(argv[1], (char**)&argPtr);
+			if (*argPtr || (testLoops_hangSeconds <= 0)) goto optionError;
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "stats")) {
+			if (argc < 2) goto optionError;
+			statsName = argv[1];
+			liveStats_create(statsName);
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "joinstats")) {
+			/*----------------------------------------------------------------
+			| Internal, used by `-processes':  `-joinstats <name>' publishes
+			| to the parent's `-stats' memory.
+			*----------------------------------------------------------------*/
+			if (argc < 2) goto optionError;
+			liveStats_join(argv[1]);
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "classify")) {
+			errorClasses_active = true;
+			verCases_errorStop = false;
+			verCases_maxErrorCount = 0;
+		}
+		else if (!strcmp(argPtr, "corpus")) {
+			if (argc < 2) goto optionError;
+			corpusPath = argv[1];
+			corpus_record(corpusPath);
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "failfast")) {
+			if (argc < 2) goto optionError;
+			failFastPath = argv[1];
+			saveFailures = true;
+			failFast_load(failFastPath);
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "replay")) {
+			if (argc < 2) goto optionError;
+			corpus_replay(argv[1]);
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "fuse")) {
+			fuse = true;
+		}
+		else if (!strcmp(argPtr, "rfuse")) {
+			rfuse = true;
+		}
+		else if (!strcmp(argPtr, "precision32")) {
+			roundingPrecision = 32;
+		}
+		else if (!strcmp(argPtr, "precision64")) {
+			roundingPrecision = 64;
+		}
+		else if (!strcmp(argPtr, "precision80")) {
+			roundingPrecision = 80;
+		}
+		else if (!strcmp(argPtr, "precisionall")) {
+			roundingPrecision = 0;
+		}
+		else if (!strcmp(argPtr, "rnear_even")) {
+			roundingCode = ROUND_NEAR_EVEN;
+			roundingGiven = true;
+		}
+		else if (!strcmp(argPtr, "rminMag")) {
+			roundingCode = ROUND_MINMAG;
+			roundingGiven = true;
+		}
+		else if (!strcmp(argPtr, "rmin")) {
+			roundingCode = ROUND_MIN;
+			roundingGiven = true;
+		}
+		else if (!strcmp(argPtr, "rmax")) {
+			roundingCode = ROUND_MAX;
+			roundingGiven = true;
+		}
+		else if (!strcmp(argPtr, "rall")) {
+			roundingCode = 0;
+			roundingGiven = true;
+		}
+		else if (*argv[0] != '-') {
+			i = functionRegistry_find(*argv);
+			if (i < 0) fail("Invalid function '%s'", *argv);
+			if (!functionRegistry_select(i)) {
+				fail("No subject function for '%s'", *argv);
+			}
+			functionsNamed = true;
+		}
+		else {
+			fail("Invalid option '%s'", *argv);
+		}
+	}
 
-	standardFunctionInfoPtr = standardFunctionInfos;
-	subjFunctionPtrPtr = subjfloat_functions;
-	while (standardFunctionInfoPtr->namePtr) {
+	if (partialPath && !numShards) numShards = 1;
+	if (numShards) {
+		if (soakSeconds) fail("-shard and -partial cannot be used with -soak");
+		if (!numProcesses) numProcesses = 1;
+	}
+	if (genCases_exhaustive) {
+		/*--------------------------------------------------------------------
+		| Checkpoints are for one thread only, and with -processes the jobs
+		| already share the processors, so all processors are used only
+		| without either.
+		*--------------------------------------------------------------------*/
+		if (!threadsGiven && !testLoops_checkpointPath && !numProcesses) {
+			testLoops_numThreads = thread_numProcessors();
+		}
+		if (!roundingGiven) roundingCode = 0;
+	}
+	if (testLoops_checkpointPath) {
+		if (
+			(1 < testLoops_numThreads) || fuse || rfuse || soakSeconds
+			|| numProcesses
+			) {
+			fail("-checkpoint cannot be used with -threads, -fuse, -rfuse, -soak, -processes or -shard");
+		}
+		if (resume) testLoops_resume();
+	}
+	else if (resume) {
+		fail("-resume requires -checkpoint");
+	}
+	if (testLoops_hangSeconds && (fuse || rfuse)) {
+		fail("-watchdog cannot be used with -fuse or -rfuse");
+	}
+	if (errorClasses_active && (fuse || rfuse || soakSeconds || testLoops_checkpointPath)) {
+		fail("-classify cannot be used with -fuse, -rfuse, -soak or -checkpoint");
+	}
+	if (
+		corpus_replaying
+		&& (fuse || rfuse || soakSeconds || numProcesses
+			|| testLoops_checkpointPath)
+		) {
+		fail("-replay cannot be used with -fuse, -rfuse, -soak, -processes, -shard or -checkpoint");
+	}
+	if (genCases_quick && (corpus_replaying || soakSeconds || testLoops_checkpointPath)) {
+		fail("-quick cannot be used with -replay, -soak or -checkpoint");
+	}
+	if (
+		failFastPath
+		&& (corpus_replaying || fuse || rfuse || soakSeconds || numShards
+			|| partialPath || testLoops_checkpointPath)
+		) {
+		fail(
+			"-failfast cannot be used with -replay, -fuse, -rfuse, -soak, -shard, "
+			"-partial or -checkpoint"
+		);
+	}
+	if (genCases_exhaustive) {
+		if (genCases_quick || corpus_replaying || soakSeconds) {
+			fail("-exhaustive cannot be used with -quick, -replay or -soak");
+		}
+		/*--------------------------------------------------------------------
+		| Every function named must apply; with none named, those that do
+		| not apply are dropped.
+		*--------------------------------------------------------------------*/
+		for (i = 0; standardFunctionInfos[i].namePtr; ++i) {
+			if (
+				functionRegistry_subjFunctions[i]
+				&& !exhaustiveApplies(&standardFunctionInfos[i])
+				) {
+				if (functionsNamed) {
+					fail(
+						"'%s' cannot be tested with -exhaustive",
+						standardFunctionInfos[i].namePtr
+					);
+				}
+				functionRegistry_subjFunctions[i] = 0;
+			}
+		}
+	}
+	if (failMapPath) {
+		if (!genCases_exhaustive) fail("-failmap requires -exhaustive");
+		if (fuse || rfuse || numProcesses || testLoops_checkpointPath) {
+			fail("-failmap cannot be used with -fuse, -rfuse, -processes, -shard or -checkpoint");
+		}
+		verCases_errorStop = false;
+		failMap_open(failMapPath);
+	}
+	if (numProcesses) {
+		runJobs(programPath, numProcesses, roundingPrecision, roundingCode);
+		verCases_exitWithStatus();
+	}
+	if (testLoops_hangSeconds) testLoops_startWatchdog();
+	if (soakSeconds) {
+		soakFunctions(soakSeconds, roundingPrecision, roundingCode);
+		verCases_exitWithStatus();
+	}
+	for (numFunctions = 0; standardFunctionInfos[numFunctions].namePtr; ++numFunctions);
+	if (fuse || rfuse) {
+		fusedTested = calloc(numFunctions, sizeof *fusedTested);
+		if (!fusedTested) fail("Out of memory");
+	}
+	functionOrder = malloc((numFunctions + 1) * sizeof *functionOrder);
+	if (!functionOrder) fail("Out of memory");
+	for (i = 0; i < numFunctions; ++i) functionOrder[i] = i;
+	if (failFastPath) {
+		qsort(
+			functionOrder,
+			numFunctions,
+			sizeof *functionOrder,
+			compareFunctionFailScores
+		);
+	}
+	for (functionNum = 0; functionNum < numFunctions; ++functionNum) {
+		standardFunctionInfoPtr = &standardFunctionInfos[functionOrder[functionNum]];
+		subjFunctionPtrPtr = &functionRegistry_subjFunctions[functionOrder[functionNum]];
 		subjFunctionPtr = *subjFunctionPtrPtr;
-		if (subjFunctionPtr) {
-			testFunction(
-				standardFunctionInfoPtr, roundingPrecision, roundingCode);
+		if (
+			subjFunctionPtr
+			&& (!corpus_replaying
+				|| corpus_numCases(standardFunctionInfoPtr->namePtr, -1, -1))
+			) {
+			if (
+				(fuse || rfuse)
+				&& fusedKindOf(
+					standardFunctionInfoPtr->functionCode, &trueFunction)
+				) {
+				if (
+					!fusedTested[standardFunctionInfoPtr - standardFunctionInfos]
+					) {
+					testFusedFunctions(
+						standardFunctionInfoPtr,
+						subjFunctionPtrPtr,
+						roundingPrecision,
+						roundingCode
+					);
+				}
+			}
+			else {
+				testFunction(
+					standardFunctionInfoPtr, roundingPrecision, roundingCode);
+			}
 		}
-		++standardFunctionInfoPtr;
-		++subjFunctionPtrPtr;
 	}
+	free(functionOrder);
+	if (testLoops_checkpointPath) remove(testLoops_checkpointPath);
 	verCases_exitWithStatus();
+
+ optionError:
+	fail("'%s' option requires numeric argument", *argv);
+	return EXIT_FAILURE;
 }
 
@@ -0,0 +1,170 @@
+
+/*============================================================================
+
+This C source file is part of TestFloat, Release 3e, a package of programs for
+testing the correctness of floating-point arithmetic complying with the IEEE
+Standard for Floating-Point, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018 The Regents of the
+University of California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+	this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+	this list of conditions, and the following disclaimer in the documentation
+	and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+	be used to endorse or promote products derived from this software without
+	specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+/*----------------------------------------------------------------------------
+| Shows the live counts that `testfloat-pe -stats <name>' publishes, once or
+| every few seconds until the run ends (when the process that created the
+| segment exits normally).
+*----------------------------------------------------------------------------*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include "platform.h"
+#include "fail.h"
+#include "thread.h"
+#include "liveStats.h"
+
+static void writeStats(const struct liveStats_segment* segmentPtr)
+{
+	const struct liveStats_thread* threadPtr;
+	uint_fast64_t numCases, numErrors;
+	double casesPerSecond;
+	int slotNum;
+
+	numCases = 0;
+	numErrors = 0;
+	casesPerSecond = 0;
+	puts("thread  state              cases     cases/s  errors  done  test");
+	for (slotNum = 0; slotNum < liveStats_maxThreads; ++slotNum) {
+		threadPtr = &segmentPtr->threads[slotNum];
+		numCases += threadPtr->numCases;
+		numErrors += threadPtr->numErrors;
+		if (!threadPtr->inUse) continue;
+		casesPerSecond += threadPtr->casesPerSecond;
+		printf(
+			"%6d  %-10s  %12llu  %10.0f  %6llu  ",
+			slotNum,
+			(threadPtr->state < liveStats_numStates)
+				? liveStats_stateNames[threadPtr->state] : "?",
+			(unsigned long long)threadPtr->numCases,
+			threadPtr->casesPerSecond,
+			(unsigned long long)threadPtr->numErrors
+		);
+		if (threadPtr->instanceNumCases) {
+			printf(
+				"%3d%%  ",
+				(int)(100.0 * threadPtr->caseNum / threadPtr->instanceNumCases)
+			);
+		}
+		else {
+			fputs("      ", stdout);
+		}
+		printf("%.*s\n", liveStats_maxNameSize, threadPtr->testName);
+	}
+	printf(
+		"total           %12llu  %10.0f  %6llu\n\n",
+		(unsigned long long)numCases,
+		casesPerSecond,
+		(unsigned long long)numErrors
+	);
+	fflush(stdout);
+
+}
+
+int main(int argc, char* argv[])
+{
+	const char* argPtr;
+	const char* name;
+	double interval;
+	bool once, ended;
+	const struct liveStats_segment* segmentPtr;
+
+	fail_programName = "testfloat-stats";
+	name = 0;
+	interval = 2;
+	once = false;
+	--argc;
+	++argv;
+	for (; argc; --argc, ++argv) {
+		argPtr = *argv;
+		if (!argPtr) break;
+		if (argPtr[0] != '-') {
+			if (name) fail("Only one shared memory name may be given");
+			name = argPtr;
+			continue;
+		}
+		++argPtr;
+		if (!strcmp(argPtr, "help") || !strcmp(argPtr, "-help") || !strcmp(argPtr, "h")) {
+			fputs(
+				"testfloat-stats [<option>...] <name>\n"
+				"  Shows the live counts published by 'testfloat-pe -stats <name>'.\n"
+				"  <option>:  (* is default)\n"
+				"    -help            --Write this message and exit.\n"
+				"    -interval <seconds>\n"
+				"                     --Show the counts every <seconds>.\n"
+				" *  -interval 2\n"
+				"    -once            --Show the counts once and exit.\n",
+				stdout
+			);
+			return EXIT_SUCCESS;
+		}
+		else if (!strcmp(argPtr, "interval")) {
+			if (argc < 2) goto optionError;
+			interval = strtod(argv[1], (char**)&argPtr);
+			if (*argPtr || (interval <= 0)) goto optionError;
+			--argc;
+			++argv;
+		}
+		else if (!strcmp(argPtr, "once")) {
+			once = true;
+		}
+		else {
+			fail("Invalid option '%s'", *argv);
+		}
+	}
+	if (!name) fail("No shared memory name given");
+	segmentPtr = liveStats_attach(name);
+	if (!segmentPtr) fail("Cannot open shared memory `%s'", name);
+	for (;;) {
+		/*--------------------------------------------------------------------
+		| The end is noted before the counts are read, so that the last counts
+		| shown are the final ones.
+		*--------------------------------------------------------------------*/
+		ended = segmentPtr->ended;
+		writeStats(segmentPtr);
+		if (once || ended) break;
+		thread_sleep(interval);
+	}
+	return EXIT_SUCCESS;
+
+ optionError:
+	fail("'%s' option requires numeric argument", *argv);
+	return EXIT_FAILURE;
+}